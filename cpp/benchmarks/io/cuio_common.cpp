@@ -38,8 +38,9 @@ std::string random_file_in_dir(std::string const& dir_path)
   return filename;
 }
 
-cuio_source_sink_pair::cuio_source_sink_pair(io_type type)
-  : type{type}, file_name{random_file_in_dir(tmpdir.path())}
+cuio_source_sink_pair::cuio_source_sink_pair(io_type type,
+                                             cudf::io::file_sink_options const& file_options)
+  : type{type}, file_name{random_file_in_dir(tmpdir.path())}, file_options{file_options}
 {
 }
 
@@ -56,7 +57,12 @@ cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
 {
   switch (type) {
     case io_type::VOID: return cudf_io::sink_info(&void_sink);
-    case io_type::FILEPATH: return cudf_io::sink_info(file_name);
+    case io_type::FILEPATH:
+      if (file_options.write_behind) {
+        file_sink = cudf_io::data_sink::create(file_name, file_options);
+        return cudf_io::sink_info(file_sink.get());
+      }
+      return cudf_io::sink_info(file_name);
     case io_type::HOST_BUFFER: return cudf_io::sink_info(&buffer);
     default: CUDF_FAIL("invalid output type");
   }
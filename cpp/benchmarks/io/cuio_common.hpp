@@ -22,6 +22,8 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/types.hpp>
 
+#include <atomic>
+
 using cudf::io::io_type;
 
 #define RD_BENCHMARK_DEFINE_ALL_SOURCES(benchmark, name, type_or_group)                  \
@@ -49,7 +51,13 @@ class cuio_source_sink_pair {
   };
 
  public:
-  cuio_source_sink_pair(io_type type);
+  /**
+   * @brief Constructs a source/sink pair of the given type.
+   *
+   * @param type Type of the source and sink
+   * @param file_options Options of the file sink, used when `type` is `FILEPATH`
+   */
+  cuio_source_sink_pair(io_type type, cudf::io::file_sink_options const& file_options = {});
   ~cuio_source_sink_pair()
   {
     // delete the temporary file
@@ -83,9 +91,47 @@ class cuio_source_sink_pair {
   io_type const type;
   std::vector<char> buffer;
   std::string const file_name;
+  cudf::io::file_sink_options const file_options;
+  std::unique_ptr<cudf::io::data_sink> file_sink;
   bytes_written_only_sink void_sink;
 };
 
+/**
+ * @brief Data source that reads from a host buffer and counts the bytes read.
+ *
+ * Device reads are not supported, so the count covers all data that a reader reads.
+ */
+class bytes_read_counting_source : public cudf::io::datasource {
+ public:
+  explicit bytes_read_counting_source(cudf::io::host_buffer const& buffer)
+    : source{cudf::io::datasource::create(buffer)}
+  {
+  }
+
+  std::unique_ptr<datasource::buffer> host_read(size_t offset, size_t size) override
+  {
+    auto buffer = source->host_read(offset, size);
+    _bytes_read += buffer->size();
+    return buffer;
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read = source->host_read(offset, size, dst);
+    _bytes_read += read;
+    return read;
+  }
+
+  [[nodiscard]] size_t size() const override { return source->size(); }
+
+  [[nodiscard]] size_t bytes_read() const { return _bytes_read; }
+  void reset() { _bytes_read = 0; }
+
+ private:
+  std::unique_ptr<cudf::io::datasource> source;
+  std::atomic<size_t> _bytes_read = 0;
+};
+
 /**
  * @brief Column selection strategy.
  */
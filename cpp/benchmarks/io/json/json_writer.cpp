@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+#include <benchmarks/io/nvbench_helpers.hpp>
+
+#include <cudf/io/json.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+constexpr int64_t data_size        = 256 << 20;
+constexpr cudf::size_type num_cols = 64;
+
+template <data_type DataType>
+void BM_json_write_encode(nvbench::state& state, nvbench::type_list<nvbench::enum_type<DataType>>)
+{
+  cudf::rmm_pool_raii rmm_pool;
+
+  auto const d_type    = get_type_or_group(static_cast<int32_t>(DataType));
+  auto const lines     = static_cast<bool>(state.get_int64("lines"));
+  auto const sink_type = io_type::HOST_BUFFER;
+
+  auto const tbl =
+    create_random_table(cycle_dtypes(d_type, num_cols), table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::size_t encoded_file_size = 0;
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch, auto& timer) {
+               cuio_source_sink_pair source_sink(sink_type);
+
+               timer.start();
+               cudf::io::json_writer_options options =
+                 cudf::io::json_writer_options::builder(source_sink.make_sink_info(), view)
+                   .lines(lines);
+               cudf::io::write_json(options);
+               timer.stop();
+
+               encoded_file_size = source_sink.size();
+             });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
+}
+
+void BM_json_write_rows_per_chunk(nvbench::state& state)
+{
+  cudf::rmm_pool_raii rmm_pool;
+
+  auto const d_type = get_type_or_group({static_cast<int32_t>(data_type::INTEGRAL),
+                                         static_cast<int32_t>(data_type::FLOAT),
+                                         static_cast<int32_t>(data_type::STRING),
+                                         static_cast<int32_t>(data_type::LIST),
+                                         static_cast<int32_t>(data_type::STRUCT)});
+  cudf::size_type const rows_per_chunk = state.get_int64("rows_per_chunk");
+
+  auto const tbl =
+    create_random_table(cycle_dtypes(d_type, num_cols), table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::size_t encoded_file_size = 0;
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch, auto& timer) {
+               cuio_source_sink_pair source_sink(io_type::VOID);
+
+               timer.start();
+               cudf::io::json_writer_options options =
+                 cudf::io::json_writer_options::builder(source_sink.make_sink_info(), view)
+                   .lines(true)
+                   .rows_per_chunk(rows_per_chunk);
+               cudf::io::write_json(options);
+               timer.stop();
+
+               encoded_file_size = source_sink.size();
+             });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(data_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(encoded_file_size, "encoded_file_size", "encoded_file_size");
+}
+
+using d_type_list = nvbench::enum_type_list<data_type::INTEGRAL,
+                                            data_type::FLOAT,
+                                            data_type::DECIMAL,
+                                            data_type::TIMESTAMP,
+                                            data_type::DURATION,
+                                            data_type::STRING,
+                                            data_type::LIST,
+                                            data_type::STRUCT>;
+
+NVBENCH_BENCH_TYPES(BM_json_write_encode, NVBENCH_TYPE_AXES(d_type_list))
+  .set_name("json_write_encode")
+  .set_type_axes_names({"data_type"})
+  .add_int64_axis("lines", {0, 1})
+  .set_min_samples(4);
+
+NVBENCH_BENCH(BM_json_write_rows_per_chunk)
+  .set_name("json_write_rows_per_chunk")
+  .add_int64_power_of_two_axis("rows_per_chunk", nvbench::range(12, 20, 4))
+  .set_min_samples(4);
@@ -72,12 +72,30 @@ NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
   [](auto value) {
     switch (value) {
       case cudf::io::compression_type::SNAPPY: return "SNAPPY";
+      case cudf::io::compression_type::LZ4: return "LZ4";
+      case cudf::io::compression_type::GZIP: return "GZIP";
       case cudf::io::compression_type::NONE: return "NONE";
       default: return "Unknown";
     }
   },
   [](auto) { return std::string{}; })
 
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+  cudf::io::column_encoding,
+  [](auto value) {
+    switch (value) {
+      case cudf::io::column_encoding::USE_DEFAULT: return "USE_DEFAULT";
+      case cudf::io::column_encoding::DICTIONARY: return "DICTIONARY";
+      case cudf::io::column_encoding::PLAIN: return "PLAIN";
+      case cudf::io::column_encoding::DELTA_BINARY_PACKED: return "DELTA_BINARY_PACKED";
+      case cudf::io::column_encoding::DELTA_LENGTH_BYTE_ARRAY: return "DELTA_LENGTH_BYTE_ARRAY";
+      case cudf::io::column_encoding::DELTA_BYTE_ARRAY: return "DELTA_BYTE_ARRAY";
+      case cudf::io::column_encoding::BYTE_STREAM_SPLIT: return "BYTE_STREAM_SPLIT";
+      default: return "Unknown";
+    }
+  },
+  [](auto) { return std::string{}; })
+
 enum class uses_index : bool { YES, NO };
 
 enum class uses_numpy_dtype : bool { YES, NO };
@@ -151,6 +169,19 @@ NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
   },
   [](auto) { return std::string{}; })
 
+enum class uses_bloom_filter : bool { YES, NO };
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+  uses_bloom_filter,
+  [](auto value) {
+    switch (value) {
+      case uses_bloom_filter::YES: return "YES";
+      case uses_bloom_filter::NO: return "NO";
+      default: return "Unknown";
+    }
+  },
+  [](auto) { return std::string{}; })
+
 enum class converts_strings : bool { YES, NO };
 
 enum class uses_pandas_metadata : bool { YES, NO };
@@ -20,11 +20,16 @@
 #include <benchmarks/io/cuio_common.hpp>
 #include <benchmarks/io/nvbench_helpers.hpp>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/io/orc.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <nvbench/nvbench.cuh>
 
+#include <limits>
+
 constexpr int64_t data_size = 512 << 20;
 
 std::vector<std::string> get_col_names(cudf::io::source_info const& source)
@@ -153,3 +158,67 @@ NVBENCH_BENCH_TYPES(
   .set_type_axes_names(
     {"column_selection", "row_selection", "uses_index", "uses_numpy_dtype", "timestamp_type"})
   .set_min_samples(4);
+
+template <uses_bloom_filter UsesBloomFilter>
+void BM_orc_read_point_lookup(nvbench::state& state,
+                              nvbench::type_list<nvbench::enum_type<UsesBloomFilter>>)
+{
+  cudf::rmm_pool_raii rmm_pool;
+
+  // Keys are spread over the whole range of values in each stripe, so that the stripe statistics
+  // cannot exclude any stripe from a point lookup
+  auto const profile = data_profile_builder().cardinality(0).null_probability(0.0).distribution(
+    cudf::type_id::INT64, distribution_id::UNIFORM, 0, std::numeric_limits<int64_t>::max());
+  auto const tbl  = create_random_table({cudf::type_id::INT64,
+                                        cudf::type_id::FLOAT64,
+                                        cudf::type_id::INT32,
+                                        cudf::type_id::STRING},
+                                       table_size_bytes{data_size},
+                                       profile);
+  auto const view = tbl->view();
+
+  cudf::io::table_input_metadata metadata(view);
+  metadata.column_metadata[0].set_bloom_filter(UsesBloomFilter == uses_bloom_filter::YES);
+
+  cuio_source_sink_pair source_sink(io_type::HOST_BUFFER);
+  cudf::io::orc_writer_options const write_options =
+    cudf::io::orc_writer_options::builder(source_sink.make_sink_info(), view).metadata(&metadata);
+  cudf::io::write_orc(write_options);
+
+  // Look up a key from the middle of the table
+  auto key           = cudf::get_element(view.column(0), view.num_rows() / 2);
+  auto const literal = cudf::ast::literal(static_cast<cudf::numeric_scalar<int64_t>&>(*key));
+  auto const column  = cudf::ast::column_reference(0);
+  auto const filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, column, literal);
+
+  bytes_read_counting_source source(source_sink.make_source_info().buffers()[0]);
+  cudf::io::orc_reader_options const read_options =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{&source}).filter(filter);
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      try_drop_l3_cache();
+      source.reset();
+
+      timer.start();
+      auto const result = cudf::io::read_orc(read_options);
+      timer.stop();
+
+      CUDF_EXPECTS(result.tbl->num_rows() > 0, "Benchmark did not find the key");
+    });
+
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
+  state.add_buffer_size(source.bytes_read(), "bytes_read", "bytes_read");
+  state.add_buffer_size(source_sink.size() - source.bytes_read(), "bytes_skipped", "bytes_skipped");
+}
+
+NVBENCH_BENCH_TYPES(BM_orc_read_point_lookup,
+                    NVBENCH_TYPE_AXES(nvbench::enum_type_list<uses_bloom_filter::YES,
+                                                              uses_bloom_filter::NO>))
+  .set_name("orc_read_point_lookup")
+  .set_type_axes_names({"uses_bloom_filter"})
+  .set_min_samples(4);
@@ -29,6 +29,8 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <chrono>
+
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
 
 constexpr int64_t data_size = 512 << 20;
@@ -135,6 +137,58 @@ void nvbench_orc_chunked_write(nvbench::state& state)
   state.add_element_count(total_rows, "Total Rows");
 }
 
+// Writes chunks to a file, with and without write-behind buffering; the drain time is the time
+// spent in `close` waiting for the buffered data to reach the file, so the time saved by the
+// write-behind buffers, compared to the drain time, shows how much of the file I/O overlapped
+// with the encoding of the later chunks
+void nvbench_orc_chunked_write_file(nvbench::state& state)
+{
+  cudf::rmm_pool_raii rmm_pool;
+
+  cudf::size_type num_cols   = state.get_int64("num_columns");
+  cudf::size_type num_tables = state.get_int64("num_chunks");
+  cudf::io::file_sink_options file_options;
+  file_options.write_behind = static_cast<bool>(state.get_int64("write_behind"));
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  for (cudf::size_type idx = 0; idx < num_tables; idx++) {
+    tables.push_back(
+      create_random_table(cycle_dtypes({cudf::type_id::INT32, cudf::type_id::STRING}, num_cols),
+                          table_size_bytes{size_t(data_size / num_tables)}));
+  }
+
+  state.add_global_memory_reads<int64_t>(data_size);
+
+  std::chrono::duration<double> drain_time{};
+  int64_t num_iterations = 0;
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(
+    nvbench::exec_tag::timer | nvbench::exec_tag::sync, [&](nvbench::launch& launch, auto& timer) {
+      cuio_source_sink_pair source_sink(io_type::FILEPATH, file_options);
+      timer.start();
+
+      cudf::io::chunked_orc_writer_options opts =
+        cudf::io::chunked_orc_writer_options::builder(source_sink.make_sink_info());
+      cudf::io::orc_chunked_writer writer(opts);
+      std::for_each(tables.begin(),
+                    tables.end(),
+                    [&writer](std::unique_ptr<cudf::table> const& tbl) { writer.write(*tbl); });
+      auto const close_start = std::chrono::steady_clock::now();
+      writer.close();
+      drain_time += std::chrono::steady_clock::now() - close_start;
+
+      timer.stop();
+      ++num_iterations;
+    });
+
+  auto& summary = state.add_summary("nv/orc_write/drain_time/mean");
+  summary.set_string("name", "Drain Time");
+  summary.set_string("hint", "duration");
+  summary.set_string("description", "Mean time spent in close() flushing the file");
+  summary.set_float64("value", drain_time.count() / num_iterations);
+}
+
 NVBENCH_BENCH(nvbench_orc_write)
   .set_name("orc_write")
   .set_min_samples(4)
@@ -145,3 +199,10 @@ NVBENCH_BENCH(nvbench_orc_chunked_write)
   .set_min_samples(4)
   .add_int64_axis("num_columns", {8, 64})
   .add_int64_axis("num_chunks", {8, 64});
+
+NVBENCH_BENCH(nvbench_orc_chunked_write_file)
+  .set_name("orc_chunked_write_file")
+  .set_min_samples(4)
+  .add_int64_axis("num_columns", {8, 64})
+  .add_int64_axis("num_chunks", {8, 64})
+  .add_int64_axis("write_behind", {0, 1});
@@ -21,6 +21,7 @@
 #include <benchmarks/io/nvbench_helpers.hpp>
 
 #include <cudf/io/parquet.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <nvbench/nvbench.cuh>
@@ -115,6 +116,58 @@ void BM_parquet_read_io_compression(
   parquet_read_common(write_opts, source_sink, state);
 }
 
+template <data_type DataType, cudf::io::column_encoding Encoding>
+void BM_parquet_read_encoding(
+  nvbench::state& state,
+  nvbench::type_list<nvbench::enum_type<DataType>, nvbench::enum_type<Encoding>>)
+{
+  auto const is_supported = [] {
+    switch (Encoding) {
+      case cudf::io::column_encoding::DELTA_BINARY_PACKED:
+        return DataType == data_type::INTEGRAL or DataType == data_type::TIMESTAMP;
+      case cudf::io::column_encoding::DELTA_LENGTH_BYTE_ARRAY:
+      case cudf::io::column_encoding::DELTA_BYTE_ARRAY: return DataType == data_type::STRING;
+      case cudf::io::column_encoding::BYTE_STREAM_SPLIT: return DataType == data_type::FLOAT;
+      default: return true;
+    }
+  }();
+  if (not is_supported) {
+    state.skip("Encoding is not supported for the data type");
+    return;
+  }
+
+  cudf::rmm_pool_raii rmm_pool;
+
+  auto const d_type                 = get_type_or_group(static_cast<int32_t>(DataType));
+  cudf::size_type const cardinality = state.get_int64("cardinality");
+  auto const source_type            = io_type::FILEPATH;
+
+  auto const tbl = create_random_table(cycle_dtypes(d_type, num_cols),
+                                       table_size_bytes{data_size},
+                                       data_profile_builder().cardinality(cardinality));
+
+  // ids, timestamps and keys are often sorted, which is where the DELTA encodings pay off
+  std::vector<std::unique_ptr<cudf::column>> sorted_columns;
+  for (auto const& col : tbl->view()) {
+    sorted_columns.push_back(std::move(cudf::sort(cudf::table_view{{col}})->release().front()));
+  }
+  auto const sorted_tbl = cudf::table(std::move(sorted_columns));
+  auto const view       = sorted_tbl.view();
+
+  cudf::io::table_input_metadata metadata(view);
+  for (auto& col_meta : metadata.column_metadata) {
+    col_meta.set_encoding(Encoding);
+  }
+
+  cuio_source_sink_pair source_sink(source_type);
+  cudf::io::parquet_writer_options write_opts =
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+      .metadata(&metadata)
+      .compression(cudf::io::compression_type::SNAPPY);
+
+  parquet_read_common(write_opts, source_sink, state);
+}
+
 using d_type_list = nvbench::enum_type_list<data_type::INTEGRAL,
                                             data_type::FLOAT,
                                             data_type::DECIMAL,
@@ -127,8 +180,19 @@ using d_type_list = nvbench::enum_type_list<data_type::INTEGRAL,
 using io_list =
   nvbench::enum_type_list<cudf::io::io_type::FILEPATH, cudf::io::io_type::HOST_BUFFER>;
 
-using compression_list =
-  nvbench::enum_type_list<cudf::io::compression_type::SNAPPY, cudf::io::compression_type::NONE>;
+using compression_list = nvbench::enum_type_list<cudf::io::compression_type::SNAPPY,
+                                                 cudf::io::compression_type::LZ4,
+                                                 cudf::io::compression_type::GZIP,
+                                                 cudf::io::compression_type::NONE>;
+
+using encoding_d_type_list = nvbench::
+  enum_type_list<data_type::INTEGRAL, data_type::FLOAT, data_type::TIMESTAMP, data_type::STRING>;
+
+using encoding_list = nvbench::enum_type_list<cudf::io::column_encoding::USE_DEFAULT,
+                                              cudf::io::column_encoding::DELTA_BINARY_PACKED,
+                                              cudf::io::column_encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                              cudf::io::column_encoding::DELTA_BYTE_ARRAY,
+                                              cudf::io::column_encoding::BYTE_STREAM_SPLIT>;
 
 NVBENCH_BENCH_TYPES(BM_parquet_read_data, NVBENCH_TYPE_AXES(d_type_list))
   .set_name("parquet_read_decode")
@@ -143,3 +207,10 @@ NVBENCH_BENCH_TYPES(BM_parquet_read_io_compression, NVBENCH_TYPE_AXES(io_list, c
   .set_min_samples(4)
   .add_int64_axis("cardinality", {0, 1000})
   .add_int64_axis("run_length", {1, 32});
+
+NVBENCH_BENCH_TYPES(BM_parquet_read_encoding,
+                    NVBENCH_TYPE_AXES(encoding_d_type_list, encoding_list))
+  .set_name("parquet_read_encoding")
+  .set_type_axes_names({"data_type", "encoding"})
+  .set_min_samples(4)
+  .add_int64_axis("cardinality", {0, 1000});
@@ -116,7 +116,9 @@ BENCHMARK_DEFINE_F(ParquetWrite, writer_options)
 (::benchmark::State& state) { BM_parq_write_varying_options(state); }
 BENCHMARK_REGISTER_F(ParquetWrite, writer_options)
   ->ArgsProduct({{int32_t(cudf::io::compression_type::NONE),
-                  int32_t(cudf::io::compression_type::SNAPPY)},
+                  int32_t(cudf::io::compression_type::SNAPPY),
+                  int32_t(cudf::io::compression_type::LZ4),
+                  int32_t(cudf::io::compression_type::GZIP)},
                  {int32_t(cudf::io::statistics_freq::STATISTICS_NONE),
                   int32_t(cudf::io::statistics_freq::STATISTICS_ROWGROUP),
                   int32_t(cudf::io::statistics_freq::STATISTICS_PAGE)},
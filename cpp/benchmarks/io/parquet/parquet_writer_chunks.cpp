@@ -23,6 +23,8 @@
 #include <cudf/io/parquet.hpp>
 #include <cudf/table/table.hpp>
 
+#include <chrono>
+
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
 
 constexpr int64_t data_size = 512 << 20;
@@ -85,6 +87,40 @@ void PQ_write_chunked(benchmark::State& state)
   state.counters["encoded_file_size"] = source_sink.size();
 }
 
+// Writes chunks to a file, with or without write-behind buffering; reports the time spent in
+// `close` waiting for the buffered data to reach the file
+void PQ_write_chunked_file(benchmark::State& state)
+{
+  cudf::size_type num_cols   = state.range(0);
+  cudf::size_type num_tables = state.range(1);
+  cudf_io::file_sink_options file_options;
+  file_options.write_behind = static_cast<bool>(state.range(2));
+
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  for (cudf::size_type idx = 0; idx < num_tables; idx++) {
+    tables.push_back(create_random_table(cycle_dtypes({cudf::type_id::INT32}, num_cols),
+                                         table_size_bytes{size_t(data_size / num_tables)}));
+  }
+
+  std::chrono::duration<double, std::milli> drain_time{};
+  for (auto _ : state) {
+    cuio_source_sink_pair source_sink(io_type::FILEPATH, file_options);
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::chunked_parquet_writer_options opts =
+      cudf_io::chunked_parquet_writer_options::builder(source_sink.make_sink_info());
+    cudf_io::parquet_chunked_writer writer(opts);
+    std::for_each(tables.begin(), tables.end(), [&writer](std::unique_ptr<cudf::table> const& tbl) {
+      writer.write(*tbl);
+    });
+    auto const close_start = std::chrono::steady_clock::now();
+    writer.close();
+    drain_time += std::chrono::steady_clock::now() - close_start;
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * data_size);
+  state.counters["drain_time_ms"] = drain_time.count() / state.iterations();
+}
+
 #define PWBM_BENCHMARK_DEFINE(name, size, num_columns)                                    \
   BENCHMARK_DEFINE_F(ParquetWrite, name)(::benchmark::State & state) { PQ_write(state); } \
   BENCHMARK_REGISTER_F(ParquetWrite, name)                                                \
@@ -111,3 +147,17 @@ PWCBM_BENCHMARK_DEFINE(3Gb1024Cols64Chunks, 1024, 8);
 
 PWCBM_BENCHMARK_DEFINE(3Gb8Cols128Chunks, 8, 64);
 PWCBM_BENCHMARK_DEFINE(3Gb1024Cols128Chunks, 1024, 64);
+
+#define PWCFBM_BENCHMARK_DEFINE(name, num_columns, num_chunks, write_behind) \
+  BENCHMARK_DEFINE_F(ParquetWriteChunked, name)(::benchmark::State & state)  \
+  {                                                                          \
+    PQ_write_chunked_file(state);                                            \
+  }                                                                          \
+  BENCHMARK_REGISTER_F(ParquetWriteChunked, name)                            \
+    ->Args({num_columns, num_chunks, write_behind})                          \
+    ->Unit(benchmark::kMillisecond)                                          \
+    ->UseManualTime()                                                        \
+    ->Iterations(4)
+
+PWCFBM_BENCHMARK_DEFINE(3Gb8Cols64ChunksFile, 8, 64, 0);
+PWCFBM_BENCHMARK_DEFINE(3Gb8Cols64ChunksFileWriteBehind, 8, 64, 1);
@@ -43,7 +43,15 @@
 
 temp_directory const temp_dir("cudf_nvbench");
 
-enum class data_chunk_source_type { device, file, host, host_pinned };
+enum class data_chunk_source_type {
+  device,
+  file,
+  host,
+  host_pinned,
+  file_mmap,
+  file_pread,
+  file_device,
+};
 
 static cudf::string_scalar create_random_input(int32_t num_chars,
                                                double delim_factor,
@@ -104,7 +112,11 @@ static void bench_multibyte_split(nvbench::state& state)
   auto host_pinned_input =
     thrust::host_vector<char, thrust::system::cuda::experimental::pinned_allocator<char>>{};
 
-  if (source_type == data_chunk_source_type::host || source_type == data_chunk_source_type::file) {
+  auto const is_file_source = source_type == data_chunk_source_type::file ||
+                              source_type == data_chunk_source_type::file_mmap ||
+                              source_type == data_chunk_source_type::file_pread ||
+                              source_type == data_chunk_source_type::file_device;
+  if (source_type == data_chunk_source_type::host || is_file_source) {
     host_input = cudf::detail::make_std_vector_sync<char>(
       {device_input.data(), static_cast<std::size_t>(device_input.size())},
       cudf::default_stream_value);
@@ -118,13 +130,21 @@ static void bench_multibyte_split(nvbench::state& state)
   }
 
   auto source = [&] {
+    if (is_file_source) {
+      auto const temp_file_name = random_file_in_dir(temp_dir.path());
+      std::ofstream(temp_file_name, std::ofstream::out).write(host_input.data(), host_input.size());
+      cudf::io::text::file_source_options options;
+      options.mode = [&] {
+        switch (source_type) {
+          case data_chunk_source_type::file_mmap: return cudf::io::text::file_read_mode::MMAP;
+          case data_chunk_source_type::file_pread: return cudf::io::text::file_read_mode::PREAD;
+          case data_chunk_source_type::file_device: return cudf::io::text::file_read_mode::DEVICE;
+          default: return cudf::io::text::file_read_mode::STREAM;
+        }
+      }();
+      return cudf::io::text::make_source_from_file(temp_file_name, options);
+    }
     switch (source_type) {
-      case data_chunk_source_type::file: {
-        auto const temp_file_name = random_file_in_dir(temp_dir.path());
-        std::ofstream(temp_file_name, std::ofstream::out)
-          .write(host_input.data(), host_input.size());
-        return cudf::io::text::make_source_from_file(temp_file_name);
-      }
       case data_chunk_source_type::host:  //
         return cudf::io::text::make_source(host_input);
       case data_chunk_source_type::host_pinned:
@@ -158,7 +178,10 @@ NVBENCH_BENCH(bench_multibyte_split)
                   {static_cast<int>(data_chunk_source_type::device),
                    static_cast<int>(data_chunk_source_type::file),
                    static_cast<int>(data_chunk_source_type::host),
-                   static_cast<int>(data_chunk_source_type::host_pinned)})
+                   static_cast<int>(data_chunk_source_type::host_pinned),
+                   static_cast<int>(data_chunk_source_type::file_mmap),
+                   static_cast<int>(data_chunk_source_type::file_pread),
+                   static_cast<int>(data_chunk_source_type::file_device)})
   .add_int64_axis("delim_size", {1, 4, 7})
   .add_int64_axis("delim_percent", {1, 25})
   .add_int64_power_of_two_axis("size_approx", {15, 30})
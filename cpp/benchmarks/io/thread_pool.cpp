@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+// Measures the delay between submitting a task and a worker starting to execute it, with all
+// workers idle when the batch is submitted
+void BM_thread_pool_submit_latency(nvbench::state& state)
+{
+  auto const thread_count = static_cast<int>(state.get_int64("thread_count"));
+  auto const num_tasks    = static_cast<int>(state.get_int64("num_tasks"));
+
+  cudf::detail::thread_pool pool(thread_count);
+  std::vector<std::future<clock_type::duration>> tasks;
+  tasks.reserve(num_tasks);
+  clock_type::duration total_latency{};
+  int64_t num_samples = 0;
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch, auto& timer) {
+               tasks.clear();
+               timer.start();
+               for (int i = 0; i < num_tasks; ++i) {
+                 tasks.push_back(pool.submit(
+                   [](clock_type::time_point submitted) { return clock_type::now() - submitted; },
+                   clock_type::now()));
+               }
+               for (auto& task : tasks) {
+                 total_latency += task.get();
+               }
+               timer.stop();
+               num_samples += num_tasks;
+             });
+
+  auto& summary = state.add_summary("nv/thread_pool/submit_latency/mean");
+  summary.set_string("name", "Submit Latency");
+  summary.set_string("hint", "duration");
+  summary.set_string("description", "Mean time from task submission to task start");
+  summary.set_float64("value",
+                      std::chrono::duration<double>(total_latency).count() / num_samples);
+  state.add_element_count(num_tasks, "tasks");
+}
+
+NVBENCH_BENCH(BM_thread_pool_submit_latency)
+  .set_name("thread_pool_submit_latency")
+  .set_min_samples(4)
+  .add_int64_axis("thread_count", {1, 4, 16})
+  .add_int64_axis("num_tasks", {1, 16, 1024});
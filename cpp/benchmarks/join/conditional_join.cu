@@ -16,6 +16,8 @@
 
 #include <benchmarks/join/join_common.hpp>
 
+#include <algorithm>
+
 template <typename key_type, typename payload_type>
 class ConditionalJoin : public cudf::benchmark {
 };
@@ -143,6 +145,56 @@ CONDITIONAL_LEFT_SEMI_JOIN_BENCHMARK_DEFINE(conditional_left_semi_join_64bit_nul
                                             int64_t,
                                             true);
 
+// Joins each left timestamp with the right intervals containing it. The range predicate lets the
+// join binary search the sorted timestamps of each interval instead of comparing all the rows.
+template <typename key_type>
+void BM_conditional_band_join(benchmark::State& state)
+{
+  auto const build_table_size = static_cast<cudf::size_type>(state.range(0));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.range(1));
+  auto const interval_stride =
+    static_cast<key_type>(std::max(1, probe_table_size / std::max(1, build_table_size)));
+  auto const interval_length = static_cast<key_type>(10);
+
+  auto const zero   = cudf::make_fixed_width_scalar<key_type>(static_cast<key_type>(0));
+  auto const stride = cudf::make_fixed_width_scalar<key_type>(interval_stride);
+  auto const length = cudf::make_fixed_width_scalar<key_type>(interval_length);
+  auto const one    = cudf::make_fixed_width_scalar<key_type>(static_cast<key_type>(1));
+
+  auto const build_start_column = cudf::sequence(build_table_size, *zero, *stride);
+  auto const build_end_column   = cudf::sequence(build_table_size, *length, *stride);
+  auto const probe_key_column   = cudf::sequence(probe_table_size, *zero, *one);
+
+  cudf::table_view build_table({*build_start_column, *build_end_column});
+  cudf::table_view probe_table({*probe_key_column});
+
+  auto const col_ref_left_0  = cudf::ast::column_reference(0);
+  auto const col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto const lower_bound     = cudf::ast::operation(
+    cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left_0, col_ref_right_0);
+  auto const upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_left_0, col_ref_right_1);
+  auto const band =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, cudf::default_stream_value);
+
+    auto result = cudf::conditional_inner_join(probe_table, build_table, band);
+  }
+}
+
+#define CONDITIONAL_INNER_BAND_JOIN_BENCHMARK_DEFINE(name, key_type)     \
+  BENCHMARK_TEMPLATE_DEFINE_F(ConditionalJoin, name, key_type, key_type) \
+  (::benchmark::State & st)                                              \
+  {                                                                      \
+    BM_conditional_band_join<key_type>(st);                              \
+  }
+
+CONDITIONAL_INNER_BAND_JOIN_BENCHMARK_DEFINE(conditional_inner_band_join_32bit, int32_t);
+CONDITIONAL_INNER_BAND_JOIN_BENCHMARK_DEFINE(conditional_inner_band_join_64bit, int64_t);
+
 // inner join -----------------------------------------------------------------------
 BENCHMARK_REGISTER_F(ConditionalJoin, conditional_inner_join_32bit)
   ->Unit(benchmark::kMillisecond)
@@ -176,6 +228,20 @@ BENCHMARK_REGISTER_F(ConditionalJoin, conditional_inner_join_64bit_nulls)
   ->Args({100'000, 1'000'000})
   ->UseManualTime();
 
+BENCHMARK_REGISTER_F(ConditionalJoin, conditional_inner_band_join_32bit)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100'000, 100'000})
+  ->Args({100'000, 1'000'000})
+  ->Args({1'000'000, 10'000'000})
+  ->UseManualTime();
+
+BENCHMARK_REGISTER_F(ConditionalJoin, conditional_inner_band_join_64bit)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100'000, 100'000})
+  ->Args({100'000, 1'000'000})
+  ->Args({1'000'000, 10'000'000})
+  ->UseManualTime();
+
 // left join -----------------------------------------------------------------------
 BENCHMARK_REGISTER_F(ConditionalJoin, conditional_left_join_32bit)
   ->Unit(benchmark::kMillisecond)
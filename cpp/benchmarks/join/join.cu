@@ -17,6 +17,12 @@
 #include <benchmarks/fixture/rmm_pool_raii.hpp>
 #include <benchmarks/join/join_common.hpp>
 
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+
 void skip_helper(nvbench::state& state)
 {
   auto const build_table_size = state.get_int64("Build Table Size");
@@ -93,6 +99,141 @@ void nvbench_full_join(nvbench::state& state,
   BM_join<key_type, payload_type, Nullable>(state, join);
 }
 
+/**
+ * @brief Generates keys cycling through `num_keys` distinct values.
+ */
+struct modulo_key_generator {
+  cudf::size_type num_keys;
+  __device__ int32_t operator()(cudf::size_type i) const { return i % num_keys; }
+};
+
+void nvbench_paged_inner_join(nvbench::state& state)
+{
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const build_table_size = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const num_keys         = static_cast<cudf::size_type>(state.get_int64("Distinct Keys"));
+  auto const page_size        = static_cast<std::size_t>(state.get_int64("Page Size"));
+
+  // Each key is duplicated `build_table_size / num_keys` times in the build table
+  auto const make_keys = [num_keys](cudf::size_type size) {
+    auto keys = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32}, size);
+    thrust::tabulate(rmm::exec_policy(cudf::default_stream_value),
+                     keys->mutable_view().begin<int32_t>(),
+                     keys->mutable_view().end<int32_t>(),
+                     modulo_key_generator{num_keys});
+    return keys;
+  };
+  auto const build_keys = make_keys(build_table_size);
+  auto const probe_keys = make_keys(probe_table_size);
+  cudf::table_view const build_table({*build_keys});
+  cudf::table_view const probe_table({*probe_keys});
+
+  cudf::hash_join hj_obj(build_table, cudf::null_equality::UNEQUAL);
+  state.add_element_count(hj_obj.inner_join_size(probe_table), "Output Pairs");
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    rmm::cuda_stream_view stream_view{launch.get_stream()};
+    auto cursor = hj_obj.inner_join_cursor(probe_table, stream_view);
+    while (not cursor->done()) {
+      auto page = cursor->next(page_size, stream_view);
+    }
+  });
+}
+
+/**
+ * @brief Generates `num_keys` distinct keys in ascending order, each repeated about
+ * `size / num_keys` times.
+ */
+struct sorted_key_generator {
+  cudf::size_type size;
+  cudf::size_type num_keys;
+  __device__ int32_t operator()(cudf::size_type i) const
+  {
+    return static_cast<int32_t>(static_cast<int64_t>(i) * num_keys / size);
+  }
+};
+
+void nvbench_sorted_inner_join(nvbench::state& state)
+{
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const build_table_size = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const num_keys         = static_cast<cudf::size_type>(state.get_int64("Distinct Keys"));
+  auto const algorithm        = state.get_string("Algorithm");
+
+  auto const make_keys = [num_keys](cudf::size_type size) {
+    auto keys = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32}, size);
+    thrust::tabulate(rmm::exec_policy(cudf::default_stream_value),
+                     keys->mutable_view().begin<int32_t>(),
+                     keys->mutable_view().end<int32_t>(),
+                     sorted_key_generator{size, num_keys});
+    return keys;
+  };
+  auto const build_keys = make_keys(build_table_size);
+  auto const probe_keys = make_keys(probe_table_size);
+  cudf::table_view const build_table({*build_keys});
+  cudf::table_view const probe_table({*probe_keys});
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    rmm::cuda_stream_view stream_view{launch.get_stream()};
+    if (algorithm == "hash") {
+      cudf::hash_join hj_obj(build_table, cudf::null_equality::UNEQUAL, stream_view);
+      auto result = hj_obj.inner_join(probe_table, std::nullopt, stream_view);
+    } else {
+      auto result = cudf::sorted_inner_join(probe_table, build_table);
+    }
+  });
+}
+
+/**
+ * @brief Generates the symbols of `num_symbols` interleaved time series.
+ */
+struct symbol_generator {
+  cudf::size_type num_symbols;
+  __device__ int32_t operator()(cudf::size_type i) const { return i % num_symbols; }
+};
+
+void nvbench_asof_join(nvbench::state& state)
+{
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const build_table_size = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const num_symbols      = static_cast<cudf::size_type>(state.get_int64("Symbols"));
+
+  auto const make_symbols = [num_symbols](cudf::size_type size) {
+    auto symbols = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32}, size);
+    thrust::tabulate(rmm::exec_policy(cudf::default_stream_value),
+                     symbols->mutable_view().begin<int32_t>(),
+                     symbols->mutable_view().end<int32_t>(),
+                     symbol_generator{num_symbols});
+    return symbols;
+  };
+  // Both tables span the same time range, the build (quote) times in reverse order
+  auto const make_times = [](cudf::size_type size, int64_t start, int64_t step) {
+    auto const init = cudf::make_fixed_width_scalar<int64_t>(start);
+    auto const by   = cudf::make_fixed_width_scalar<int64_t>(step);
+    return cudf::sequence(size, *init, *by);
+  };
+  auto const build_step    = std::max<int64_t>(1, probe_table_size / build_table_size);
+  auto const build_symbols = make_symbols(build_table_size);
+  auto const probe_symbols = make_symbols(probe_table_size);
+  auto const build_times = make_times(build_table_size, build_step * build_table_size, -build_step);
+  auto const probe_times = make_times(probe_table_size, 0, 1);
+  cudf::table_view const build_keys({*build_symbols});
+  cudf::table_view const probe_keys({*probe_symbols});
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = cudf::asof_join(probe_keys, build_keys, *probe_times, *build_times);
+  });
+}
+
 // inner join -----------------------------------------------------------------------
 NVBENCH_BENCH_TYPES(nvbench_inner_join,
                     NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t>,
@@ -209,3 +350,26 @@ NVBENCH_BENCH_TYPES(nvbench_full_join,
   .set_type_axes_names({"Key Type", "Payload Type", "Nullable"})
   .add_int64_axis("Build Table Size", {40'000'000, 50'000'000})
   .add_int64_axis("Probe Table Size", {50'000'000, 120'000'000});
+
+// paged inner join -----------------------------------------------------------------
+NVBENCH_BENCH(nvbench_paged_inner_join)
+  .set_name("paged_inner_join_duplicate_keys")
+  .add_int64_axis("Build Table Size", {100'000})
+  .add_int64_axis("Probe Table Size", {100'000, 1'000'000})
+  .add_int64_axis("Distinct Keys", {100, 10'000})
+  .add_int64_axis("Page Size", {1'000'000, 10'000'000});
+
+// sorted inner join ----------------------------------------------------------------
+NVBENCH_BENCH(nvbench_sorted_inner_join)
+  .set_name("sorted_inner_join")
+  .add_string_axis("Algorithm", {"hash", "sorted"})
+  .add_int64_axis("Build Table Size", {1'000'000, 10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000, 20'000'000})
+  .add_int64_axis("Distinct Keys", {1'000'000, 10'000'000});
+
+// as-of join -----------------------------------------------------------------------
+NVBENCH_BENCH(nvbench_asof_join)
+  .set_name("asof_join")
+  .add_int64_axis("Build Table Size", {1'000'000, 10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000, 50'000'000})
+  .add_int64_axis("Symbols", {100, 10'000});
@@ -44,6 +44,38 @@ constexpr int DEFAULT_JOIN_CG_SIZE = 2;
 
 enum class join_kind { INNER_JOIN, LEFT_JOIN, FULL_JOIN, LEFT_SEMI_JOIN, LEFT_ANTI_JOIN };
 
+/**
+ * @brief State of a paged probe of a `hash_join`, resumed by each `hash_join::probe_page` call.
+ */
+struct join_cursor_state {
+  /**
+   * @brief Constructor that flattens the given `probe` table.
+   *
+   * @param kind The type of join to be performed
+   * @param probe_table The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  join_cursor_state(join_kind kind,
+                    cudf::table_view const& probe_table,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether all the output indices of the join have been returned.
+   */
+  [[nodiscard]] bool done() const;
+
+  join_kind const kind;                                    ///< type of join to be performed
+  cudf::structs::detail::flattened_table flattened_probe;  ///< owns the flattened `probe`
+  cudf::table_view probe;                                  ///< flattened probe table
+  rmm::device_uvector<std::size_t> match_offsets;          ///< inclusive scan of pairs per row
+  rmm::device_uvector<bool> build_matched;                 ///< matched build rows, full joins
+  rmm::device_uvector<size_type> pending_left;             ///< pairs returned over several
+  rmm::device_uvector<size_type> pending_right;            ///< pages
+  std::size_t pending_position = 0;                        ///< pending pairs already returned
+  cudf::size_type probe_row    = 0;                        ///< next probe row to retrieve
+  bool is_complement_queued    = false;                    ///< unmatched build rows queued
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -142,6 +174,42 @@ struct hash_join {
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr) const;
 
+  /**
+   * @brief Starts a paged probe of the `_hash_table` for tuples in `probe`, counting the pairs of
+   * each probe row.
+   *
+   * @throw cudf::logic_error if `kind` is not an inner, left or full join.
+   *
+   * @param kind The type of join to be performed
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The state of the paged probe
+   */
+  std::unique_ptr<join_cursor_state> make_cursor(join_kind kind,
+                                                 cudf::table_view const& probe,
+                                                 rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Returns the next page of at most `max_pairs` output indices of a paged probe.
+   *
+   * The pairs of consecutive probe rows are retrieved together. A probe row with more than
+   * `max_pairs` pairs is retrieved once and returned over several pages.
+   *
+   * @param cursor The state of the paged probe, advanced past the returned pairs
+   * @param max_pairs Maximum number of pairs in the page
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vectors
+   *
+   * @return Join output indices vector pair, empty once the probe is done
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  probe_page(join_cursor_state& cursor,
+             std::size_t max_pairs,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr) const;
+
  private:
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
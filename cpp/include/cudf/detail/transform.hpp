@@ -43,8 +43,8 @@ std::unique_ptr<column> transform(
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> compute_column(
-  table_view const table,
-  ast::operation const& expr,
+  table_view const& table,
+  ast::expression const& expr,
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
@@ -29,6 +29,22 @@
 namespace cudf {
 //! IO interfaces
 namespace io {
+/**
+ * @brief Options for data sinks that write to a local file
+ */
+struct file_sink_options {
+  /**
+   * @brief Whether host writes are staged in a ring of pinned buffers and written to the file in
+   * the background.
+   *
+   * `host_write` only blocks when all buffers are being written; `flush` blocks until all staged
+   * data is written to the file.
+   */
+  bool write_behind  = false;
+  size_t buffer_size = 8 * 1024 * 1024;  ///< Size of each write-behind buffer, in bytes
+  size_t num_buffers = 4;                ///< Number of write-behind buffers
+};
+
 /**
  * @brief Interface class for storing the output data from the writers
  */
@@ -42,6 +58,16 @@ class data_sink {
    */
   static std::unique_ptr<data_sink> create(const std::string& filepath);
 
+  /**
+   * @brief Create a sink from a file path, with the given file sink options
+   *
+   * @param[in] filepath Path to the file to use
+   * @param[in] options Options that control how the file is written
+   * @return Constructed data_sink object
+   */
+  static std::unique_ptr<data_sink> create(const std::string& filepath,
+                                           file_sink_options const& options);
+
   /**
    * @brief Create a sink from a std::vector
    *
@@ -188,6 +214,9 @@ class data_sink {
 
   /**
    * @pure @brief Flush the data written into the sink
+   *
+   * Sinks that write asynchronously block until all previous writes are complete, and report
+   * write errors.
    */
   virtual void flush() = 0;
 
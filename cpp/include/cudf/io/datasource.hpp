@@ -32,6 +32,7 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -262,6 +263,41 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read_async must override it.");
   }
 
+  /**
+   * @brief Range of bytes in the source, used for vectored reads.
+   */
+  struct range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
+  /**
+   * @brief Whether `host_read` calls can be made concurrently from multiple threads.
+   *
+   * Data source implementations that are not thread-safe don't need to override this function.
+   *
+   * @return bool Whether this source supports concurrent host_read() calls
+   */
+  [[nodiscard]] virtual bool supports_concurrent_host_reads() const { return false; }
+
+  /**
+   * @brief Asynchronously reads a set of ranges into host buffers.
+   *
+   * Ranges that are at most `max_gap` bytes apart are coalesced into a single `host_read` call,
+   * reading the bytes in between to save requests. The coalesced reads are issued in parallel if
+   * the source supports concurrent host reads, and in order on a separate thread otherwise.
+   *
+   * The source must outlive the returned future.
+   *
+   * @param ranges Ranges to read; can be unordered and overlapping
+   * @param max_gap Maximum number of bytes between two ranges that are read in a single call
+   *
+   * @return Buffers with the data of each range, in the order of `ranges`, as a future value
+   * (each buffer can be smaller than the range)
+   */
+  virtual std::future<std::vector<std::unique_ptr<datasource::buffer>>> host_read_async(
+    std::vector<range> const& ranges, size_t max_gap);
+
   /**
    * @brief Returns the size of the data in the source.
    *
@@ -452,6 +488,13 @@ class arrow_io_source : public datasource {
     return result.ValueOrDie();
   }
 
+  /**
+   * @brief Whether `host_read` calls can be made concurrently; Arrow's `ReadAt` is thread-safe.
+   *
+   * @return Always true
+   */
+  [[nodiscard]] bool supports_concurrent_host_reads() const override { return true; }
+
   /**
    * @brief Returns the size of the data in the `arrow` source.
    *
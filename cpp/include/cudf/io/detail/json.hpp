@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/data_sink.hpp>
 #include <cudf/io/json.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -42,6 +43,21 @@ table_with_metadata read_json(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Write an entire dataset to JSON format.
+ *
+ * @param sink Output sink
+ * @param table The set of columns
+ * @param options Settings for controlling behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(data_sink* sink,
+                table_view const& table,
+                json_writer_options const& options,
+                rmm::cuda_stream_view stream        = cudf::default_stream_value,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace json
 }  // namespace detail
 }  // namespace io
@@ -23,6 +23,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <limits>
 #include <map>
 #include <string>
 #include <variant>
@@ -199,6 +200,10 @@ class json_reader_options {
   /**
    * @brief Whether the experimental reader should be used.
    *
+   * The experimental reader parses multiple JSON lines sources in a single pass, as if they were
+   * concatenated with a newline between each of them. The byte range then applies to the
+   * concatenated input, and includes the records that start within the range.
+   *
    * @returns true if the experimental reader will be used, false otherwise
    */
   bool is_enabled_experimental() const { return _experimental; }
@@ -412,6 +417,284 @@ table_with_metadata read_json(
   json_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/** @} */  // end of group
+
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+/**
+ *@brief Builder to build options for `write_json()`.
+ */
+class json_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_json()`.
+ */
+class json_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // string to use for null entries
+  std::string _na_rep = "null";
+  // Indicates whether to output nulls as 'null' or exclude the field
+  bool _include_nulls = false;
+  // Indicates whether to use JSON lines for records format
+  bool _lines = false;
+  // maximum number of rows to write in each chunk (limits memory use)
+  size_type _rows_per_chunk = std::numeric_limits<size_type>::max();
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit json_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table), _rows_per_chunk(table.num_rows())
+  {
+  }
+
+  friend json_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `json_writer_options`.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   *
+   * @return Builder to build json_writer_options
+   */
+  static json_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   *
+   * @return sink used for writer output
+   */
+  [[nodiscard]] sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   *
+   * @return Table that would be written to output
+   */
+  [[nodiscard]] table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   *
+   * The column names of the JSON objects are taken from `schema_info` of the metadata, or from
+   * `column_names` if the schema information is empty. Columns without a name use their index.
+   *
+   * @return Optional associated metadata
+   */
+  [[nodiscard]] table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns string used for null entries.
+   *
+   * @return string used for null entries
+   */
+  [[nodiscard]] std::string const& get_na_rep() const { return _na_rep; }
+
+  /**
+   * @brief Whether to output nulls as 'null'.
+   *
+   * @return `true` if nulls are output as 'null'
+   */
+  [[nodiscard]] bool is_enabled_include_nulls() const { return _include_nulls; }
+
+  /**
+   * @brief Whether to use JSON lines for records format.
+   *
+   * @return `true` if JSON lines is used for records format
+   */
+  [[nodiscard]] bool is_enabled_lines() const { return _lines; }
+
+  /**
+   * @brief Returns maximum number of rows to process for each file write.
+   *
+   * @return Maximum number of rows to process for each file write
+   */
+  [[nodiscard]] size_type get_rows_per_chunk() const { return _rows_per_chunk; }
+
+  // Setter
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Sets string used for null entries.
+   *
+   * @param val String to represent null value
+   */
+  void set_na_rep(std::string val) { _na_rep = std::move(val); }
+
+  /**
+   * @brief Enables/Disables output of nulls as 'null'.
+   *
+   * @param val Boolean value to enable/disable
+   */
+  void enable_include_nulls(bool val) { _include_nulls = val; }
+
+  /**
+   * @brief Enables/Disables JSON lines for records format.
+   *
+   * @param val Boolean value to enable/disable JSON lines
+   */
+  void enable_lines(bool val) { _lines = val; }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk
+   */
+  void set_rows_per_chunk(size_type val) { _rows_per_chunk = val; }
+};
+
+/**
+ * @brief Builder to build options for `write_json()`
+ */
+class json_writer_options_builder {
+  json_writer_options options;  ///< Options to be built.
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit json_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata
+   * @return this for chaining
+   */
+  json_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Sets string used for null entries.
+   *
+   * @param val String to represent null value
+   * @return this for chaining
+   */
+  json_writer_options_builder& na_rep(std::string val)
+  {
+    options._na_rep = std::move(val);
+    return *this;
+  };
+
+  /**
+   * @brief Enables/Disables output of nulls as 'null'.
+   *
+   * @param val Boolean value to enable/disable
+   * @return this for chaining
+   */
+  json_writer_options_builder& include_nulls(bool val)
+  {
+    options._include_nulls = val;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables JSON lines for records format.
+   *
+   * @param val Boolean value to enable/disable
+   * @return this for chaining
+   */
+  json_writer_options_builder& lines(bool val)
+  {
+    options._lines = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk
+   * @return this for chaining
+   */
+  json_writer_options_builder& rows_per_chunk(int val)
+  {
+    options._rows_per_chunk = val;
+    return *this;
+  }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   */
+  operator json_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `json_writer_options` object's r-value reference
+   */
+  json_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns to JSON format.
+ *
+ * Each row is written as a JSON object whose members are the columns of the table. Struct columns
+ * are written as nested objects and list columns as arrays. By default the rows are written as
+ * a JSON array of objects (records orientation); with `lines` enabled, each row is written on its
+ * own line (JSON Lines). Null members are omitted from the objects unless `include_nulls` is
+ * enabled, in which case they are written as `na_rep`. Null list elements are always written as
+ * `na_rep`. Floating-point NaN and infinity, which JSON cannot represent, are written as nulls.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  auto destination = cudf::io::sink_info("dataset.json");
+ *  auto options     = cudf::io::json_writer_options::builder(destination, table->view())
+ *    .lines(true)
+ *    .rows_per_chunk(rows_per_chunk);
+ *
+ *  cudf::io::write_json(options);
+ * @endcode
+ *
+ * @param options Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(json_writer_options const& options,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/host/host_memory_resource.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_memory
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Allocation statistics of a `pinned_pool_memory_resource`.
+ */
+struct host_memory_statistics {
+  std::size_t bytes_in_use      = 0;  ///< Bytes currently allocated from the resource
+  std::size_t peak_bytes_in_use = 0;  ///< High-water mark of `bytes_in_use`
+  std::size_t bytes_cached      = 0;  ///< Bytes of freed blocks kept for reuse
+  std::size_t num_allocations   = 0;  ///< Number of allocations served
+  std::size_t num_misses        = 0;  ///< Number of allocations not served from the cached blocks
+};
+
+/**
+ * @brief Host memory resource that caches the blocks of an upstream resource in power-of-two size
+ * classes.
+ *
+ * Intended for pinned staging buffers, which are expensive to allocate and free. Allocations are
+ * rounded up to the size class; freed blocks are kept for reuse as long as the total size of the
+ * cached blocks stays within `max_cached_bytes`. Allocations larger than `max_cached_bytes` are
+ * passed through to the upstream resource.
+ *
+ * This resource is thread-safe. The upstream resource is called outside of the internal lock, so
+ * the slow upstream allocations do not block the allocations served from the cached blocks.
+ */
+class pinned_pool_memory_resource final : public rmm::mr::host_memory_resource {
+ public:
+  static constexpr std::size_t min_block_size = 4 * 1024;  ///< Size of the smallest size class
+
+  /**
+   * @brief Constructs a pool resource.
+   *
+   * @param upstream Resource used to allocate the blocks, e.g. `rmm::mr::pinned_memory_resource`
+   * @param max_cached_bytes Maximum total size of the freed blocks kept for reuse
+   */
+  pinned_pool_memory_resource(rmm::mr::host_memory_resource* upstream,
+                              std::size_t max_cached_bytes);
+
+  /**
+   * @brief Returns the cached blocks to the upstream resource.
+   */
+  ~pinned_pool_memory_resource() override;
+
+  pinned_pool_memory_resource(pinned_pool_memory_resource const&) = delete;
+  pinned_pool_memory_resource& operator=(pinned_pool_memory_resource const&) = delete;
+
+  /**
+   * @brief Returns all cached blocks to the upstream resource.
+   */
+  void release();
+
+  /**
+   * @brief Returns the current allocation statistics.
+   *
+   * @return Snapshot of the statistics
+   */
+  [[nodiscard]] host_memory_statistics get_statistics() const;
+
+  /**
+   * @brief Returns the upstream resource.
+   *
+   * @return Pointer to the upstream resource
+   */
+  [[nodiscard]] rmm::mr::host_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+
+  rmm::mr::host_memory_resource* _upstream;
+  std::size_t _max_cached_bytes;
+  mutable std::mutex _mutex;
+  std::vector<std::vector<void*>> _free_blocks;  // cached blocks, per size class
+  host_memory_statistics _stats;
+};
+
+/**
+ * @brief Sets the host memory resource used for the pinned staging buffers of all readers and
+ * writers.
+ *
+ * The resource must outlive all reads and writes that use it. Buffers allocated before the call
+ * are returned to the resource that allocated them.
+ *
+ * @param mr The new host memory resource; `nullptr` restores the default resource
+ * @return The previous host memory resource
+ */
+rmm::mr::host_memory_resource* set_host_memory_resource(rmm::mr::host_memory_resource* mr);
+
+/**
+ * @brief Returns the host memory resource used for the pinned staging buffers of all readers and
+ * writers.
+ *
+ * The default resource is a `pinned_pool_memory_resource` over `rmm::mr::pinned_memory_resource`
+ * that caches up to `LIBCUDF_PINNED_POOL_SIZE` bytes (default 256MB).
+ *
+ * @return The current host memory resource
+ */
+rmm::mr::host_memory_resource* get_host_memory_resource();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
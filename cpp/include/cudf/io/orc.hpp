@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -23,6 +24,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -73,6 +75,9 @@ class orc_reader_options {
   // Columns that should be read as Decimal128
   std::vector<std::string> _decimal128_columns;
 
+  // Predicate filter as AST to filter output rows; `nullopt` is no filtering
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   friend orc_reader_options_builder;
 
   /**
@@ -161,6 +166,13 @@ class orc_reader_options {
    */
   std::vector<std::string> const& get_decimal128_columns() const { return _decimal128_columns; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter; `nullopt` if the option is not set
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   // Setters
 
   /**
@@ -234,6 +246,22 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The column references in the filter are indices into the output table, i.e. into the columns
+   * selected with `set_columns`, or into all top-level columns if no columns are selected. Stripes
+   * whose column statistics, row group statistics or bloom filters prove that no row can satisfy
+   * the filter are skipped before their column data is read, and the filter is then evaluated on
+   * the decoded rows so that only matching rows are returned. All row groups of a stripe that is
+   * read are decoded. The filter must not be combined with `skip_rows` or `num_rows`.
+   *
+   * The filter expression must outlive the reader.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
 };
 
 /**
@@ -353,6 +381,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -391,6 +431,104 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC file iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * This class is designed to read ORC files whose decoded table would not fit in device memory at
+ * once. Each chunk is made of whole stripes; the stripes of a chunk are selected such that the
+ * estimated size of the output table stays within `chunk_read_limit` bytes, and the stripe data
+ * loaded to device memory stays within `pass_read_limit` bytes. A chunk always contains at least
+ * one stripe. The file metadata is parsed once, and the stripe data of the next chunk is read in
+ * the background while the current chunk is decoded.
+ *
+ * The following code snippet demonstrates how to read a file chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.orc");
+ *  auto options = cudf::io::orc_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_orc_reader(512 * 1024 * 1024, options);
+ *
+ *  do {
+ *    auto const chunk = reader.read_chunk();
+ *    // Process chunk
+ *  } while (reader.has_next());
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `orc_reader_option` parameter as in `cudf::read_orc()`,
+   * and additional parameters to specify the byte limits of the output table and of the stripe
+   * data read for each chunk.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param pass_read_limit Limit on the number of bytes of stripe data loaded per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    std::size_t pass_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor for chunked reader without a limit on the stripe data read per chunk.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
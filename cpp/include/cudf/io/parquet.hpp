@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -24,6 +25,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -61,6 +63,8 @@ class parquet_reader_options {
   size_type _skip_rows = 0;
   // Number of rows to read; -1 is all
   size_type _num_rows = -1;
+  // Predicate filter as AST to filter output rows; `nullopt` is no filtering
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
@@ -159,6 +163,13 @@ class parquet_reader_options {
    */
   [[nodiscard]] auto const& get_row_groups() const { return _row_groups; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter; `nullopt` if the option is not set
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Returns timestamp type used to cast timestamp columns.
    *
@@ -187,6 +198,23 @@ class parquet_reader_options {
     _row_groups = std::move(row_groups);
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The column references in the filter are indices into the output table, i.e. into the columns
+   * selected with `set_columns()` or all top-level columns if no selection is made. Row groups
+   * whose column chunk statistics, page indexes or bloom filters prove that no row can satisfy the
+   * filter are not read, and the filter is then evaluated on the decoded rows so that only
+   * matching rows are returned. For schemas without list columns, the pages that the page
+   * indexes rule out are not read either; the pages of row groups with list columns are all read.
+   * The filter must not be combined with `skip_rows` or `num_rows`.
+   *
+   * The expression must outlive the reader that uses these options.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Sets to enable/disable conversion of strings to categories.
    *
@@ -293,6 +321,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of strings to categories.
    *
@@ -400,6 +440,86 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
+ * tables, chunk by chunk.
+ *
+ * This class is designed to address the reading issue when reading very large Parquet files such
+ * that the decoded table would not fit in device memory at once. The selected row groups are read
+ * and decompressed once, and the decoded output is split at page boundaries so that each returned
+ * table is estimated to stay within the given byte limit.
+ *
+ * The following code snippet demonstrates how to read a file chunk by chunk:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source);
+ *  auto reader  = cudf::io::chunked_parquet_reader(512 * 1024 * 1024, options);
+ *
+ *  do {
+ *    auto const chunk = reader.read_chunk();
+ *    // Process chunk
+ *  } while (reader.has_next());
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `parquet_reader_option` parameter as in
+   * `cudf::read_parquet()`, and an additional parameter to specify the size byte limit of the
+   * output table for each reading.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read Parquet file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file parquet_metadata.hpp
+ * @brief cuDF-IO freeform API
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Physical types of Parquet columns, which determine how the values are stored
+ */
+enum class parquet_physical_type : int8_t {
+  UNDEFINED            = -1,  ///< No physical type; used for group (nested) schema nodes
+  BOOLEAN              = 0,   ///< 1-bit boolean
+  INT32                = 1,   ///< 32-bit signed integer
+  INT64                = 2,   ///< 64-bit signed integer
+  INT96                = 3,   ///< 96-bit integer, deprecated timestamp representation
+  FLOAT                = 4,   ///< IEEE 32-bit floating point
+  DOUBLE               = 5,   ///< IEEE 64-bit floating point
+  BYTE_ARRAY           = 6,   ///< Arbitrary length byte array
+  FIXED_LEN_BYTE_ARRAY = 7    ///< Fixed length byte array
+};
+
+/**
+ * @brief Node of the schema tree of a Parquet file
+ *
+ * The root node represents the file itself; its children are the top-level columns.
+ */
+struct parquet_column_schema {
+  std::string name;                             ///< Column name
+  parquet_physical_type type;                   ///< Physical type, `UNDEFINED` for groups
+  std::vector<parquet_column_schema> children;  ///< Child columns
+};
+
+/**
+ * @brief Metadata and statistics of a column chunk in a row group
+ *
+ * The minimum and maximum values are plain-encoded values of the physical type of the column, and
+ * are only present if the writer stored them in the file. The column index and offset index
+ * locations are zero when the file does not contain a page index for the column chunk, and the
+ * bloom filter location is zero when the column chunk has no bloom filter.
+ */
+struct parquet_column_chunk_metadata {
+  std::vector<std::string> path_in_schema;  ///< Path of the column from the root of the schema
+  parquet_physical_type type;               ///< Physical type of the column
+  int64_t num_values;                       ///< Number of values, including nulls
+  int64_t total_uncompressed_size;          ///< Uncompressed size of all pages, in bytes
+  int64_t total_compressed_size;            ///< Compressed size of all pages, in bytes
+  int64_t data_page_offset;                 ///< File offset of the first data page
+  int64_t dictionary_page_offset;           ///< File offset of the dictionary page, or zero
+  std::optional<int64_t> null_count;        ///< Number of null values
+  std::optional<std::string> min_value;     ///< Encoded minimum value
+  std::optional<std::string> max_value;     ///< Encoded maximum value
+  int64_t column_index_offset;              ///< File offset of the column index
+  int32_t column_index_length;              ///< Size of the column index, in bytes
+  int64_t offset_index_offset;              ///< File offset of the offset index
+  int32_t offset_index_length;              ///< Size of the offset index, in bytes
+  int64_t bloom_filter_offset;              ///< File offset of the bloom filter header
+  int32_t bloom_filter_length;              ///< Size of the bloom filter and its header, in bytes
+};
+
+/**
+ * @brief Metadata of a row group
+ */
+struct parquet_rowgroup_metadata {
+  int64_t num_rows;                                    ///< Number of rows
+  int64_t total_byte_size;                             ///< Uncompressed size of all columns
+  std::vector<parquet_column_chunk_metadata> columns;  ///< Metadata of each column chunk
+};
+
+/**
+ * @brief Holds the metadata of a Parquet file, as stored in its footer
+ */
+struct parquet_metadata {
+  parquet_column_schema schema;                                     ///< Root of the schema tree
+  int64_t num_rows;                                                 ///< Number of rows
+  std::string created_by;                                           ///< Writer of the file
+  std::unordered_map<std::string, std::string> key_value_metadata;  ///< User metadata
+  std::vector<parquet_rowgroup_metadata> row_groups;                ///< Row group metadata
+};
+
+/**
+ * @brief Reads the footer metadata of a Parquet file, without reading any column data.
+ *
+ * @ingroup io_readers
+ *
+ * The following code snippet demonstrates how to read the metadata of a dataset from a file:
+ * @code
+ *  auto metadata = cudf::io::read_parquet_metadata(cudf::io::source_info("dataset.parquet"));
+ *  auto num_row_groups = metadata.row_groups.size();
+ * @endcode
+ *
+ * @param src_info Dataset source
+ *
+ * @return The schema, row group and column chunk metadata of the file
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info);
+
+/**
+ * @brief Sets the maximum number of parsed Parquet footers kept in the process-wide footer cache.
+ *
+ * @ingroup io_readers
+ *
+ * When the cache is enabled, `read_parquet` and `read_parquet_metadata` reuse the parsed footer of
+ * files read before, and skip reading and decoding it again. Footers are cached by file path, file
+ * size and last modification time, and the least recently used footers are evicted when the cache
+ * is full. Only sources created from file paths are cached. A capacity of zero disables the cache
+ * and drops all cached footers. The initial capacity is taken from the
+ * `LIBCUDF_PARQUET_FOOTER_CACHE_SIZE` environment variable, and is zero if it is not set.
+ *
+ * @param num_footers Maximum number of cached footers
+ */
+void set_parquet_footer_cache_capacity(std::size_t num_footers);
+
+/**
+ * @brief Returns the maximum number of parsed Parquet footers kept in the footer cache.
+ *
+ * @ingroup io_readers
+ *
+ * @return The capacity of the footer cache; zero if the cache is disabled
+ */
+std::size_t get_parquet_footer_cache_capacity();
+
+}  // namespace io
+}  // namespace cudf
@@ -17,9 +17,11 @@
 #pragma once
 
 #include <cudf/io/text/data_chunk_source.hpp>
+#include <cudf/io/types.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -30,11 +32,51 @@ namespace cudf::io::text {
  */
 std::unique_ptr<data_chunk_source> make_source(host_span<const char> data);
 
+/**
+ * @brief Strategies to read a file into device memory
+ */
+enum class file_read_mode : uint8_t {
+  STREAM,  ///< Sequential `std::ifstream` reads into two pinned buffers
+  MMAP,    ///< Copies from a memory mapping of the file, with sequential access advised
+  PREAD,   ///< Parallel `pread` calls that read ahead into a queue of pinned buffers
+  DEVICE   ///< Direct device reads through KvikIO or cuFile; `PREAD` if neither is available
+};
+
+/**
+ * @brief Options of the data sources that read from a file
+ *
+ * Compressed files are memory-mapped and decompressed as the chunks are requested, ignoring `mode`.
+ * `GZIP` and `BZIP2` files, including concatenated streams, are inflated on the host into pinned
+ * buffers; `ZSTD` frames are decompressed on the device with nvCOMP, and must record their
+ * decompressed size, either in the frame header or in a seek table.
+ *
+ * Skipping bytes, as done for a `byte_range_info` offset, seeks to the containing block of
+ * block-indexed files (BGZF files such as those written by `bgzip`, and `ZSTD` files) and only
+ * decompresses that block. Other `GZIP` and `BZIP2` files are decompressed up to the offset.
+ */
+struct file_source_options {
+  file_read_mode mode    = file_read_mode::STREAM;  ///< How the file is read
+  /// Size of each `PREAD` read, and initial size of the buffer `BZIP2` blocks are decompressed
+  /// into, in bytes
+  std::size_t read_size  = 16 * 1024 * 1024;
+  std::size_t read_ahead = 4;                       ///< Number of `PREAD` reads queued in advance
+  /// Compression of the file: `NONE`, `GZIP`, `BZIP2`, `ZSTD`, or `AUTO` to detect it from the
+  /// file content
+  compression_type compression = compression_type::NONE;
+};
+
 /**
  * @brief Creates a data source capable of producing device-buffered views of the file
  */
 std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename);
 
+/**
+ * @brief Creates a data source capable of producing device-buffered views of the file, reading the
+ * file as specified by the options
+ */
+std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename,
+                                                         file_source_options const& options);
+
 /**
  * @brief Creates a data source capable of producing views of the given device string scalar
  */
@@ -99,6 +99,21 @@ enum statistics_freq {
   STATISTICS_COLUMN   = 3,  ///< Full column and offset indices. Implies STATISTICS_ROWGROUP
 };
 
+/**
+ * @brief Valid encodings for use with `column_in_metadata::set_encoding()`
+ */
+enum class column_encoding {
+  USE_DEFAULT = -1,         ///< No encoding has been requested, use default encoding
+  DICTIONARY,               ///< Use dictionary encoding
+  PLAIN,                    ///< Use plain encoding
+  DELTA_BINARY_PACKED,      ///< Use DELTA_BINARY_PACKED encoding (only valid for integer columns)
+  DELTA_LENGTH_BYTE_ARRAY,  ///< Use DELTA_LENGTH_BYTE_ARRAY encoding (only valid for
+                            ///< BYTE_ARRAY columns)
+  DELTA_BYTE_ARRAY,         ///< Use DELTA_BYTE_ARRAY encoding (only valid for BYTE_ARRAY columns)
+  BYTE_STREAM_SPLIT,        ///< Use BYTE_STREAM_SPLIT encoding (only valid for floating point
+                            ///< columns)
+};
+
 /**
  * @brief Detailed name information for output columns.
  *
@@ -389,8 +404,10 @@ class column_in_metadata {
   bool _list_column_is_map  = false;
   bool _use_int96_timestamp = false;
   bool _output_as_binary    = false;
+  bool _bloom_filter        = false;
   std::optional<uint8_t> _decimal_precision;
   std::optional<int32_t> _parquet_field_id;
+  column_encoding _encoding = column_encoding::USE_DEFAULT;
   std::vector<column_in_metadata> children;
 
  public:
@@ -505,6 +522,38 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Sets the encoding to use for this column.
+   *
+   * Only used by the Parquet writer. A request for `DICTIONARY` may still fall back to `PLAIN` if
+   * the dictionary is too large. Requesting an encoding that is not valid for the physical type of
+   * the column throws when the file is written.
+   *
+   * @param encoding The encoding to use
+   * @return this for chaining
+   */
+  column_in_metadata& set_encoding(column_encoding encoding)
+  {
+    _encoding = encoding;
+    return *this;
+  }
+
+  /**
+   * @brief Specifies whether a bloom filter should be written for this column.
+   *
+   * Bloom filters let readers skip the row groups (Parquet) or stripes (ORC) that cannot contain a
+   * value, e.g. for point lookups with an equality filter. Only valid for non-nested integer,
+   * floating point and string columns; for Parquet, also for timestamp columns.
+   *
+   * @param enabled True = write a bloom filter for this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool enabled)
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -604,6 +653,20 @@ class column_in_metadata {
    * @return Boolean indicating whether to encode this column as binary data
    */
   [[nodiscard]] bool is_enabled_output_as_binary() const { return _output_as_binary; }
+
+  /**
+   * @brief Get the encoding that was set for this column.
+   *
+   * @return The encoding that was set for this column
+   */
+  [[nodiscard]] column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get whether to write a bloom filter for this column
+   *
+   * @return Boolean indicating whether to write a bloom filter for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const { return _bloom_filter; }
 };
 
 /**
@@ -27,7 +27,10 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
+#include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -40,8 +43,14 @@ class MurmurHash3_32;
 
 template <typename T>
 class hash_join;
+
+struct join_cursor_state;
+
+class grace_hash_join_impl;
 }  // namespace detail
 
+class join_cursor;
+
 /**
  * @addtogroup column_join
  * @{
@@ -256,6 +265,222 @@ std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& right,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between tables whose
+ * keys are sorted.
+ *
+ * Instead of building a hash table, the range of matching right rows of every left row is found
+ * by binary searching the sorted right keys, and the matching pairs are written in order of the
+ * left row indices, then of the right row indices. This is faster than `inner_join` for inputs
+ * that are already sorted, e.g. read from sorted files or produced by `cudf::merge`.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either `left_keys` or `right_keys` is 0 or
+ * if they mismatch.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+ * mismatches the number of key columns.
+ *
+ * @param left_keys The left table, sorted by `column_order` and `null_precedence`
+ * @param right_keys The right table, sorted by `column_order` and `null_precedence`
+ * @param column_order The sort order of each key column, all ascending if empty
+ * @param null_precedence The order of the nulls in each key column, all before if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between tables whose
+ * keys are sorted.
+ *
+ * The first returned vector contains all the row indices of the left table, in ascending order.
+ * The corresponding value in the second returned vector is either the row index of a matching
+ * right row or an unspecified out-of-bounds value.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 3}}
+ * Result: {{0, 1, 1, 2, 2, 3}, {None, 0, 1, 0, 1, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either `left_keys` or `right_keys` is 0 or
+ * if they mismatch.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+ * mismatches the number of key columns.
+ *
+ * @param left_keys The left table, sorted by `column_order` and `null_precedence`
+ * @param right_keys The right table, sorted by `column_order` and `null_precedence`
+ * @param column_order The sort order of each key column, all ascending if empty
+ * @param null_precedence The order of the nulls in each key column, all before if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a vector of row indices corresponding to a left semi join between tables whose
+ * keys are sorted.
+ *
+ * The returned vector contains, in ascending order, the row indices of the left table for which
+ * there is a matching row in the right table.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {1, 2, 3}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either `left_keys` or `right_keys` is 0 or
+ * if they mismatch.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+ * mismatches the number of key columns.
+ *
+ * @param left_keys The left table, sorted by `column_order` and `null_precedence`
+ * @param right_keys The right table, sorted by `column_order` and `null_precedence`
+ * @param column_order The sort order of each key column, all ascending if empty
+ * @param null_precedence The order of the nulls in each key column, all before if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector `left_indices` that can be used to construct the result of performing a left
+ * semi join between two tables with `left_keys` and `right_keys` as the join keys
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> sorted_left_semi_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a vector of row indices corresponding to a left anti join between tables whose
+ * keys are sorted.
+ *
+ * The returned vector contains, in ascending order, the row indices of the left table for which
+ * there is no matching row in the right table.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {0}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in either `left_keys` or `right_keys` is 0 or
+ * if they mismatch.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+ * mismatches the number of key columns.
+ *
+ * @param left_keys The left table, sorted by `column_order` and `null_precedence`
+ * @param right_keys The right table, sorted by `column_order` and `null_precedence`
+ * @param column_order The sort order of each key column, all ascending if empty
+ * @param null_precedence The order of the nulls in each key column, all before if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector `left_indices` that can be used to construct the result of performing a left
+ * anti join between two tables with `left_keys` and `right_keys` as the join keys
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> sorted_left_anti_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Direction in which an as-of join looks for the matching right row.
+ */
+enum class asof_direction : int32_t {
+  BACKWARD,  ///< Last right row whose `on` value is less than or equal to the left one
+  FORWARD,   ///< First right row whose `on` value is greater than or equal to the left one
+  NEAREST    ///< Right row whose `on` value is closest to the left one, the preceding one on ties
+};
+
+/**
+ * @brief Returns a gather map of the right table matching each row of the left table in an as-of
+ * join.
+ *
+ * Every left row is matched with at most one right row: among the right rows with equal keys, the
+ * one whose `on` value is nearest to the left `on` value in the given `direction`. This is the
+ * typical join of each trade with the latest quote of its symbol at or before the trade time.
+ *
+ * The right table is sorted by its keys and `on` values, and every left row finds its match by a
+ * binary search of its keys and `on` value, so the left table does not need to be sorted and no
+ * intermediate pairs of rows are materialized.
+ *
+ * Rows with a null `on` value never match. Among right rows with equal keys and `on` values, the
+ * last one is matched when looking backward and the first one otherwise. When looking for the
+ * nearest row, an exact match is preferred, then the preceding row of two equally distant ones.
+ *
+ * @code{.pseudo}
+ * Left keys: {{0, 0, 1, 1}}
+ * Left on: {1, 5, 2, 9}
+ * Right keys: {{1, 0, 0}}
+ * Right on: {3, 0, 4}
+ * Result (backward): {1, 2, OOB, 0}
+ * Result (forward): {2, OOB, 0, OOB}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns of `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if the keys and the `on` column of a table have different sizes.
+ * @throw cudf::logic_error if `left_on` and `right_on` have different types, or if the type is
+ * not integral, floating-point or chrono.
+ * @throw cudf::logic_error if `tolerance` is null or negative, or if its type is not the type of
+ * `on`, or the duration type of `on` for timestamps.
+ *
+ * @param left_keys The key columns of the left table, possibly none
+ * @param right_keys The key columns of the right table, possibly none
+ * @param left_on The column of the left table to match by nearest value
+ * @param right_on The column of the right table to match by nearest value
+ * @param direction The direction in which to look for the matching right row
+ * @param tolerance The greatest difference between matching `on` values, unbounded if empty
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned vector's device memory
+ *
+ * @return A vector of the index of the right row matching each left row, or an unspecified
+ * out-of-bounds value if there is none
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction                                      = asof_direction::BACKWARD,
+  std::optional<std::reference_wrapper<scalar const>> tolerance = std::nullopt,
+  null_equality compare_nulls                                   = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -398,10 +623,231 @@ class hash_join {
     rmm::cuda_stream_view stream        = cudf::default_stream_value,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Starts a paged inner join with the specified probe table, whose row indices are
+   * returned in pages of bounded size by `join_cursor::next`. @see inner_join().
+   *
+   * @note Neither the `hash_join` object nor the table viewed by `probe` may be destroyed before
+   * the returned cursor, else behavior is undefined.
+   *
+   * @throw cudf::logic_error if the number of columns in `probe` and `build` do not match.
+   * @throw cudf::logic_error if the column data types in `probe` and `build` do not match.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A cursor over the row indices of the inner join
+   */
+  std::unique_ptr<join_cursor> inner_join_cursor(
+    cudf::table_view const& probe, rmm::cuda_stream_view stream = cudf::default_stream_value) const;
+
+  /**
+   * @brief Starts a paged left join with the specified probe table. @see inner_join_cursor().
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A cursor over the row indices of the left join
+   */
+  std::unique_ptr<join_cursor> left_join_cursor(
+    cudf::table_view const& probe, rmm::cuda_stream_view stream = cudf::default_stream_value) const;
+
+  /**
+   * @brief Starts a paged full join with the specified probe table. @see inner_join_cursor().
+   *
+   * The build rows without a match are returned in the last pages.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A cursor over the row indices of the full join
+   */
+  std::unique_ptr<join_cursor> full_join_cursor(
+    cudf::table_view const& probe, rmm::cuda_stream_view stream = cudf::default_stream_value) const;
+
  private:
   const std::unique_ptr<const impl_type> _impl;
 };
 
+/**
+ * @brief Resumable probe of a `hash_join`, which returns the row indices of a join in pages of a
+ * bounded number of pairs instead of all at once.
+ *
+ * The number of pairs of each probe row is counted when the cursor is created. Each page then
+ * retrieves the pairs of as many consecutive probe rows as fit; a probe row with more pairs than
+ * fit in a page is returned over several pages. Concatenating all the pages gives the result of
+ * the corresponding `hash_join` member function, up to order.
+ *
+ * @code{.cpp}
+ * auto cursor = hash_join.inner_join_cursor(probe);
+ * while (not cursor->done()) {
+ *   auto [probe_indices, build_indices] = cursor->next(max_pairs);
+ *   ...
+ * }
+ * @endcode
+ */
+class join_cursor {
+ public:
+  join_cursor() = delete;
+  ~join_cursor();
+  join_cursor(join_cursor const&) = delete;
+  join_cursor(join_cursor&&)      = delete;
+  join_cursor& operator=(join_cursor const&) = delete;
+  join_cursor& operator=(join_cursor&&) = delete;
+
+  /**
+   * @brief Returns the row indices of the next page of the join.
+   *
+   * @throw cudf::logic_error if `max_pairs` is 0.
+   *
+   * @param max_pairs Maximum number of pairs in the page
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vectors
+   *
+   * @return A pair of vectors [`probe_indices`, `build_indices`] of at most `max_pairs` rows, empty
+   * if the join is done
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  next(std::size_t max_pairs,
+       rmm::cuda_stream_view stream        = cudf::default_stream_value,
+       rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns whether all the row indices of the join have been returned.
+   *
+   * The last page returned before the join is done may be empty.
+   *
+   * @return true if the join is done
+   */
+  [[nodiscard]] bool done() const;
+
+ private:
+  friend class hash_join;
+
+  join_cursor(hash_join::impl_type const& join, std::unique_ptr<detail::join_cursor_state> state);
+
+  hash_join::impl_type const& _join;
+  std::unique_ptr<detail::join_cursor_state> _state;
+};
+
+/**
+ * @brief Options of a `grace_hash_join`.
+ */
+struct grace_hash_join_options {
+  /// Number of partitions of each table, and of each partition that is partitioned again
+  int num_partitions = 16;
+  /// Size in bytes above which a partition is partitioned again
+  std::size_t max_partition_bytes = std::size_t{1} << 30;
+  /// Maximum number of times a partition is partitioned again
+  int max_depth = 3;
+  /// Directory of the scratch file holding the spilled partitions, or empty to hold them in
+  /// pinned host memory
+  std::string spill_directory;
+  /// Controls whether null join-key values should match or not
+  null_equality compare_nulls = null_equality::EQUAL;
+};
+
+/**
+ * @brief Out-of-core hash join, for tables larger than device memory.
+ *
+ * The left and right tables are appended in chunks that each fit on the device. Every chunk is
+ * hash partitioned on its join keys and its partitions are spilled, in `cudf::pack` format, to
+ * pinned host memory or to a scratch file. Rows with equal keys land in partitions of the same
+ * index, so the join is computed one partition pair at a time, and only one partition pair and
+ * its result are on the device at once.
+ *
+ * A partition larger than `grace_hash_join_options::max_partition_bytes`, e.g. because of
+ * skewed keys, is partitioned again with another hash seed, up to
+ * `grace_hash_join_options::max_depth` times. The rows of a single key cannot be split and are
+ * joined at once.
+ *
+ * @code{.cpp}
+ * cudf::grace_hash_join join({0}, {0}, cudf::grace_hash_join::join_kind::INNER);
+ * for (auto const& chunk : left_chunks) { join.append_left(chunk); }
+ * for (auto const& chunk : right_chunks) { join.append_right(chunk); }
+ * while (auto result = join.next()) {
+ *   ...
+ * }
+ * @endcode
+ */
+class grace_hash_join {
+ public:
+  /**
+   * @brief Type of the join.
+   */
+  enum class join_kind { INNER, LEFT, FULL };
+
+  grace_hash_join() = delete;
+  ~grace_hash_join();
+  grace_hash_join(grace_hash_join const&) = delete;
+  grace_hash_join(grace_hash_join&&)      = delete;
+  grace_hash_join& operator=(grace_hash_join const&) = delete;
+  grace_hash_join& operator=(grace_hash_join&&) = delete;
+
+  /**
+   * @brief Constructs an out-of-core hash join, to which the tables are then appended.
+   *
+   * @throw cudf::logic_error if `left_on` and `right_on` have different sizes or are empty.
+   * @throw cudf::logic_error if `options.num_partitions` is less than 2.
+   * @throw cudf::logic_error if a scratch file cannot be created in `options.spill_directory`.
+   *
+   * @param left_on The column indices of the join keys in the left table
+   * @param right_on The column indices of the join keys in the right table
+   * @param kind The type of join
+   * @param options The partitioning and spilling options
+   */
+  grace_hash_join(std::vector<size_type> left_on,
+                  std::vector<size_type> right_on,
+                  join_kind kind,
+                  grace_hash_join_options const& options = {});
+
+  /**
+   * @brief Partitions a chunk of the left table and spills its partitions.
+   *
+   * @throw cudf::logic_error if called after `next()`.
+   * @throw cudf::logic_error if `left` has different column types than the previous chunks.
+   *
+   * @param left A chunk of the left table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void append_left(cudf::table_view const& left,
+                   rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Partitions a chunk of the right table and spills its partitions.
+   *
+   * @throw cudf::logic_error if called after `next()`.
+   * @throw cudf::logic_error if `right` has different column types than the previous chunks.
+   *
+   * @param right A chunk of the right table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void append_right(cudf::table_view const& right,
+                    rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Joins the next pair of partitions.
+   *
+   * The columns of the result are the columns of the left table followed by the columns of the
+   * right table. Rows of a left or full join without a match have nulls in the columns of the other
+   * table.
+   *
+   * @throw cudf::logic_error if no chunk of either table was appended.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return The joined rows of the next partition pair, or nullptr once all were joined
+   */
+  std::unique_ptr<cudf::table> next(
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  std::unique_ptr<detail::grace_hash_join_impl> _impl;
+};
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true.
@@ -141,6 +141,7 @@
  *   @defgroup io_datasources Datasources
  *   @defgroup io_readers Readers
  *   @defgroup io_writers Writers
+ *   @defgroup io_memory Host Memory
  * @}
  * @defgroup lists_apis Lists
  * @{
@@ -36,6 +36,15 @@ function(get_RDKafka)
     INSTALL_EXPORT_SET cudf_kafka-exports
   )
 
+  # The tests set up a mock cluster through the C API, which librdkafka++ does not expose
+  if(BUILD_TESTS)
+    find_library(
+      RDKAFKA_C_LIBRARY
+      NAMES rdkafka REQUIRED
+      PATH_SUFFIXES lib build/src
+    )
+  endif()
+
 endfunction()
 
 get_RDKafka()
@@ -18,20 +18,46 @@
 #include "kafka_callback.hpp"
 
 #include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+/**
+ * @brief Range of messages to consume from a topic partition
+ */
+struct partition_range {
+  std::string topic;     ///< Name of the Kafka topic
+  int partition;         ///< Partition index, between `0` and `TOPIC_NUM_PARTITIONS - 1` inclusive
+  int64_t start_offset;  ///< Offset of the first message to consume
+  int64_t end_offset;    ///< Offset following the last message to consume
+};
+
+/**
+ * @brief Bounds and format of the batches of a batched Kafka consumer
+ */
+struct batch_options {
+  std::size_t max_bytes = 64 * 1024 * 1024;  ///< Maximum size of a batch, delimiters included
+  int timeout           = 1000;              ///< Maximum milliseconds spent filling a batch
+  std::string delimiter = "\n";              ///< Delimiter appended to each message payload
+};
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
@@ -92,6 +118,29 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that consumes several topic partitions in parallel,
+   * one batch of messages at a time.
+   *
+   * Each partition is polled by its own thread, which appends the message payloads directly into a
+   * pinned host buffer allocated from `cudf::io::get_host_memory_resource()`. The datasource holds
+   * the current batch, so readers get it with a single host-to-device copy. The constructor
+   * consumes the first batch and `consume_batch` the following ones.
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`.
+   * @param partitions topic partitions to consume from, with their offset ranges
+   * @param options bounds of the batches and delimiter to insert between kafka messages
+   */
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 python_callable_type python_callable,
+                 kafka_oauth_callback_wrapper_type callable_wrapper,
+                 std::vector<partition_range> const& partitions,
+                 batch_options const& options);
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -120,6 +169,95 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
 
+  /**
+   * @brief Whether or not this source supports reading directly into device memory
+   *
+   * @return true in the batched mode, where the batch is in pinned memory
+   */
+  [[nodiscard]] bool supports_device_read() const override;
+
+  /**
+   * @brief Whether a device read is preferred; always true when device reads are supported
+   *
+   * @param size Number of bytes to read
+   * @return true in the batched mode
+   */
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override;
+
+  /**
+   * @brief Returns a device buffer with a subset of data from the current batch
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The data buffer in the device memory
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> device_read(size_t offset,
+                                                            size_t size,
+                                                            rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Reads a selected range of the current batch into a preallocated device buffer
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Asynchronously reads a selected range of the current batch into a preallocated device
+   * buffer
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read as a future value (can be smaller than size)
+   */
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Replaces the current batch with the next messages of the consumed partitions
+   *
+   * The batch ends when it reaches `batch_options::max_bytes`, when `batch_options::timeout`
+   * elapses, or when every partition has reached its end offset or has no more messages. Buffers
+   * returned by `host_read` are invalidated.
+   *
+   * @throws cudf::logic_error if the consumer was not created in the batched mode, or if a message
+   * does not fit in an empty batch
+   *
+   * @return true if the batch contains messages, false otherwise
+   */
+  bool consume_batch();
+
+  /**
+   * @brief Returns the metadata of the messages of the current batch, in the order of their
+   * payloads
+   *
+   * The table has the columns `partition` (INT32), Kafka `offset` (INT64), `position` of the
+   * payload in the datasource (INT64), payload `size` (INT32) and `key` (STRING, empty for
+   * messages without a key).
+   *
+   * @param stream CUDA stream used for device memory operations
+   * @param mr Device memory resource used to allocate the returned table
+   * @return The metadata table
+   */
+  std::unique_ptr<cudf::table> batch_metadata(
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -192,7 +330,7 @@ class kafka_consumer : public cudf::io::datasource {
    */
   void unsubscribe();
 
-  virtual ~kafka_consumer(){};
+  ~kafka_consumer() override;
 
  private:
   std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
@@ -212,6 +350,21 @@ class kafka_consumer : public cudf::io::datasource {
 
   std::string buffer;
 
+  // batched mode
+  struct partition_consumer;
+  struct batch_message {
+    int32_t partition;
+    int64_t offset;
+    std::size_t position;  // position of the payload in the batch
+    std::size_t size;
+    std::string key;
+  };
+  std::vector<std::unique_ptr<partition_consumer>> partition_consumers;
+  batch_options batch_opts;
+  uint8_t* batch         = nullptr;  // pinned buffer of `batch_opts.max_bytes` bytes
+  std::size_t batch_size = 0;
+  std::vector<batch_message> batch_messages;
+
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
                                                                 int partition,
@@ -223,6 +376,20 @@ class kafka_consumer : public cudf::io::datasource {
   int64_t now();
 
   void consume_to_buffer();
+
+  /**
+   * @brief Appends the messages of one partition to the current batch, until the batch is full,
+   * the deadline passes, or the partition has no more messages
+   */
+  void fill_batch(partition_consumer& part,
+                  std::chrono::steady_clock::time_point deadline,
+                  std::atomic<std::size_t>& batch_end,
+                  std::atomic<bool>& batch_full);
+
+  /**
+   * @brief Returns the data of the current batch, or of the buffer if not in the batched mode
+   */
+  [[nodiscard]] uint8_t const* data() const;
 };
 
 }  // namespace kafka
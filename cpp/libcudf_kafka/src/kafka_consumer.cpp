@@ -15,9 +15,20 @@
  */
 #include <cudf_kafka/kafka_consumer.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <future>
+#include <iterator>
 #include <memory>
 
 namespace cudf {
@@ -107,22 +118,132 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
   consume_to_buffer();
 }
 
+/**
+ * @brief A topic partition consumed from its own queue in the batched mode
+ */
+struct kafka_consumer::partition_consumer {
+  partition_range range;
+  int64_t next_offset;
+  std::unique_ptr<RdKafka::Queue> queue;
+  // consumed message that did not fit in the previous batch
+  std::unique_ptr<RdKafka::Message> pending;
+  // messages appended to the current batch
+  std::vector<batch_message> messages;
+};
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               python_callable_type python_callable,
+                               kafka_oauth_callback_wrapper_type callable_wrapper,
+                               std::vector<partition_range> const& partitions,
+                               batch_options const& options)
+  : kafka_consumer(configs, python_callable, callable_wrapper)
+{
+  CUDF_EXPECTS(not partitions.empty(), "At least one Kafka topic partition must be consumed");
+  batch_opts = options;
+  batch = static_cast<uint8_t*>(cudf::io::get_host_memory_resource()->allocate(options.max_bytes));
+
+  std::vector<RdKafka::TopicPartition*> topic_partitions;
+  for (auto const& range : partitions) {
+    topic_partitions.push_back(
+      RdKafka::TopicPartition::create(range.topic, range.partition, range.start_offset));
+  }
+  auto const err = consumer->assign(topic_partitions);
+  for (std::size_t i = 0; err == RdKafka::ERR_NO_ERROR and i < partitions.size(); ++i) {
+    auto part = std::make_unique<partition_consumer>();
+    part->range       = partitions[i];
+    part->next_offset = partitions[i].start_offset;
+    part->queue.reset(consumer->get_partition_queue(topic_partitions[i]));
+    // stop forwarding the messages to the consumer queue, so each partition is polled on its own
+    if (part->queue != nullptr) { part->queue->forward(nullptr); }
+    partition_consumers.push_back(std::move(part));
+  }
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  CUDF_EXPECTS(err == RdKafka::ERR_NO_ERROR, "Failed to assign the Kafka topic partitions");
+  for (auto const& part : partition_consumers) {
+    CUDF_EXPECTS(part->queue != nullptr, "Failed to get the Kafka topic partition queues");
+  }
+
+  // Fill the first batch so the datasource->size() invocation will return a valid size.
+  consume_batch();
+}
+
+kafka_consumer::~kafka_consumer()
+{
+  // the partition queues must be released before the consumer
+  partition_consumers.clear();
+  if (batch != nullptr) {
+    cudf::io::get_host_memory_resource()->deallocate(batch, batch_opts.max_bytes);
+  }
+}
+
+uint8_t const* kafka_consumer::data() const
+{
+  return partition_consumers.empty() ? reinterpret_cast<uint8_t const*>(buffer.data()) : batch;
+}
+
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  if (offset > this->size()) { return 0; }
+  size = std::min(size, this->size() - offset);
+  return std::make_unique<non_owning_buffer>(data() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  if (offset > this->size()) { return 0; }
+  auto const read_size = std::min(size, this->size() - offset);
+  memcpy(dst, data() + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+size_t kafka_consumer::size() const
+{
+  return partition_consumers.empty() ? buffer.size() : batch_size;
+}
+
+bool kafka_consumer::supports_device_read() const { return not partition_consumers.empty(); }
+
+bool kafka_consumer::is_device_read_preferred(size_t size) const { return supports_device_read(); }
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  auto const max_size = this->size() - std::min(offset, this->size());
+  rmm::device_buffer out_data(std::min(size, max_size), stream);
+  auto const read_size =
+    device_read(offset, out_data.size(), reinterpret_cast<uint8_t*>(out_data.data()), stream);
+  out_data.resize(read_size, stream);
+  return datasource::buffer::create(std::move(out_data));
+}
+
+size_t kafka_consumer::device_read(size_t offset,
+                                   size_t size,
+                                   uint8_t* dst,
+                                   rmm::cuda_stream_view stream)
+{
+  return device_read_async(offset, size, dst, stream).get();
+}
+
+std::future<size_t> kafka_consumer::device_read_async(size_t offset,
+                                                      size_t size,
+                                                      uint8_t* dst,
+                                                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(supports_device_read(), "Device reads require the batched Kafka consumer mode");
+  std::promise<size_t> read;
+  if (offset > this->size()) {
+    read.set_value(0);
+    return read.get_future();
+  }
+  auto const read_size = std::min(size, this->size() - offset);
+  // a single copy from the pinned batch
+  CUDF_CUDA_TRY(
+    cudaMemcpyAsync(dst, batch + offset, read_size, cudaMemcpyHostToDevice, stream.value()));
+  return std::async(std::launch::deferred, [read_size, stream] {
+    stream.synchronize();
+    return read_size;
+  });
+}
 
 /**
  * Change the TOPPAR assignment for this consumer instance
@@ -147,7 +268,7 @@ void kafka_consumer::consume_to_buffer()
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
+      buffer.append(static_cast<char*>(msg->payload()), msg->len());
       buffer.append(delimiter);
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
@@ -157,6 +278,144 @@ void kafka_consumer::consume_to_buffer()
   }
 }
 
+bool kafka_consumer::consume_batch()
+{
+  CUDF_EXPECTS(not partition_consumers.empty(), "consume_batch requires the batched Kafka mode");
+
+  auto const deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_opts.timeout);
+  std::atomic<std::size_t> batch_end{0};
+  std::atomic<bool> batch_full{false};
+
+  std::vector<std::future<void>> tasks;
+  for (auto& part : partition_consumers) {
+    tasks.push_back(std::async(std::launch::async, [&, part = part.get()] {
+      fill_batch(*part, deadline, batch_end, batch_full);
+    }));
+  }
+  // wait for all partitions before rethrowing, they reference the batch state
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+  batch_size = batch_end;
+
+  // order the messages as their payloads
+  batch_messages.clear();
+  for (auto& part : partition_consumers) {
+    std::move(part->messages.begin(), part->messages.end(), std::back_inserter(batch_messages));
+    part->messages.clear();
+  }
+  std::sort(batch_messages.begin(), batch_messages.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.position < rhs.position;
+  });
+  return batch_size != 0;
+}
+
+void kafka_consumer::fill_batch(partition_consumer& part,
+                                std::chrono::steady_clock::time_point deadline,
+                                std::atomic<std::size_t>& batch_end,
+                                std::atomic<bool>& batch_full)
+{
+  auto const& delimiter = batch_opts.delimiter;
+  while (part.next_offset < part.range.end_offset and not batch_full) {
+    auto msg = std::move(part.pending);
+    if (msg == nullptr) {
+      auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+      if (remaining.count() <= 0) { return; }
+      msg.reset(part.queue->consume(remaining.count()));
+    }
+    if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF or
+        msg->err() == RdKafka::ErrorCode::ERR__TIMED_OUT) {
+      // no more messages for this batch
+      return;
+    }
+    CUDF_EXPECTS(msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR,
+                 "Failed to consume from Kafka: " + msg->errstr());
+    if (msg->offset() >= part.range.end_offset) {
+      part.next_offset = part.range.end_offset;
+      return;
+    }
+
+    // reserve room for the payload and the delimiter
+    auto const size = msg->len() + delimiter.size();
+    auto position   = batch_end.load();
+    do {
+      if (position + size > batch_opts.max_bytes) {
+        CUDF_EXPECTS(position != 0, "Kafka message is larger than the maximum batch size");
+        part.pending = std::move(msg);
+        batch_full   = true;
+        return;
+      }
+    } while (not batch_end.compare_exchange_weak(position, position + size));
+
+    std::memcpy(batch + position, msg->payload(), msg->len());
+    std::memcpy(batch + position + msg->len(), delimiter.data(), delimiter.size());
+    auto const key = static_cast<char const*>(static_cast<void const*>(msg->key_pointer()));
+    part.messages.push_back({part.range.partition,
+                             msg->offset(),
+                             position,
+                             msg->len(),
+                             key == nullptr ? std::string{} : std::string{key, msg->key_len()}});
+    part.next_offset = msg->offset() + 1;
+  }
+}
+
+std::unique_ptr<cudf::table> kafka_consumer::batch_metadata(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  auto const num_rows = static_cast<cudf::size_type>(batch_messages.size());
+  std::vector<int32_t> partitions(num_rows);
+  std::vector<int64_t> offsets(num_rows);
+  std::vector<int64_t> positions(num_rows);
+  std::vector<int32_t> sizes(num_rows);
+  std::vector<cudf::size_type> key_offsets(num_rows + 1, 0);
+  std::string key_chars;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    auto const& message = batch_messages[i];
+    partitions[i]       = message.partition;
+    offsets[i]          = message.offset;
+    positions[i]        = message.position;
+    sizes[i]            = message.size;
+    key_chars += message.key;
+    key_offsets[i + 1] = key_chars.size();
+  }
+
+  auto const copy_to_device = [&](void* dst, auto const& values) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst,
+                                  values.data(),
+                                  values.size() * sizeof(values[0]),
+                                  cudaMemcpyHostToDevice,
+                                  stream.value()));
+  };
+  auto const make_column = [&](cudf::type_id type, auto const& values) {
+    auto column = cudf::make_numeric_column(
+      cudf::data_type{type}, num_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+    copy_to_device(column->mutable_view().head(), values);
+    return column;
+  };
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_column(cudf::type_id::INT32, partitions));
+  columns.push_back(make_column(cudf::type_id::INT64, offsets));
+  columns.push_back(make_column(cudf::type_id::INT64, positions));
+  columns.push_back(make_column(cudf::type_id::INT32, sizes));
+
+  rmm::device_uvector<cudf::size_type> d_key_offsets(key_offsets.size(), stream, mr);
+  rmm::device_uvector<char> d_key_chars(key_chars.size(), stream, mr);
+  copy_to_device(d_key_offsets.data(), key_offsets);
+  copy_to_device(d_key_chars.data(), key_chars);
+  columns.push_back(
+    cudf::make_strings_column(num_rows, std::move(d_key_offsets), std::move(d_key_chars)));
+
+  // the host vectors are released on return
+  stream.synchronize();
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 std::map<std::string, std::string> kafka_consumer::current_configs()
 {
   std::map<std::string, std::string> configs;
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_kafka/kafka_consumer.hpp>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <librdkafka/rdkafka_mock.h>
+#include <librdkafka/rdkafkacpp.h>
+
+namespace kafka = cudf::io::external::kafka;
+
+struct KafkaBatchedConsumerTest : public ::testing::Test {
+};
+
+namespace {
+
+/**
+ * @brief An in-process librdkafka mock cluster with a single broker
+ */
+class mock_cluster {
+ public:
+  mock_cluster()
+  {
+    char errstr[512];
+    auto conf = rd_kafka_conf_new();
+    handle    = rd_kafka_new(RD_KAFKA_PRODUCER, conf, errstr, sizeof(errstr));
+    if (handle == nullptr) { rd_kafka_conf_destroy(conf); }
+    CUDF_EXPECTS(handle != nullptr, errstr);
+    cluster = rd_kafka_mock_cluster_new(handle, 1);
+    CUDF_EXPECTS(cluster != nullptr, "Failed to create the Kafka mock cluster");
+  }
+
+  ~mock_cluster()
+  {
+    rd_kafka_mock_cluster_destroy(cluster);
+    rd_kafka_destroy(handle);
+  }
+
+  void create_topic(std::string const& topic, int num_partitions)
+  {
+    CUDF_EXPECTS(rd_kafka_mock_topic_create(cluster, topic.c_str(), num_partitions, 1) ==
+                   RD_KAFKA_RESP_ERR_NO_ERROR,
+                 "Failed to create the Kafka mock topic");
+  }
+
+  [[nodiscard]] std::string bootstrap_servers() const
+  {
+    return rd_kafka_mock_cluster_bootstraps(cluster);
+  }
+
+ private:
+  rd_kafka_t* handle;
+  rd_kafka_mock_cluster_t* cluster;
+};
+
+/**
+ * @brief Produces `num_messages` keyed messages, round robin over the topic partitions
+ */
+void produce(std::string const& bootstrap_servers,
+             std::string const& topic,
+             int num_partitions,
+             int num_messages)
+{
+  std::string errstr;
+  std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+  conf->set("bootstrap.servers", bootstrap_servers, errstr);
+  std::unique_ptr<RdKafka::Producer> producer(RdKafka::Producer::create(conf.get(), errstr));
+  CUDF_EXPECTS(producer != nullptr, errstr);
+  for (int i = 0; i < num_messages; ++i) {
+    auto payload   = std::to_string(i) + ",message-" + std::to_string(i);
+    auto const key = "key-" + std::to_string(i);
+    CUDF_EXPECTS(producer->produce(topic,
+                                   i % num_partitions,
+                                   RdKafka::Producer::RK_MSG_COPY,
+                                   payload.data(),
+                                   payload.size(),
+                                   key.data(),
+                                   key.size(),
+                                   0,
+                                   nullptr) == RdKafka::ERR_NO_ERROR,
+                 "Failed to produce a Kafka message");
+    producer->poll(0);
+  }
+  CUDF_EXPECTS(producer->flush(10000) == RdKafka::ERR_NO_ERROR,
+               "Failed to flush the Kafka messages");
+}
+
+/**
+ * @brief Copies the strings of an unsliced strings column to host memory
+ */
+std::vector<std::string> strings_to_host(cudf::column_view const& column)
+{
+  cudf::strings_column_view const strings{column};
+  if (strings.size() == 0) { return {}; }
+  std::vector<cudf::size_type> offsets(strings.size() + 1);
+  CUDF_CUDA_TRY(cudaMemcpy(offsets.data(),
+                           strings.offsets().data<cudf::size_type>(),
+                           offsets.size() * sizeof(cudf::size_type),
+                           cudaMemcpyDefault));
+  std::string chars(offsets.back(), '\0');
+  CUDF_CUDA_TRY(
+    cudaMemcpy(chars.data(), strings.chars().data<char>(), chars.size(), cudaMemcpyDefault));
+
+  std::vector<std::string> result;
+  for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+    result.push_back(chars.substr(offsets[i], offsets[i + 1] - offsets[i]));
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_F(KafkaBatchedConsumerTest, MultiPartition)
+{
+  constexpr int num_partitions = 4;
+  constexpr int num_messages   = 20000;
+  std::string const topic      = "batched-topic";
+
+  mock_cluster cluster;
+  cluster.create_topic(topic, num_partitions);
+  produce(cluster.bootstrap_servers(), topic, num_partitions, num_messages);
+
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"]    = cluster.bootstrap_servers();
+  kafka_configs["group.id"]             = "batched-group";
+  kafka_configs["enable.partition.eof"] = "true";
+
+  std::vector<kafka::partition_range> partitions;
+  for (int partition = 0; partition < num_partitions; ++partition) {
+    partitions.push_back({topic, partition, 0, num_messages / num_partitions});
+  }
+  kafka::batch_options options;
+  // small enough to need several batches
+  options.max_bytes = 64 * 1024;
+  options.timeout   = 5000;
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  auto const start = std::chrono::steady_clock::now();
+  kafka::kafka_consumer kc(kafka_configs, python_callable, callback_wrapper, partitions, options);
+
+  std::set<int> received;
+  int num_batches = 0;
+  for (bool has_batch = kc.size() != 0; has_batch; has_batch = kc.consume_batch()) {
+    ++num_batches;
+    auto const metadata = kc.batch_metadata();
+    auto const batch    = kc.host_read(0, kc.size());
+    std::string const data{reinterpret_cast<char const*>(batch->data()), batch->size()};
+    ASSERT_LE(data.size(), options.max_bytes);
+
+    std::vector<int> ids;
+    for (std::size_t begin = 0; begin < data.size();) {
+      auto const end = data.find('\n', begin);
+      ASSERT_NE(end, std::string::npos);
+      auto const id = std::stoi(data.substr(begin, data.find(',', begin) - begin));
+      EXPECT_EQ(data.substr(begin, end - begin),
+                std::to_string(id) + ",message-" + std::to_string(id));
+      EXPECT_TRUE(received.insert(id).second);
+      ids.push_back(id);
+      begin = end + 1;
+    }
+    EXPECT_EQ(metadata->num_columns(), 5);
+    ASSERT_EQ(metadata->num_rows(), static_cast<cudf::size_type>(ids.size()));
+
+    // the keys are in the order of the payloads
+    auto const keys = strings_to_host(metadata->get_column(4).view());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+      EXPECT_EQ(keys[i], "key-" + std::to_string(ids[i]));
+    }
+  }
+  auto const elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+  EXPECT_EQ(received.size(), static_cast<std::size_t>(num_messages));
+  EXPECT_GT(num_batches, 1);
+
+  auto const messages_per_second = num_messages / elapsed.count();
+  RecordProperty("messages_per_second", std::to_string(messages_per_second));
+}
@@ -136,5 +136,30 @@ void gpu_snap(device_span<device_span<uint8_t const> const> inputs,
               device_span<compression_result> results,
               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Gets the maximum size any chunk could compress to with `gpu_gzip`.
+ *
+ * @param max_uncomp_chunk_size Size of the largest uncompressed chunk in the batch
+ * @return The maximum size of a GZIP member, including its header and trailer
+ */
+size_t gzip_max_output_chunk_size(size_t max_uncomp_chunk_size);
+
+/**
+ * @brief Interface for compressing data into GZIP members
+ *
+ * Multiple, independent chunks of data can be compressed by using separate input/output/status
+ * for each chunk. Chunks are compressed with nvCOMP DEFLATE, which must be enabled, and written
+ * with the GZIP header and trailer.
+ *
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] results List of output status structures
+ * @param[in] stream CUDA stream to use
+ */
+void gpu_gzip(device_span<device_span<uint8_t const> const> inputs,
+              device_span<device_span<uint8_t> const> outputs,
+              device_span<compression_result> results,
+              rmm::cuda_stream_view stream);
+
 }  // namespace io
 }  // namespace cudf
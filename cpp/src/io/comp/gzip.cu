@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.hpp"
+#include "nvcomp_adapter.hpp"
+
+#include <cudf/detail/utilities/integer_utils.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+namespace cudf {
+namespace io {
+namespace {
+
+constexpr int gzip_block_size = 128;
+
+// See https://tools.ietf.org/html/rfc1952
+constexpr size_t gzip_header_size   = 10;
+constexpr size_t gzip_trailer_size  = 8;
+constexpr uint32_t crc32_polynomial = 0xedb88320u;
+
+/**
+ * @brief Writes a 32-bit value in little-endian byte order
+ */
+__device__ void write_le32(uint8_t* dst, uint32_t value)
+{
+  dst[0] = value & 0xff;
+  dst[1] = (value >> 8) & 0xff;
+  dst[2] = (value >> 16) & 0xff;
+  dst[3] = (value >> 24) & 0xff;
+}
+
+/**
+ * @brief Multiplies two polynomials modulo the CRC32 polynomial, in the reflected bit order
+ */
+__device__ uint32_t crc32_multiply(uint32_t a, uint32_t b)
+{
+  uint32_t product = 0;
+  for (uint32_t m = 1u << 31; m != 0; m >>= 1) {
+    if (a & m) { product ^= b; }
+    b = (b & 1) ? crc32_polynomial ^ (b >> 1) : b >> 1;
+  }
+  return product;
+}
+
+/**
+ * @brief Computes x^(8 * num_bytes) modulo the CRC32 polynomial, in the reflected bit order
+ *
+ * Multiplying a CRC by this value shifts it past `num_bytes` zero bytes.
+ */
+__device__ uint32_t crc32_shift_operator(size_t num_bytes)
+{
+  uint32_t result = 1u << 31;  // x^0
+  uint32_t power  = 1u << 23;  // x^8, then squared at each bit of `num_bytes`
+  for (; num_bytes != 0; num_bytes >>= 1) {
+    if (num_bytes & 1) { result = crc32_multiply(power, result); }
+    power = crc32_multiply(power, power);
+  }
+  return result;
+}
+
+/**
+ * @brief Computes the CRC32 of the input with all threads of the block
+ *
+ * Each thread computes the CRC of a slice of the input without the initial and final inversions,
+ * which makes the CRC linear, and the CRCs of adjacent slices are then combined in a tree:
+ * crc(a + b) = crc(a) * x^(8 * size(b)) + crc(b).
+ */
+__device__ uint32_t block_crc32(device_span<uint8_t const> input, uint32_t const* crc_table)
+{
+  __shared__ uint32_t crcs[gzip_block_size];
+  __shared__ size_t sizes[gzip_block_size];
+
+  auto const t          = threadIdx.x;
+  auto const slice_size = util::div_rounding_up_unsafe(input.size(), size_t{gzip_block_size});
+  auto const begin      = std::min(t * slice_size, input.size());
+  auto const end        = std::min(begin + slice_size, input.size());
+  uint32_t crc          = 0;
+  for (auto i = begin; i < end; ++i) {
+    crc = crc_table[(crc ^ input[i]) & 0xff] ^ (crc >> 8);
+  }
+  crcs[t]  = crc;
+  sizes[t] = end - begin;
+  __syncthreads();
+
+  for (int stride = 1; stride < gzip_block_size; stride *= 2) {
+    if (t % (2 * stride) == 0) {
+      crcs[t] = crc32_multiply(crc32_shift_operator(sizes[t + stride]), crcs[t]) ^
+                crcs[t + stride];
+      sizes[t] += sizes[t + stride];
+    }
+    __syncthreads();
+  }
+  // The initial inversion is the CRC of a zero input shifted past the whole input
+  return ~(crc32_multiply(crc32_shift_operator(input.size()), 0xffffffffu) ^ crcs[0]);
+}
+
+/**
+ * @brief Wraps raw DEFLATE streams into GZIP members, one stream per block
+ *
+ * Copies the DEFLATE stream after the GZIP header and appends the trailer with the CRC32 and the
+ * size of the uncompressed data. Streams that failed to compress are left as-is.
+ */
+__global__ void __launch_bounds__(gzip_block_size)
+  gzip_wrap_kernel(device_span<device_span<uint8_t const> const> inputs,
+                   device_span<device_span<uint8_t> const> deflated,
+                   device_span<device_span<uint8_t> const> outputs,
+                   device_span<compression_result> results)
+{
+  __shared__ uint32_t crc_table[256];
+
+  auto const t = threadIdx.x;
+  for (auto i = t; i < 256; i += blockDim.x) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; ++k) {
+      c = (c & 1) ? crc32_polynomial ^ (c >> 1) : c >> 1;
+    }
+    crc_table[i] = c;
+  }
+  auto const status        = results[blockIdx.x].status;
+  auto const deflated_size = results[blockIdx.x].bytes_written;
+  __syncthreads();
+  if (status != compression_status::SUCCESS) { return; }
+
+  auto const src = deflated[blockIdx.x].data();
+  auto const dst = outputs[blockIdx.x].data();
+  for (size_t i = t; i < deflated_size; i += blockDim.x) {
+    dst[gzip_header_size + i] = src[i];
+  }
+
+  auto const input = inputs[blockIdx.x];
+  auto const crc   = block_crc32(input, crc_table);
+  if (t == 0) {
+    // Header without optional fields: magic, DEFLATE method, no flags, no mtime, unknown OS
+    constexpr uint8_t header[gzip_header_size] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+    for (size_t i = 0; i < gzip_header_size; ++i) {
+      dst[i] = header[i];
+    }
+
+    auto const trailer = dst + gzip_header_size + deflated_size;
+    write_le32(trailer, crc);
+    write_le32(trailer + 4, static_cast<uint32_t>(input.size()));
+
+    results[blockIdx.x].bytes_written = gzip_header_size + deflated_size + gzip_trailer_size;
+  }
+}
+
+}  // namespace
+
+size_t gzip_max_output_chunk_size(size_t max_uncomp_chunk_size)
+{
+  return nvcomp::compress_max_output_chunk_size(nvcomp::compression_type::DEFLATE,
+                                                static_cast<uint32_t>(max_uncomp_chunk_size)) +
+         gzip_header_size + gzip_trailer_size;
+}
+
+void gpu_gzip(device_span<device_span<uint8_t const> const> inputs,
+              device_span<device_span<uint8_t> const> outputs,
+              device_span<compression_result> results,
+              rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  if (num_chunks == 0) { return; }
+
+  auto const max_uncomp_chunk_size = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    inputs.begin(),
+    inputs.end(),
+    [] __device__(auto const& input) { return input.size(); },
+    size_t{0},
+    thrust::maximum<size_t>());
+
+  // nvCOMP requires aligned outputs, so the DEFLATE streams are staged in a separate buffer
+  auto const alignment =
+    size_t{1} << nvcomp::compress_output_alignment_bits(nvcomp::compression_type::DEFLATE);
+  auto const slot_size = util::round_up_unsafe(
+    nvcomp::compress_max_output_chunk_size(nvcomp::compression_type::DEFLATE,
+                                           static_cast<uint32_t>(max_uncomp_chunk_size)),
+    alignment);
+  rmm::device_buffer deflated_data(slot_size * num_chunks, stream);
+  rmm::device_uvector<device_span<uint8_t>> deflated(num_chunks, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_t>(0),
+                    thrust::make_counting_iterator(num_chunks),
+                    deflated.begin(),
+                    [base = static_cast<uint8_t*>(deflated_data.data()),
+                     slot_size] __device__(size_t i) {
+                      return device_span<uint8_t>{base + i * slot_size, slot_size};
+                    });
+
+  nvcomp::batched_compress(nvcomp::compression_type::DEFLATE, inputs, deflated, results, stream);
+
+  gzip_wrap_kernel<<<num_chunks, gzip_block_size, 0, stream.value()>>>(
+    inputs, deflated, outputs, results);
+}
+
+}  // namespace io
+}  // namespace cudf
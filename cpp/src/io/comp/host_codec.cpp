@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_codec.hpp"
+#include "io_uncomp.hpp"
+
+#include <io/utilities/host_memory.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <zlib.h>
+
+namespace cudf::io::host {
+namespace {
+
+/**
+ * @brief DEFLATE host compressor; `window_bits` selects the raw or the GZIP stream format
+ */
+compression_result compress_deflate(host_span<uint8_t const> src,
+                                    host_span<uint8_t> dst,
+                                    int window_bits)
+{
+  z_stream strm{};
+  CUDF_EXPECTS(deflateInit2(&strm,
+                            Z_DEFAULT_COMPRESSION,
+                            Z_DEFLATED,
+                            window_bits,
+                            8,
+                            Z_DEFAULT_STRATEGY) == Z_OK,
+               "Failed to initialize the DEFLATE compressor");
+  strm.next_in   = const_cast<Bytef*>(src.data());
+  strm.avail_in  = static_cast<uInt>(src.size());
+  strm.next_out  = dst.data();
+  strm.avail_out = static_cast<uInt>(dst.size());
+
+  auto const status        = deflate(&strm, Z_FINISH);
+  auto const bytes_written = strm.total_out;
+  deflateEnd(&strm);
+  // Anything short of the end of the stream means that the output is too small
+  if (status != Z_STREAM_END) { return {0, compression_status::OUTPUT_OVERFLOW}; }
+  return {bytes_written, compression_status::SUCCESS};
+}
+
+/**
+ * @brief LZ4 host compressor (block format, without frame headers)
+ *
+ * Greedy single-probe matcher; trades compression ratio for speed, like the LZ4 default level.
+ */
+compression_result compress_lz4(host_span<uint8_t const> src, host_span<uint8_t> dst)
+{
+  // See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+  constexpr int hash_bits        = 12;
+  constexpr size_t min_match     = 4;
+  constexpr size_t last_literals = 5;   // The last five bytes are always literals
+  constexpr size_t match_limit   = 12;  // No match may start within the last twelve bytes
+  constexpr size_t max_offset    = 65535;
+
+  auto const read32 = [&](size_t pos) {
+    uint32_t value;
+    std::memcpy(&value, src.data() + pos, sizeof(value));
+    return value;
+  };
+  auto const hash = [](uint32_t value) { return (value * 2654435761u) >> (32 - hash_bits); };
+
+  size_t out_pos          = 0;
+  auto const write_length = [&](size_t length) {
+    for (; length >= 255; length -= 255) {
+      dst[out_pos++] = 255;
+    }
+    dst[out_pos++] = length;
+  };
+  // Writes the literals in [anchor, pos), followed by a match unless `match_length` is zero
+  auto const write_sequence = [&](size_t anchor, size_t pos, size_t offset, size_t match_length) {
+    auto const literal_length = pos - anchor;
+    auto const max_size =
+      1 + literal_length / 255 + 1 + literal_length + 2 + match_length / 255 + 1;
+    if (max_size > dst.size() - out_pos) { return false; }
+
+    auto& token = dst[out_pos++];
+    token       = std::min<size_t>(literal_length, 15) << 4;
+    if (literal_length >= 15) { write_length(literal_length - 15); }
+    std::memcpy(dst.data() + out_pos, src.data() + anchor, literal_length);
+    out_pos += literal_length;
+    if (match_length != 0) {
+      dst[out_pos++] = offset & 0xff;
+      dst[out_pos++] = offset >> 8;
+      token |= std::min<size_t>(match_length - min_match, 15);
+      if (match_length - min_match >= 15) { write_length(match_length - min_match - 15); }
+    }
+    return true;
+  };
+
+  // Positions are stored off by one, so that zero marks an empty entry
+  std::vector<size_t> table(size_t{1} << hash_bits, 0);
+  size_t anchor = 0;
+  for (size_t pos = 0; pos + match_limit < src.size();) {
+    auto const value     = read32(pos);
+    auto& entry          = table[hash(value)];
+    auto const candidate = entry;
+    entry                = pos + 1;
+    if (candidate == 0 or pos - (candidate - 1) > max_offset or read32(candidate - 1) != value) {
+      ++pos;
+      continue;
+    }
+
+    auto const match     = candidate - 1;
+    auto const match_end = src.size() - last_literals;
+    auto length          = min_match;
+    while (pos + length < match_end and src[match + length] == src[pos + length]) {
+      ++length;
+    }
+    if (not write_sequence(anchor, pos, pos - match, length)) {
+      return {0, compression_status::OUTPUT_OVERFLOW};
+    }
+    pos += length;
+    anchor = pos;
+  }
+  if (not write_sequence(anchor, src.size(), 0, 0)) {
+    return {0, compression_status::OUTPUT_OVERFLOW};
+  }
+  return {out_pos, compression_status::SUCCESS};
+}
+
+compression_result compress(compression_type compression,
+                            host_span<uint8_t const> src,
+                            host_span<uint8_t> dst)
+{
+  switch (compression) {
+    case compression_type::GZIP: return compress_deflate(src, dst, 16 + MAX_WBITS);
+    case compression_type::ZLIB: return compress_deflate(src, dst, -MAX_WBITS);
+    case compression_type::LZ4: return compress_lz4(src, dst);
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+/**
+ * @brief Runs a host codec on each chunk of a batch of device buffers.
+ *
+ * Inputs are copied into a single pinned buffer and the chunks are processed in parallel, each
+ * into its own slot of a pinned output buffer. Results are copied back to the device once all
+ * chunks are done.
+ *
+ * @param output_size Callable that returns the output capacity for an input/output span pair
+ * @param codec Callable that processes one chunk and returns its `compression_result`
+ */
+template <typename OutputSizeFn, typename CodecFn>
+void host_batched_codec(device_span<device_span<uint8_t const> const> inputs,
+                        device_span<device_span<uint8_t> const> outputs,
+                        device_span<compression_result> results,
+                        OutputSizeFn output_size,
+                        CodecFn codec,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  if (num_chunks == 0) { return; }
+
+  auto const h_inputs  = cudf::detail::make_std_vector_async(inputs, stream);
+  auto const h_outputs = cudf::detail::make_std_vector_sync(outputs, stream);
+
+  std::vector<size_t> input_offsets(num_chunks + 1, 0);
+  std::vector<size_t> output_offsets(num_chunks + 1, 0);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    input_offsets[i + 1]  = input_offsets[i] + h_inputs[i].size();
+    output_offsets[i + 1] = output_offsets[i] + output_size(h_inputs[i], h_outputs[i]);
+  }
+  auto h_input_data  = detail::make_pinned_buffer<uint8_t>(input_offsets.back());
+  auto h_output_data = detail::make_pinned_buffer<uint8_t>(output_offsets.back());
+  for (size_t i = 0; i < num_chunks; ++i) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_input_data.get() + input_offsets[i],
+                                  h_inputs[i].data(),
+                                  h_inputs[i].size(),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+  }
+  stream.synchronize();
+
+  auto& pool = cudf::detail::io_thread_pool();
+  std::vector<std::future<compression_result>> tasks;
+  tasks.reserve(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto const src = host_span<uint8_t const>{h_input_data.get() + input_offsets[i],
+                                              h_inputs[i].size()};
+    auto const dst = host_span<uint8_t>{h_output_data.get() + output_offsets[i],
+                                        output_offsets[i + 1] - output_offsets[i]};
+    tasks.emplace_back(pool.submit([=, &codec]() -> compression_result {
+      try {
+        return codec(src, dst);
+      } catch (cudf::logic_error const&) {
+        return {0, compression_status::FAILURE};
+      }
+    }));
+  }
+
+  std::vector<compression_result> h_results(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    h_results[i] = tasks[i].get();
+    if (h_results[i].status != compression_status::SUCCESS) { continue; }
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_outputs[i].data(),
+                                  h_output_data.get() + output_offsets[i],
+                                  h_results[i].bytes_written,
+                                  cudaMemcpyHostToDevice,
+                                  stream.value()));
+  }
+  CUDF_CUDA_TRY(cudaMemcpyAsync(results.data(),
+                                h_results.data(),
+                                h_results.size() * sizeof(compression_result),
+                                cudaMemcpyHostToDevice,
+                                stream.value()));
+  // The pinned staging buffers must outlive the copies
+  stream.synchronize();
+}
+
+}  // namespace
+
+bool is_decompression_supported(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP:
+    case compression_type::ZLIB:
+    case compression_type::SNAPPY:
+    case compression_type::LZ4: return true;
+    default: return false;
+  }
+}
+
+bool is_compression_supported(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::GZIP:
+    case compression_type::ZLIB:
+    case compression_type::LZ4: return true;
+    default: return false;
+  }
+}
+
+size_t compress_max_output_chunk_size(compression_type compression, size_t max_uncomp_chunk_size)
+{
+  switch (compression) {
+    // compressBound accounts for the six byte ZLIB wrapper, GZIP adds up to twelve more
+    case compression_type::GZIP:
+    case compression_type::ZLIB: return compressBound(max_uncomp_chunk_size) + 12;
+    case compression_type::LZ4: return max_uncomp_chunk_size + max_uncomp_chunk_size / 255 + 16;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
+void batched_decompress(compression_type compression,
+                        device_span<device_span<uint8_t const> const> inputs,
+                        device_span<device_span<uint8_t> const> outputs,
+                        device_span<compression_result> results,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_decompression_supported(compression), "Unsupported compression type");
+  host_batched_codec(
+    inputs,
+    outputs,
+    results,
+    [](auto const&, auto const& output) { return output.size(); },
+    [=](host_span<uint8_t const> src, host_span<uint8_t> dst) {
+      return compression_result{decompress(compression, src, dst, stream),
+                                compression_status::SUCCESS};
+    },
+    stream);
+}
+
+void batched_compress(compression_type compression,
+                      device_span<device_span<uint8_t const> const> inputs,
+                      device_span<device_span<uint8_t> const> outputs,
+                      device_span<compression_result> results,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_compression_supported(compression), "Unsupported compression type");
+  host_batched_codec(
+    inputs,
+    outputs,
+    results,
+    [=](auto const& input, auto const& output) {
+      return output.empty() ? compress_max_output_chunk_size(compression, input.size())
+                            : output.size();
+    },
+    [=](host_span<uint8_t const> src, host_span<uint8_t> dst) {
+      return compress(compression, src, dst);
+    },
+    stream);
+}
+
+}  // namespace cudf::io::host
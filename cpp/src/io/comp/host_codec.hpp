@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.hpp"
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf::io::host {
+
+/**
+ * @brief Whether the given compression type can be decompressed on the host.
+ *
+ * @param compression Compression type
+ * @returns true if `batched_decompress` supports the compression type; false otherwise
+ */
+[[nodiscard]] bool is_decompression_supported(compression_type compression);
+
+/**
+ * @brief Whether the given compression type can be compressed on the host.
+ *
+ * @param compression Compression type
+ * @returns true if `batched_compress` supports the compression type; false otherwise
+ */
+[[nodiscard]] bool is_compression_supported(compression_type compression);
+
+/**
+ * @brief Gets the maximum size any chunk could compress to on the host.
+ *
+ * @param compression Compression type
+ * @param max_uncomp_chunk_size Size of the largest uncompressed chunk in the batch
+ * @returns maximum compressed chunk size
+ */
+[[nodiscard]] size_t compress_max_output_chunk_size(compression_type compression,
+                                                    size_t max_uncomp_chunk_size);
+
+/**
+ * @brief Host batch decompression of given type.
+ *
+ * The inputs are staged in pinned host memory and decompressed in parallel by a pool of host
+ * threads; the outputs are then copied back to the device. The threads are shared with the other
+ * host I/O work, see `cudf::detail::io_thread_pool`.
+ *
+ * @param[in] compression Compression type
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] results List of output status structures
+ * @param[in] stream CUDA stream to use
+ */
+void batched_decompress(compression_type compression,
+                        device_span<device_span<uint8_t const> const> inputs,
+                        device_span<device_span<uint8_t> const> outputs,
+                        device_span<compression_result> results,
+                        rmm::cuda_stream_view stream);
+
+/**
+ * @brief Host batch compression of given type.
+ *
+ * Counterpart of `batched_decompress`. Outputs with a non-zero size are treated as bounded;
+ * outputs with zero size are assumed to fit `compress_max_output_chunk_size` bytes.
+ *
+ * @param[in] compression Compression type
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] results List of output status structures
+ * @param[in] stream CUDA stream to use
+ */
+void batched_compress(compression_type compression,
+                      device_span<device_span<uint8_t const> const> inputs,
+                      device_span<device_span<uint8_t> const> outputs,
+                      device_span<compression_result> results,
+                      rmm::cuda_stream_view stream);
+
+}  // namespace cudf::io::host
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "gpuinflate.hpp"
+
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/span.hpp>
 
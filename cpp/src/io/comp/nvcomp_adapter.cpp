@@ -19,6 +19,7 @@
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/config_utils.hpp>
 
+#include <nvcomp/lz4.h>
 #include <nvcomp/snappy.h>
 
 #define NVCOMP_DEFLATE_HEADER <nvcomp/deflate.h>
@@ -74,6 +75,8 @@ nvcompStatus_t batched_decompress_get_temp_size_ex(compression_type compression,
   switch (compression) {
     case compression_type::SNAPPY:
       return nvcompBatchedSnappyDecompressGetTempSizeEx(std::forward<Args>(args)...);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressGetTempSizeEx(std::forward<Args>(args)...);
     case compression_type::ZSTD:
 #if NVCOMP_HAS_ZSTD_DECOMP
       return nvcompBatchedZstdDecompressGetTempSizeEx(std::forward<Args>(args)...);
@@ -94,6 +97,8 @@ auto batched_decompress_get_temp_size(compression_type compression, Args&&... ar
   switch (compression) {
     case compression_type::SNAPPY:
       return nvcompBatchedSnappyDecompressGetTempSize(std::forward<Args>(args)...);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressGetTempSize(std::forward<Args>(args)...);
     case compression_type::ZSTD:
 #if NVCOMP_HAS_ZSTD_DECOMP
       return nvcompBatchedZstdDecompressGetTempSize(std::forward<Args>(args)...);
@@ -117,6 +122,8 @@ auto batched_decompress_async(compression_type compression, Args&&... args)
   switch (compression) {
     case compression_type::SNAPPY:
       return nvcompBatchedSnappyDecompressAsync(std::forward<Args>(args)...);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressAsync(std::forward<Args>(args)...);
     case compression_type::ZSTD:
 #if NVCOMP_HAS_ZSTD_DECOMP
       return nvcompBatchedZstdDecompressAsync(std::forward<Args>(args)...);
@@ -214,6 +221,10 @@ auto batched_compress_temp_size(compression_type compression,
       nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
         batch_size, max_uncompressed_chunk_bytes, nvcompBatchedSnappyDefaultOpts, &temp_size);
       break;
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressGetTempSize(
+        batch_size, max_uncompressed_chunk_bytes, nvcompBatchedLZ4DefaultOpts, &temp_size);
+      break;
     case compression_type::DEFLATE:
 #if NVCOMP_HAS_DEFLATE
       nvcomp_status = nvcompBatchedDeflateCompressGetTempSize(
@@ -252,6 +263,10 @@ size_t compress_max_output_chunk_size(compression_type compression,
       status = nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
         capped_uncomp_bytes, nvcompBatchedSnappyDefaultOpts, &max_comp_chunk_size);
       break;
+    case compression_type::LZ4:
+      status = nvcompBatchedLZ4CompressGetMaxOutputChunkSize(
+        capped_uncomp_bytes, nvcompBatchedLZ4DefaultOpts, &max_comp_chunk_size);
+      break;
     case compression_type::DEFLATE:
 #if NVCOMP_HAS_DEFLATE
       status = nvcompBatchedDeflateCompressGetMaxOutputChunkSize(
@@ -302,6 +317,18 @@ static void batched_compress_async(compression_type compression,
                                                        nvcompBatchedSnappyDefaultOpts,
                                                        stream.value());
       break;
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressAsync(device_uncompressed_ptrs,
+                                                    device_uncompressed_bytes,
+                                                    max_uncompressed_chunk_bytes,
+                                                    batch_size,
+                                                    device_temp_ptr,
+                                                    temp_bytes,
+                                                    device_compressed_ptrs,
+                                                    device_compressed_bytes,
+                                                    nvcompBatchedLZ4DefaultOpts,
+                                                    stream.value());
+      break;
     case compression_type::DEFLATE:
 #if NVCOMP_HAS_DEFLATE
       nvcomp_status = nvcompBatchedDeflateCompressAsync(device_uncompressed_ptrs,
@@ -383,6 +410,7 @@ bool is_compression_enabled(compression_type compression)
     case compression_type::DEFLATE:
       return NVCOMP_HAS_DEFLATE and detail::nvcomp_integration::is_all_enabled();
     case compression_type::SNAPPY: return detail::nvcomp_integration::is_stable_enabled();
+    case compression_type::LZ4: return detail::nvcomp_integration::is_stable_enabled();
     case compression_type::ZSTD:
       return NVCOMP_HAS_ZSTD_COMP and detail::nvcomp_integration::is_all_enabled();
     default: return false;
@@ -396,6 +424,7 @@ size_t compress_input_alignment_bits(compression_type compression)
     case compression_type::DEFLATE: return 0;
     case compression_type::SNAPPY: return 0;
     case compression_type::ZSTD: return 2;
+    case compression_type::LZ4: return 2;
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
@@ -406,6 +435,7 @@ size_t compress_output_alignment_bits(compression_type compression)
     case compression_type::DEFLATE: return 3;
     case compression_type::SNAPPY: return 0;
     case compression_type::ZSTD: return 0;
+    case compression_type::LZ4: return 2;
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
@@ -415,6 +445,7 @@ std::optional<size_t> compress_max_allowed_chunk_size(compression_type compressi
   switch (compression) {
     case compression_type::DEFLATE: return 64 * 1024;
     case compression_type::SNAPPY: return std::nullopt;
+    case compression_type::LZ4: return 16 * 1024 * 1024;
     case compression_type::ZSTD:
 #if NVCOMP_HAS_ZSTD_COMP
       return nvcompZstdCompressionMaxAllowedChunkSize;
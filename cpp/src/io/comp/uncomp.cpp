@@ -501,6 +501,54 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
   return uncompressed_size;
 }
 
+/**
+ * @brief LZ4 host decompressor (block format, without frame headers)
+ */
+size_t decompress_lz4(host_span<uint8_t const> src, host_span<uint8_t> dst)
+{
+  auto cur       = src.begin();
+  auto const end = src.end();
+  size_t dst_pos = 0;
+
+  // Lengths of 15 continue in the following bytes, for as long as these are 255
+  auto const read_length = [&](size_t length) {
+    if (length == 15) {
+      uint8_t extra;
+      do {
+        CUDF_EXPECTS(cur < end, "LZ4 decompression failed");
+        extra = *cur++;
+        length += extra;
+      } while (extra == 255);
+    }
+    return length;
+  };
+
+  while (cur < end) {
+    auto const token          = *cur++;
+    auto const literal_length = read_length(token >> 4);
+    CUDF_EXPECTS(literal_length <= static_cast<size_t>(end - cur) and
+                   literal_length <= dst.size() - dst_pos,
+                 "LZ4 decompression failed");
+    memcpy(dst.data() + dst_pos, cur, literal_length);
+    cur += literal_length;
+    dst_pos += literal_length;
+    // The last sequence consists of literals only
+    if (cur == end) { break; }
+
+    CUDF_EXPECTS(end - cur >= 2, "LZ4 decompression failed");
+    size_t const offset = cur[0] | (cur[1] << 8);
+    cur += 2;
+    auto const match_length = read_length(token & 0xf) + 4;
+    CUDF_EXPECTS(offset != 0 and offset <= dst_pos and match_length <= dst.size() - dst_pos,
+                 "LZ4 decompression failed");
+    // Byte by byte, since the match may overlap with its own output
+    for (size_t i = 0; i < match_length; ++i, ++dst_pos) {
+      dst[dst_pos] = dst[dst_pos - offset];
+    }
+  }
+  return dst_pos;
+}
+
 /**
  * @brief ZSTD decompressor that uses nvcomp
  */
@@ -551,6 +599,7 @@ size_t decompress(compression_type compression,
     case compression_type::GZIP: return decompress_gzip(src, dst);
     case compression_type::ZLIB: return decompress_zlib(src, dst);
     case compression_type::SNAPPY: return decompress_snappy(src, dst);
+    case compression_type::LZ4: return decompress_lz4(src, dst);
     case compression_type::ZSTD: return decompress_zstd(src, dst, stream);
     default: CUDF_FAIL("Unsupported compression type");
   }
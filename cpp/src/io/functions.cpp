@@ -29,10 +29,13 @@
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <io/orc/orc.hpp>
+#include <io/parquet/compact_protocol_reader.hpp>
+#include <io/parquet/footer.hpp>
 
 namespace cudf {
 namespace io {
@@ -80,6 +83,13 @@ json_reader_options_builder json_reader_options::builder(source_info const& src)
   return json_reader_options_builder(src);
 }
 
+// Returns builder for json_writer_options
+json_writer_options_builder json_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return json_writer_options_builder{sink, table};
+}
+
 // Returns builder for parquet_reader_options
 parquet_reader_options_builder parquet_reader_options::builder(source_info const& src)
 {
@@ -194,13 +204,34 @@ table_with_metadata read_json(json_reader_options options, rmm::mr::device_memor
 
   options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
 
-  auto datasources = make_datasources(options.get_source(),
-                                      options.get_byte_range_offset(),
-                                      options.get_byte_range_size_with_padding());
+  // The nested reader applies the byte range to the concatenated sources and may read past the
+  // padded range to find the end of the last record, so the sources cover the whole input
+  auto datasources = options.is_enabled_experimental()
+                       ? make_datasources(options.get_source())
+                       : make_datasources(options.get_source(),
+                                          options.get_byte_range_offset(),
+                                          options.get_byte_range_size_with_padding());
 
   return detail::json::read_json(datasources, options, cudf::default_stream_value, mr);
 }
 
+void write_json(json_writer_options const& options, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto sinks = make_datasinks(options.get_sink());
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for JSON writing");
+
+  detail::json::write_json(  //
+    sinks[0].get(),
+    options.get_table(),
+    options,
+    cudf::default_stream_value,
+    mr);
+  // Flushes before the sink is destroyed, so that write errors are thrown
+  sinks[0]->flush();
+}
+
 table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -228,13 +259,15 @@ void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resourc
   auto sinks = make_datasinks(options.get_sink());
   CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for CSV writing");
 
-  return csv::write_csv(  //
+  csv::write_csv(  //
     sinks[0].get(),
     options.get_table(),
     options.get_metadata(),
     options,
     cudf::default_stream_value,
     mr);
+  // Flushes before the sink is destroyed, so that write errors are thrown
+  sinks[0]->flush();
 }
 
 namespace detail_orc = cudf::io::detail::orc;
@@ -351,6 +384,59 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader(std::size_t, std::size_t,
+ * orc_reader_options const&, rmm::mr::device_memory_resource*)
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       std::size_t pass_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(chunk_read_limit,
+                                                        pass_read_limit,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        cudf::default_stream_value,
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader(std::size_t,
+ * orc_reader_options const&, rmm::mr::device_memory_resource*)
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : chunked_orc_reader(chunk_read_limit, 0, options, mr)
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -421,6 +507,156 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            cudf::default_stream_value,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+namespace {
+
+/**
+ * @brief Builds the schema tree rooted at the given element of the flattened Parquet schema
+ */
+parquet_column_schema make_column_schema(
+  std::vector<cudf::io::parquet::SchemaElement> const& schema, size_t schema_idx)
+{
+  auto const& element = schema[schema_idx];
+  std::vector<parquet_column_schema> children;
+  std::transform(element.children_idx.cbegin(),
+                 element.children_idx.cend(),
+                 std::back_inserter(children),
+                 [&](auto child_idx) { return make_column_schema(schema, child_idx); });
+  return parquet_column_schema{
+    element.name, static_cast<parquet_physical_type>(element.type), std::move(children)};
+}
+
+/**
+ * @brief Converts the Thrift-derived metadata of a column chunk into the public representation
+ */
+parquet_column_chunk_metadata make_column_chunk_metadata(
+  cudf::io::parquet::ColumnChunk const& chunk)
+{
+  auto const& meta = chunk.meta_data;
+  parquet_column_chunk_metadata result{meta.path_in_schema,
+                                       static_cast<parquet_physical_type>(meta.type),
+                                       meta.num_values,
+                                       meta.total_uncompressed_size,
+                                       meta.total_compressed_size,
+                                       meta.data_page_offset,
+                                       meta.dictionary_page_offset,
+                                       std::nullopt,
+                                       std::nullopt,
+                                       std::nullopt,
+                                       chunk.column_index_offset,
+                                       chunk.column_index_length,
+                                       chunk.offset_index_offset,
+                                       chunk.offset_index_length,
+                                       meta.bloom_filter_offset,
+                                       meta.bloom_filter_length};
+
+  if (not meta.statistics_blob.empty()) {
+    cudf::io::parquet::Statistics stats;
+    cudf::io::parquet::CompactProtocolReader cp(meta.statistics_blob.data(),
+                                                meta.statistics_blob.size());
+    CUDF_EXPECTS(cp.read(&stats), "Cannot parse column chunk statistics");
+    if (stats.null_count >= 0) { result.null_count = stats.null_count; }
+    if (not stats.min_value.empty()) {
+      result.min_value = std::string(stats.min_value.begin(), stats.min_value.end());
+    }
+    if (not stats.max_value.empty()) {
+      result.max_value = std::string(stats.max_value.begin(), stats.max_value.end());
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(src_info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  auto const filepath =
+    src_info.type() == io_type::FILEPATH ? src_info.filepaths()[0] : std::string{};
+  auto const footer = cudf::io::parquet::read_footer(datasources[0].get(), filepath);
+
+  parquet_metadata result;
+  result.schema     = make_column_schema(footer->schema, 0);
+  result.num_rows   = footer->num_rows;
+  result.created_by = footer->created_by;
+  for (auto const& kv : footer->key_value_metadata) {
+    result.key_value_metadata.emplace(kv.key, kv.value);
+  }
+  std::transform(footer->row_groups.cbegin(),
+                 footer->row_groups.cend(),
+                 std::back_inserter(result.row_groups),
+                 [](auto const& row_group) {
+                   parquet_rowgroup_metadata rg{row_group.num_rows, row_group.total_byte_size, {}};
+                   std::transform(row_group.columns.cbegin(),
+                                  row_group.columns.cend(),
+                                  std::back_inserter(rg.columns),
+                                  make_column_chunk_metadata);
+                   return rg;
+                 });
+  return result;
+}
+
+/**
+ * @copydoc cudf::io::set_parquet_footer_cache_capacity
+ */
+void set_parquet_footer_cache_capacity(std::size_t num_footers)
+{
+  cudf::io::parquet::set_footer_cache_capacity(num_footers);
+}
+
+/**
+ * @copydoc cudf::io::get_parquet_footer_cache_capacity
+ */
+std::size_t get_parquet_footer_cache_capacity()
+{
+  return cudf::io::parquet::get_footer_cache_capacity();
+}
+
 /**
  * @copydoc cudf::io::merge_row_group_metadata
  */
@@ -19,27 +19,151 @@
 #include <io/comp/io_uncomp.hpp>
 #include <io/json/nested_json.hpp>
 
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace cudf::io::detail::json::experimental {
 
-std::vector<uint8_t> ingest_raw_input(host_span<std::unique_ptr<datasource>> sources,
-                                      compression_type compression)
+namespace {
+
+// Character inserted between consecutive sources; lines mode treats it as a record delimiter
+constexpr char source_delimiter = '\n';
+
+// Size of the blocks read while searching for a record boundary
+constexpr size_t boundary_search_block_size = 64 * 1024;
+
+/**
+ * @brief Returns the total size of the sources when concatenated with a delimiter between each
+ * pair of consecutive sources.
+ */
+size_t concatenated_size(host_span<std::unique_ptr<datasource>> sources)
 {
+  if (sources.empty()) { return 0; }
   auto const total_source_size =
     std::accumulate(sources.begin(), sources.end(), 0ul, [](size_t sum, auto& source) {
       return sum + source->size();
     });
-  auto buffer = std::vector<uint8_t>(total_source_size);
+  return total_source_size + sources.size() - 1;
+}
 
-  size_t bytes_read = 0;
-  for (const auto& source : sources) {
-    bytes_read += source->host_read(0, source->size(), buffer.data() + bytes_read);
+/**
+ * @brief Reads a range of the concatenation of the sources, as if the sources were a single input
+ * with a delimiter between each pair of consecutive sources.
+ *
+ * @param sources The input sources
+ * @param offset Offset of the range in the concatenated input
+ * @param size Size of the range; clamped to the end of the concatenated input
+ * @param dst Host buffer to read the range into
+ * @return The number of bytes read
+ */
+size_t read_concatenated(host_span<std::unique_ptr<datasource>> sources,
+                         size_t offset,
+                         size_t size,
+                         uint8_t* dst)
+{
+  size_t bytes_read   = 0;
+  size_t source_begin = 0;
+  for (size_t i = 0; i < sources.size() and bytes_read < size; ++i) {
+    auto const source_end = source_begin + sources[i]->size();
+    auto const position   = offset + bytes_read;
+    if (position < source_end) {
+      auto const read_size = std::min(source_end - position, size - bytes_read);
+      bytes_read += sources[i]->host_read(position - source_begin, read_size, dst + bytes_read);
+    }
+    // The delimiter follows every source except the last one
+    if (i + 1 < sources.size() and offset + bytes_read == source_end and bytes_read < size) {
+      dst[bytes_read++] = source_delimiter;
+    }
+    source_begin = source_end + 1;
   }
+  return bytes_read;
+}
 
-  return (compression == compression_type::NONE) ? buffer : decompress(compression, buffer);
+/**
+ * @brief Finds the first record that starts at or after the given position in the concatenated
+ * input.
+ *
+ * Records start at the beginning of the input and after each delimiter, so the search reads
+ * forward from `position - 1` until the first delimiter, in blocks of bounded size.
+ *
+ * @return Offset of the first record start at or after `position`, or the size of the
+ * concatenated input if no record starts there
+ */
+size_t find_record_start(host_span<std::unique_ptr<datasource>> sources,
+                         size_t total_size,
+                         size_t position)
+{
+  if (position == 0) { return 0; }
+  if (position >= total_size) { return total_size; }
+
+  std::vector<uint8_t> block(boundary_search_block_size);
+  for (auto block_offset = position - 1; block_offset < total_size; block_offset += block.size()) {
+    auto const read_size = read_concatenated(sources, block_offset, block.size(), block.data());
+    auto const block_end = block.begin() + read_size;
+    auto const delimiter = std::find(block.begin(), block_end, source_delimiter);
+    if (delimiter != block_end) { return block_offset + (delimiter - block.begin()) + 1; }
+  }
+  return total_size;
+}
+
+/**
+ * @brief Reads the records that start within the given byte range of the concatenated sources.
+ *
+ * Like `multibyte_split`, a record belongs to the range in which it starts: a partial record at
+ * the beginning of the range is skipped, and the last record is read past the end of the range
+ * until its delimiter.
+ */
+std::vector<uint8_t> ingest_byte_range(host_span<std::unique_ptr<datasource>> sources,
+                                       size_t range_offset,
+                                       size_t range_size)
+{
+  auto const total_size = concatenated_size(sources);
+  auto const range_end =
+    range_size == 0 ? total_size : std::min(total_size, range_offset + range_size);
+  if (range_offset >= range_end) { return {}; }
+
+  auto const begin = find_record_start(sources, total_size, range_offset);
+  if (begin >= range_end) { return {}; }
+  auto const end = find_record_start(sources, total_size, range_end);
+
+  auto buffer = std::vector<uint8_t>(end - begin);
+  buffer.resize(read_concatenated(sources, begin, buffer.size(), buffer.data()));
+  return buffer;
+}
+
+}  // namespace
+
+/**
+ * @brief Reads the sources into a single host buffer, with a delimiter between consecutive sources.
+ *
+ * @param sources The input sources
+ * @param compression Compression format of the sources
+ * @param range_offset Offset of the byte range to read, in the concatenated uncompressed input
+ * @param range_size Size of the byte range to read; zero to read until the end of the input
+ * @return The records that start within the byte range
+ */
+std::vector<uint8_t> ingest_raw_input(host_span<std::unique_ptr<datasource>> sources,
+                                      compression_type compression,
+                                      size_t range_offset,
+                                      size_t range_size)
+{
+  if (compression == compression_type::NONE) {
+    return ingest_byte_range(sources, range_offset, range_size);
+  }
+
+  // Compressed sources are decompressed one at a time and joined with delimiters
+  std::vector<uint8_t> buffer;
+  for (auto const& source : sources) {
+    if (not buffer.empty()) { buffer.push_back(source_delimiter); }
+    auto const compressed = source->host_read(0, source->size());
+    auto const decompressed =
+      decompress(compression, host_span<uint8_t const>{compressed->data(), compressed->size()});
+    buffer.insert(buffer.end(), decompressed.begin(), decompressed.end());
+  }
+  return buffer;
 }
 
 table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
@@ -50,10 +174,21 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
   auto const dtypes_empty =
     std::visit([](const auto& dtypes) { return dtypes.empty(); }, reader_opts.get_dtypes());
   CUDF_EXPECTS(dtypes_empty, "user specified dtypes are not yet supported");
-  CUDF_EXPECTS(reader_opts.get_byte_range_offset() == 0 and reader_opts.get_byte_range_size() == 0,
-               "specifying a byte range is not yet supported");
 
-  auto const buffer = ingest_raw_input(sources, reader_opts.get_compression());
+  auto const has_byte_range =
+    reader_opts.get_byte_range_offset() != 0 or reader_opts.get_byte_range_size() != 0;
+  CUDF_EXPECTS(reader_opts.is_enabled_lines() or (sources.size() == 1 and not has_byte_range),
+               "multiple sources and byte ranges are only supported for JSON lines");
+  CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE or not has_byte_range,
+               "byte ranges are not supported for compressed inputs");
+
+  // All sources are read into a single buffer so that they are parsed in one pass
+  auto const buffer = ingest_raw_input(sources,
+                                       reader_opts.get_compression(),
+                                       reader_opts.get_byte_range_offset(),
+                                       reader_opts.get_byte_range_size());
+  if (buffer.empty()) { return table_with_metadata{std::make_unique<table>()}; }
+
   auto data = host_span<char const>(reinterpret_cast<char const*>(buffer.data()), buffer.size());
 
   return cudf::io::json::detail::parse_nested_json(data, reader_opts, stream, mr);
@@ -0,0 +1,579 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file write_json.cu
+ * @brief cuDF-IO JSON writer implementation
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/detail/replace.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+/**
+ * @brief Functor to convert a strings column to quoted JSON strings.
+ *
+ * Quotes and backslashes are escaped with a backslash, and control characters are written as
+ * their short escape sequence, or as `\u00XX` if they have none. Other characters, including
+ * multi-byte UTF-8 characters, are written as-is.
+ */
+struct escape_strings_fn {
+  column_device_view const d_column;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void write_char(char chr, char*& d_buffer, offset_type& bytes)
+  {
+    if (d_buffer) *d_buffer++ = chr;
+    ++bytes;
+  }
+
+  __device__ void write_escaped(unsigned char chr, char*& d_buffer, offset_type& bytes)
+  {
+    constexpr char const hex_digits[] = "0123456789abcdef";
+    auto const short_escape           = [&]() -> char {
+      switch (chr) {
+        case '\"': return '\"';
+        case '\\': return '\\';
+        case '\b': return 'b';
+        case '\f': return 'f';
+        case '\n': return 'n';
+        case '\r': return 'r';
+        case '\t': return 't';
+        default: return 0;
+      }
+    }();
+    if (short_escape != 0) {
+      write_char('\\', d_buffer, bytes);
+      write_char(short_escape, d_buffer, bytes);
+    } else if (chr < 0x20) {
+      write_char('\\', d_buffer, bytes);
+      write_char('u', d_buffer, bytes);
+      write_char('0', d_buffer, bytes);
+      write_char('0', d_buffer, bytes);
+      write_char(hex_digits[chr >> 4], d_buffer, bytes);
+      write_char(hex_digits[chr & 0xf], d_buffer, bytes);
+    } else {
+      write_char(static_cast<char>(chr), d_buffer, bytes);
+    }
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    auto const d_str  = d_column.element<string_view>(idx);
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    write_char('\"', d_buffer, bytes);
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      write_escaped(static_cast<unsigned char>(d_str.data()[i]), d_buffer, bytes);
+    }
+    write_char('\"', d_buffer, bytes);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns a copy of the string, quoted and escaped as a JSON string.
+ */
+std::string escape_json_name(std::string const& name)
+{
+  constexpr char const hex_digits[] = "0123456789abcdef";
+  std::string escaped{"\""};
+  for (auto const chr : name) {
+    auto const c = static_cast<unsigned char>(chr);
+    switch (c) {
+      case '\"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\b': escaped += "\\b"; break;
+      case '\f': escaped += "\\f"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\r': escaped += "\\r"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if (c < 0x20) {
+          escaped += "\\u00";
+          escaped += hex_digits[c >> 4];
+          escaped += hex_digits[c & 0xf];
+        } else {
+          escaped += chr;
+        }
+    }
+  }
+  escaped += "\"";
+  return escaped;
+}
+
+/**
+ * @brief Functor to convert columns to strings columns of JSON values.
+ *
+ * Null rows of the input are null in the output. Nested columns are converted recursively: the
+ * children of a struct column are written as the members of a JSON object, and the elements of a
+ * list column as a JSON array.
+ */
+struct column_to_strings_fn {
+  template <typename column_type>
+  constexpr static bool is_not_handled()
+  {
+    return not((std::is_same_v<column_type, cudf::string_view>) ||
+               (std::is_integral_v<column_type>) || (std::is_floating_point_v<column_type>) ||
+               (cudf::is_fixed_point<column_type>()) || (cudf::is_timestamp<column_type>()) ||
+               (cudf::is_duration<column_type>()));
+  }
+
+  explicit column_to_strings_fn(json_writer_options const& options,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+    : options_(options),
+      stream_(stream),
+      mr_(mr),
+      narep_(options.get_na_rep(), true, stream),
+      comma_(",", true, stream),
+      empty_(""),
+      invalid_("", false)
+  {
+  }
+
+  // bools:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same_v<column_type, bool>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_booleans(column,
+                                                string_scalar("true", true, stream_),
+                                                string_scalar("false", true, stream_),
+                                                stream_,
+                                                mr_);
+  }
+
+  // strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same_v<column_type, cudf::string_view>, std::unique_ptr<column>>
+  operator()(column_view const& column_v) const
+  {
+    auto d_column = column_device_view::create(column_v, stream_);
+    escape_strings_fn fn{*d_column};
+    auto children = cudf::strings::detail::make_strings_children(fn, column_v.size(), stream_, mr_);
+
+    return make_strings_column(column_v.size(),
+                               std::move(children.first),
+                               std::move(children.second),
+                               column_v.null_count(),
+                               cudf::detail::copy_bitmask(column_v, stream_, mr_));
+  }
+
+  // ints:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_integral_v<column_type> && !std::is_same_v<column_type, bool>,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(column, stream_, mr_);
+  }
+
+  // floats:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point_v<column_type>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto result   = cudf::strings::detail::from_floats(column, stream_, mr_);
+    auto d_column = column_device_view::create(column, stream_);
+
+    // NaN and infinity have no JSON representation, they are written as nulls
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(column.size()),
+      [d_column = *d_column] __device__(size_type idx) {
+        return d_column.is_valid(idx) and isfinite(d_column.element<column_type>(idx));
+      },
+      stream_,
+      mr_);
+    result->set_null_mask(std::move(null_mask), null_count);
+    return result;
+  }
+
+  // fixed point:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_fixed_point<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_fixed_point(column, stream_, mr_);
+  }
+
+  // timestamps, written as quoted ISO 8601 strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    std::string const format = [&]() {
+      if (std::is_same_v<cudf::timestamp_s, column_type>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%SZ\""};
+      } else if (std::is_same_v<cudf::timestamp_ms, column_type>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%3fZ\""};
+      } else if (std::is_same_v<cudf::timestamp_us, column_type>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%6fZ\""};
+      } else if (std::is_same_v<cudf::timestamp_ns, column_type>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%9fZ\""};
+      } else {
+        return std::string{"\"%Y-%m-%d\""};
+      }
+    }();
+
+    return cudf::strings::detail::from_timestamps(
+      column,
+      format,
+      strings_column_view(column_view{data_type{type_id::STRING}, 0, nullptr}),
+      stream_,
+      mr_);
+  }
+
+  // durations, written as quoted strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_duration<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_durations(column, "\"%D days %H:%M:%S\"", stream_, mr_);
+  }
+
+  // unsupported type of column:
+  //
+  template <typename column_type>
+  std::enable_if_t<is_not_handled<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const&) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+
+  /**
+   * @brief Converts a column of any supported type, including nested types.
+   *
+   * @param column The column to convert
+   * @param names Names of the children of the column; missing names are replaced with the index
+   * of the child
+   */
+  std::unique_ptr<column> convert(column_view const& column,
+                                  std::vector<column_name_info> const& names) const
+  {
+    if (column.type().id() == type_id::STRUCT) {
+      auto const structs = structs_column_view{column};
+      std::vector<column_view> children;
+      for (size_type i = 0; i < structs.num_children(); ++i) {
+        children.push_back(structs.get_sliced_child(i));
+      }
+      auto result = objects_to_strings(children, names);
+      if (column.nullable()) {
+        result->set_null_mask(cudf::detail::copy_bitmask(column, stream_, mr_),
+                              column.null_count());
+      }
+      return result;
+    }
+    if (column.type().id() == type_id::LIST) {
+      return list_to_strings(lists_column_view{column}, names);
+    }
+    return cudf::type_dispatcher(column.type(), *this, column);
+  }
+
+  /**
+   * @brief Converts a set of columns to JSON objects, one per row, whose members are the columns.
+   *
+   * The output has no nulls; null members are omitted from the objects, unless nulls are included
+   * in the output, in which case they are written as the null representation.
+   *
+   * @param columns The members of the objects
+   * @param names Names of the members
+   */
+  std::unique_ptr<column> objects_to_strings(std::vector<column_view> const& columns,
+                                             std::vector<column_name_info> const& names) const
+  {
+    CUDF_EXPECTS(not columns.empty(), "Unexpected empty set of columns.");
+    auto const num_rows = columns.front().size();
+
+    // each member is converted to `"name":value`, which is null if the value is null
+    std::vector<std::unique_ptr<column>> members;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      auto const child_names =
+        i < names.size() ? names[i].children : std::vector<column_name_info>{};
+      auto value = convert(columns[i], child_names);
+      if (options_.is_enabled_include_nulls() and value->has_nulls()) {
+        value = cudf::strings::detail::replace_nulls(value->view(), narep_, stream_);
+      }
+      auto const name = string_scalar(
+        escape_json_name(i < names.size() ? names[i].name : std::to_string(i)) + ":",
+        true,
+        stream_);
+      auto const name_column = make_column_from_scalar(name, num_rows, stream_);
+      members.push_back(
+        cudf::strings::detail::concatenate(table_view{{name_column->view(), value->view()}},
+                                           empty_,
+                                           invalid_,
+                                           strings::separator_on_nulls::YES,
+                                           stream_));
+    }
+
+    // null members are skipped, along with their separator
+    std::vector<column_view> member_views;
+    std::transform(members.begin(), members.end(), std::back_inserter(member_views), [](auto& m) {
+      return m->view();
+    });
+    // joining needs at least two columns; a single null member leaves an empty object
+    auto const joined =
+      member_views.size() == 1
+        ? cudf::strings::detail::replace_nulls(member_views.front(), empty_, stream_)
+        : cudf::strings::detail::concatenate(
+            table_view{member_views}, comma_, empty_, strings::separator_on_nulls::NO, stream_);
+
+    return enclose(joined->view(), "{", "}");
+  }
+
+  /**
+   * @brief Converts a list column to JSON arrays, writing null elements as the null representation.
+   */
+  std::unique_ptr<column> list_to_strings(lists_column_view const& lists,
+                                          std::vector<column_name_info> const& names) const
+  {
+    auto const child_names =
+      names.empty() ? std::vector<column_name_info>{} : names.back().children;
+    auto elements = convert(lists.get_sliced_child(stream_), child_names);
+    if (elements->has_nulls()) {
+      elements = cudf::strings::detail::replace_nulls(elements->view(), narep_, stream_);
+    }
+
+    // offsets of the sliced lists, rebased to the sliced child
+    auto offsets = make_numeric_column(
+      data_type{type_to_id<offset_type>()}, lists.size() + 1, mask_state::UNALLOCATED, stream_);
+    thrust::transform(rmm::exec_policy(stream_),
+                      lists.offsets_begin(),
+                      lists.offsets_end(),
+                      offsets->mutable_view().begin<offset_type>(),
+                      [first = lists.offsets_begin()] __device__(auto offset) {
+                        return offset - *first;
+                      });
+    auto const lists_of_strings =
+      make_lists_column(lists.size(),
+                        std::move(offsets),
+                        std::move(elements),
+                        lists.null_count(),
+                        cudf::detail::copy_bitmask(lists.parent(), stream_),
+                        stream_);
+
+    auto const joined =
+      cudf::strings::detail::join_list_elements(lists_column_view{lists_of_strings->view()},
+                                                comma_,
+                                                narep_,
+                                                strings::separator_on_nulls::YES,
+                                                strings::output_if_empty_list::EMPTY_STRING,
+                                                stream_,
+                                                rmm::mr::get_current_device_resource());
+
+    return enclose(joined->view(), "[", "]");
+  }
+
+ private:
+  /**
+   * @brief Encloses each string of a strings column between the given delimiters; null rows stay
+   * null.
+   */
+  std::unique_ptr<column> enclose(column_view const& strings,
+                                  std::string const& open,
+                                  std::string const& close) const
+  {
+    auto const prefix =
+      make_column_from_scalar(string_scalar(open, true, stream_), strings.size(), stream_);
+    auto const suffix =
+      make_column_from_scalar(string_scalar(close, true, stream_), strings.size(), stream_);
+    return cudf::strings::detail::concatenate(
+      table_view{{prefix->view(), strings, suffix->view()}},
+      empty_,
+      invalid_,
+      strings::separator_on_nulls::YES,
+      stream_,
+      mr_);
+  }
+
+  json_writer_options const& options_;
+  rmm::cuda_stream_view stream_;
+  rmm::mr::device_memory_resource* mr_;
+  string_scalar const narep_;
+  string_scalar const comma_;
+  string_scalar const empty_;
+  string_scalar const invalid_;
+};
+
+/**
+ * @brief Returns the names of the columns of the table, with the names of their children.
+ */
+std::vector<column_name_info> column_names(table_view const& table, table_metadata const* metadata)
+{
+  if (metadata != nullptr and not metadata->schema_info.empty()) {
+    CUDF_EXPECTS(metadata->schema_info.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    return metadata->schema_info;
+  }
+  std::vector<column_name_info> names(table.num_columns());
+  if (metadata != nullptr and not metadata->column_names.empty()) {
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    std::transform(metadata->column_names.begin(),
+                   metadata->column_names.end(),
+                   names.begin(),
+                   [](auto const& name) { return column_name_info{name}; });
+  } else {
+    thrust::tabulate(names.begin(), names.end(), [](auto idx) {
+      return column_name_info{std::to_string(idx)};
+    });
+  }
+  return names;
+}
+
+/**
+ * @brief Writes the strings of a single-row strings column to the sink.
+ */
+void write_string(data_sink* out_sink, strings_column_view const& str, rmm::cuda_stream_view stream)
+{
+  auto const total_num_bytes = str.chars_size();
+  char const* ptr_all_bytes  = str.chars_begin();
+  if (total_num_bytes == 0) { return; }
+
+  if (out_sink->is_device_write_preferred(total_num_bytes)) {
+    // Direct write from device memory
+    out_sink->device_write(ptr_all_bytes, total_num_bytes, stream);
+  } else {
+    // copy the bytes to host to write them out
+    thrust::host_vector<char> h_bytes(total_num_bytes);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
+                                  ptr_all_bytes,
+                                  total_num_bytes * sizeof(char),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+    stream.synchronize();
+
+    out_sink->host_write(h_bytes.data(), total_num_bytes);
+  }
+}
+
+}  // namespace
+
+void write_json(data_sink* out_sink,
+                table_view const& table,
+                json_writer_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  std::string const row_separator = options.is_enabled_lines() ? "\n" : ",";
+  auto const names                = column_names(table, options.get_metadata());
+
+  if (not options.is_enabled_lines()) { out_sink->host_write("[", 1); }
+
+  if (table.num_rows() > 0 and table.num_columns() > 0) {
+    auto const n_rows_per_chunk = options.get_rows_per_chunk();
+    CUDF_EXPECTS(n_rows_per_chunk >= 1, "write_json: invalid chunk_rows; must be at least 1");
+
+    // This outputs the JSON in row chunks to save memory; the JSON of an entire chunk must fit in
+    // CPU memory before writing it out.
+    std::vector<table_view> vector_views;
+    if (table.num_rows() <= n_rows_per_chunk) {
+      vector_views.push_back(table);
+    } else {
+      auto const n_chunks = table.num_rows() / n_rows_per_chunk;
+      std::vector<size_type> splits(n_chunks);
+      thrust::tabulate(splits.begin(), splits.end(), [n_rows_per_chunk](auto idx) {
+        return (idx + 1) * n_rows_per_chunk;
+      });
+
+      // split table_view into chunks:
+      vector_views = cudf::detail::split(table, splits, stream);
+    }
+
+    column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+    string_scalar const separator{row_separator, true, stream};
+    bool first_chunk = true;
+    for (auto&& sub_view : vector_views) {
+      // Skip if the table has no rows
+      if (sub_view.num_rows() == 0) continue;
+
+      // convert each row to a JSON object and join the rows of the chunk into a single string
+      auto const rows = converter.objects_to_strings(
+        std::vector<column_view>(sub_view.begin(), sub_view.end()), names);
+      auto const joined = cudf::strings::detail::join_strings(
+        rows->view(), separator, string_scalar("", false), stream);
+
+      // separate the chunk from the previous one; lines are terminated instead
+      if (not first_chunk and not options.is_enabled_lines()) {
+        out_sink->host_write(row_separator.data(), row_separator.size());
+      }
+      write_string(out_sink, strings_column_view{joined->view()}, stream);
+      if (options.is_enabled_lines()) {
+        out_sink->host_write(row_separator.data(), row_separator.size());
+      }
+      first_chunk = false;
+    }
+  }
+
+  if (not options.is_enabled_lines()) { out_sink->host_write("]", 1); }
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
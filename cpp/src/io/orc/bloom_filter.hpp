@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace orc {
+
+/**
+ * Bloom filters, as written in the BLOOM_FILTER_UTF8 streams of ORC files: one filter per row
+ * group, whose bits are set by `k` hash functions derived from a single 64-bit hash of the value.
+ * Integers are hashed with Thomas Wang's 64-bit integer hash, floating point values with the same
+ * hash of the bits of their double precision representation, and strings with Murmur3.
+ */
+
+constexpr double bloom_filter_fpp = 0.05;  //!< Default false positive probability of ORC writers
+
+namespace murmur3 {
+
+constexpr uint64_t c1   = 0x87c37b91114253d5ull;
+constexpr uint64_t c2   = 0x4cf5ad432745937full;
+constexpr uint32_t seed = 104729;
+
+CUDF_HOST_DEVICE inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+CUDF_HOST_DEVICE inline uint64_t fmix64(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+}  // namespace murmur3
+
+/**
+ * @brief Computes the 64-bit Murmur3 hash of a byte sequence, as used by ORC bloom filters
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_hash(uint8_t const* data, std::size_t len)
+{
+  using namespace murmur3;
+  uint64_t h         = seed;
+  auto const nblocks = len / 8;
+  for (std::size_t i = 0; i < nblocks; ++i) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; --b) {
+      k = (k << 8) | data[i * 8 + b];
+    }
+    k *= c1;
+    k = rotl64(k, 31);
+    k *= c2;
+    h ^= k;
+    h = rotl64(h, 27) * 5 + 0x52dce729;
+  }
+  auto const tail = len - nblocks * 8;
+  if (tail != 0) {
+    uint64_t k = 0;
+    for (auto b = static_cast<int>(tail) - 1; b >= 0; --b) {
+      k = (k << 8) | data[nblocks * 8 + b];
+    }
+    k *= c1;
+    k = rotl64(k, 31);
+    k *= c2;
+    h ^= k;
+  }
+  h ^= len;
+  return fmix64(h);
+}
+
+/**
+ * @brief Computes the hash of an integer value, as used by ORC bloom filters
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_hash(int64_t value)
+{
+  // Thomas Wang's integer hash; the right shifts are arithmetic
+  auto const sra = [](uint64_t x, int r) {
+    return static_cast<uint64_t>(static_cast<int64_t>(x) >> r);
+  };
+  auto key = static_cast<uint64_t>(value);
+  key      = (~key) + (key << 21);
+  key      = key ^ sra(key, 24);
+  key      = (key + (key << 3)) + (key << 8);
+  key      = key ^ sra(key, 14);
+  key      = (key + (key << 2)) + (key << 4);
+  key      = key ^ sra(key, 28);
+  key      = key + (key << 31);
+  return key;
+}
+
+/**
+ * @brief Computes the hash of a floating point value, as used by ORC bloom filters
+ *
+ * Values are hashed as doubles, with a single canonical NaN.
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_hash(double value)
+{
+  int64_t bits = 0x7ff8000000000000ll;
+  if (not std::isnan(value)) { memcpy(&bits, &value, sizeof(bits)); }
+  return bloom_filter_hash(bits);
+}
+
+/**
+ * @brief Returns the position of the bit that the `i`-th hash function sets for a value
+ *
+ * @param hash Hash of the value
+ * @param i Index of the hash function, starting at one
+ * @param num_bits Number of bits of the bloom filter
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + i * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Returns whether the value with the given hash may have been inserted in the bloom filter
+ *
+ * @param bitset Bloom filter bitset, as stored in the file
+ * @param num_bits Number of bits of the bloom filter
+ * @param num_hash_functions Number of hash functions of the bloom filter
+ * @param hash Hash of the value
+ */
+inline bool bloom_filter_may_contain(uint8_t const* bitset,
+                                     uint32_t num_bits,
+                                     uint32_t num_hash_functions,
+                                     uint64_t hash)
+{
+  for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+    auto const bit = bloom_filter_bit(hash, i, num_bits);
+    if ((bitset[bit / 8] & (1u << (bit % 8))) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the number of bits of a bloom filter, a multiple of 64
+ *
+ * @param num_entries Expected number of values in the bloom filter
+ */
+inline uint32_t bloom_filter_num_bits(std::size_t num_entries)
+{
+  auto const n        = static_cast<double>(std::max<std::size_t>(num_entries, 1));
+  auto const num_bits = static_cast<uint32_t>(-n * std::log(bloom_filter_fpp) /
+                                              (std::log(2.0) * std::log(2.0)));
+  return num_bits + (64 - num_bits % 64);
+}
+
+/**
+ * @brief Returns the number of hash functions of a bloom filter
+ *
+ * @param num_entries Expected number of values in the bloom filter
+ * @param num_bits Number of bits of the bloom filter
+ */
+inline uint32_t bloom_filter_num_hash_functions(std::size_t num_entries, uint32_t num_bits)
+{
+  auto const n = static_cast<double>(std::max<std::size_t>(num_entries, 1));
+  return std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(num_bits / n * std::log(2.0))));
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -200,6 +200,31 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  auto op =
+    std::make_tuple(make_field_reader(1, s.numHashFunctions), make_field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -364,6 +389,21 @@ size_t ProtobufWriter::write(const Metadata& s)
   return w.value();
 }
 
+size_t ProtobufWriter::write(const BloomFilter& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_uint(1, s.numHashFunctions);
+  w.field_blob(3, s.utf8bitset);
+  return w.value();
+}
+
+size_t ProtobufWriter::write(const BloomFilterIndex& s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_repeated_struct(1, s.bloomFilter);
+  return w.value();
+}
+
 OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize) : m_blockSize(blockSize)
 {
   switch (kind) {
@@ -380,7 +420,10 @@ OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize) : m_b
       m_log2MaxRatio = 5;  // < 32:1
       break;
     case LZO: _compression = compression_type::LZO; break;
-    case LZ4: _compression = compression_type::LZ4; break;
+    case LZ4:
+      _compression   = compression_type::LZ4;
+      m_log2MaxRatio = 8;  // < 256:1
+      break;
     case ZSTD:
       m_log2MaxRatio = 11;
       _compression   = compression_type::ZSTD;
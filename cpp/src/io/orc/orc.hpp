@@ -133,6 +133,24 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::optional<column_statistics> statistics;  // statistics of the row group
+  // the stream positions are not read on the host
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // entry of each row group
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // number of hash functions used to set bits for each value
+  std::string utf8bitset;         // bitset, as little-endian 64-bit words
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // bloom filter of each row group
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -220,6 +238,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -531,6 +553,8 @@ class ProtobufWriter {
   size_t write(const ColumnEncoding&);
   size_t write(const StripeStatistics&);
   size_t write(const Metadata&);
+  size_t write(const BloomFilter&);
+  size_t write(const BloomFilterIndex&);
 
  protected:
   std::vector<uint8_t>* m_buf;
@@ -329,6 +329,25 @@ void EncodeStripeDictionaries(StripeDictionary const* stripes,
                               device_2dspan<encoder_chunk_streams> enc_streams,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for building the bloom filters of each rowgroup of the given columns
+ *
+ * @param[in] columns Device view of the table columns
+ * @param[in] rowgroups Rowgroup bounds device array [rowgroup][column]
+ * @param[in] bloom_columns Indices of the columns that have a bloom filter
+ * @param[in,out] bitsets Zero-initialized bloom filters [rowgroup][bloom_column]
+ * @param[in] num_bits Number of bits of each bloom filter, a multiple of 64
+ * @param[in] num_hash_functions Number of hash functions of each bloom filter
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void EncodeBloomFilters(device_span<orc_column_device_view const> columns,
+                        device_2dspan<rowgroup_rows const> rowgroups,
+                        device_span<uint32_t const> bloom_columns,
+                        uint32_t* bitsets,
+                        uint32_t num_bits,
+                        uint32_t num_hash_functions,
+                        rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for compacting chunked column data prior to compression
  *
@@ -19,6 +19,7 @@
  * @brief cuDF-IO ORC reader class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "orc.hpp"
 #include "orc_gpu.hpp"
 
@@ -26,12 +27,18 @@
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/host_codec.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
@@ -53,7 +60,13 @@
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -183,6 +196,11 @@ size_t gather_stream_info(const size_t stripe_index,
   uint64_t src_offset = 0;
   uint64_t dst_offset = 0;
   for (const auto& stream : stripefooter->streams) {
+    // Bloom filters are only used to select the stripes to read
+    if (stream.kind == orc::BLOOM_FILTER or stream.kind == orc::BLOOM_FILTER_UTF8) {
+      src_offset += stream.length;
+      continue;
+    }
     if (!stream.column_id || *stream.column_id >= orc2gdf.size()) {
       dst_offset += stream.length;
       continue;
@@ -260,6 +278,20 @@ auto decimal_column_type(std::vector<std::string> const& decimal128_columns,
   return type_id::DECIMAL128;
 }
 
+/**
+ * @brief Returns the size of the device memory held by a column and its children.
+ */
+size_t device_memory_size(column_view const& col)
+{
+  auto const data_size =
+    is_fixed_width(col.type()) ? static_cast<size_t>(col.size()) * size_of(col.type()) : 0;
+  auto const mask_size = col.nullable() ? bitmask_allocation_size_bytes(col.size()) : 0;
+  return std::accumulate(
+    col.child_begin(), col.child_end(), data_size + mask_size, [](auto sum, auto const& child) {
+      return sum + device_memory_size(child);
+    });
+}
+
 }  // namespace
 
 __global__ void decompress_check_kernel(device_span<compression_result const> results,
@@ -414,6 +446,20 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                    total_decomp_size,
                                    stream);
         break;
+      case compression_type::LZ4:
+        if (nvcomp::is_compression_enabled(nvcomp::compression_type::LZ4)) {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     inflate_in_view,
+                                     inflate_out_view,
+                                     inflate_res,
+                                     max_uncomp_block_size,
+                                     total_decomp_size,
+                                     stream);
+        } else {
+          host::batched_decompress(
+            compression_type::LZ4, inflate_in_view, inflate_out_view, inflate_res, stream);
+        }
+        break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
     decompress_check(inflate_res, any_block_failure.device_ptr(), stream);
@@ -891,10 +937,26 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    orc_reader_options const& options,
                    rmm::cuda_stream_view stream,
                    rmm::mr::device_memory_resource* mr)
-  : _mr(mr),
+  : impl(0 /*chunk_read_limit*/, 0 /*pass_read_limit*/, std::move(sources), options, stream, mr)
+{
+}
+
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::size_t pass_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   orc_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : _stream(stream),
+    _mr(mr),
     _sources(std::move(sources)),
     _metadata{_sources, stream},
-    selected_columns{_metadata.select_columns(options.get_columns())}
+    selected_columns{_metadata.select_columns(options.get_columns())},
+    _skip_rows(options.get_skip_rows()),
+    _num_rows(options.get_num_rows()),
+    _stripes(options.get_stripes()),
+    _chunk_read_limit(chunk_read_limit),
+    _pass_read_limit(pass_read_limit)
 {
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -909,13 +971,22 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   // Control decimals conversion
   decimal128_columns = options.get_decimal128_columns();
+
+  // Rows that do not satisfy the filter are removed from the output
+  _filter = options.get_filter();
+  CUDF_EXPECTS(not _filter.has_value() or (_skip_rows == 0 and _num_rows == -1),
+               "skip_rows and num_rows can't be set along with a filter");
 }
 
 timezone_table reader::impl::compute_timezone_table(
   const std::vector<cudf::io::orc::metadata::stripe_source_mapping>& selected_stripes,
   rmm::cuda_stream_view stream)
 {
-  if (selected_stripes.empty()) return {};
+  auto const first_mapping =
+    std::find_if(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (first_mapping == selected_stripes.cend()) return {};
 
   auto const has_timestamp_column = std::any_of(
     selected_columns.levels.cbegin(), selected_columns.levels.cend(), [&](auto& col_lvl) {
@@ -925,10 +996,406 @@ timezone_table reader::impl::compute_timezone_table(
     });
   if (not has_timestamp_column) return {};
 
-  return build_timezone_transition_table(selected_stripes[0].stripe_info[0].second->writerTimezone,
+  return build_timezone_transition_table(first_mapping->stripe_info[0].second->writerTimezone,
                                          stream);
 }
 
+namespace {
+
+/**
+ * @brief Returns whether ORC column statistics can bound the values of output type `T`.
+ */
+template <typename T>
+constexpr bool has_min_max_stats()
+{
+  return (cudf::is_numeric<T>() and not std::is_same_v<T, bool>) or cudf::is_timestamp<T>();
+}
+
+/**
+ * @brief Functor to create a statistics column from the min/max values of ORC column statistics.
+ *
+ * Missing values, and NaN floating point values, result in null entries. Timestamp statistics
+ * only have a millisecond resolution, so they are widened by a millisecond to also bound the
+ * sub-millisecond part of the values.
+ */
+struct stats_column_builder {
+  template <typename T, std::enable_if_t<has_min_max_stats<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(
+    data_type type,
+    std::vector<std::optional<orc::column_statistics>> const& stats,
+    bool is_minimum,
+    rmm::cuda_stream_view stream) const
+  {
+    std::vector<std::optional<typename stats_rep<T>::type>> values(stats.size());
+    std::transform(stats.cbegin(), stats.cend(), values.begin(), [&](auto const& col_stats) {
+      return col_stats.has_value() ? get_value<T>(*col_stats, is_minimum) : std::nullopt;
+    });
+    return make_stats_column(type, values, stream);
+  }
+
+  template <typename T, std::enable_if_t<not has_min_max_stats<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(data_type,
+                                     std::vector<std::optional<orc::column_statistics>> const&,
+                                     bool,
+                                     rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Statistics are only supported for numeric and timestamp columns");
+  }
+
+ private:
+  template <typename T>
+  static std::optional<typename stats_rep<T>::type> get_value(
+    orc::column_statistics const& stats, bool is_minimum)
+  {
+    using rep_type = typename stats_rep<T>::type;
+    if constexpr (std::is_integral_v<T>) {
+      if (not stats.int_stats.has_value()) { return std::nullopt; }
+      auto const& value = is_minimum ? stats.int_stats->minimum : stats.int_stats->maximum;
+      if (not value.has_value()) { return std::nullopt; }
+      return static_cast<rep_type>(*value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      if (not stats.double_stats.has_value()) { return std::nullopt; }
+      auto const& value = is_minimum ? stats.double_stats->minimum : stats.double_stats->maximum;
+      if (not value.has_value() or std::isnan(*value)) { return std::nullopt; }
+      return static_cast<rep_type>(*value);
+    } else {
+      using duration_type = typename T::duration;
+      if (stats.date_stats.has_value()) {
+        auto const& value = is_minimum ? stats.date_stats->minimum : stats.date_stats->maximum;
+        if (not value.has_value()) { return std::nullopt; }
+        return cuda::std::chrono::duration_cast<duration_type>(duration_D{*value}).count();
+      }
+      if (stats.timestamp_stats.has_value()) {
+        auto const& value =
+          is_minimum ? stats.timestamp_stats->minimum_utc : stats.timestamp_stats->maximum_utc;
+        if (not value.has_value()) { return std::nullopt; }
+        // the conversion to a coarser resolution truncates, so the bounds are widened by a unit
+        auto const bound = is_minimum ? duration_ms{*value - 1} : duration_ms{*value + 1};
+        auto const one   = duration_type{is_minimum ? -1 : 1};
+        return (cuda::std::chrono::duration_cast<duration_type>(bound) + one).count();
+      }
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Functor to compute the bloom filter hash of a filter value.
+ */
+struct bloom_filter_value_hasher {
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() and not std::is_same_v<T, bool>>* = nullptr>
+  uint64_t operator()(std::vector<uint8_t> const& value) const
+  {
+    T v;
+    std::memcpy(&v, value.data(), sizeof(v));
+    if constexpr (std::is_floating_point_v<T>) {
+      return bloom_filter_hash(static_cast<double>(v));
+    } else {
+      return bloom_filter_hash(static_cast<int64_t>(v));
+    }
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() and not std::is_same_v<T, bool>)>* =
+              nullptr>
+  uint64_t operator()(std::vector<uint8_t> const&) const
+  {
+    CUDF_FAIL("Bloom filters are only probed for integer and floating point columns");
+  }
+};
+
+/**
+ * @brief Returns the stripes selected in the options, or all stripes of each source if none are.
+ */
+std::vector<std::vector<size_type>> candidate_stripes(
+  std::vector<std::vector<size_type>> const& stripes,
+  std::vector<metadata> const& per_file_metadata)
+{
+  if (not stripes.empty()) { return stripes; }
+  std::vector<std::vector<size_type>> candidates(per_file_metadata.size());
+  for (size_t src = 0; src < per_file_metadata.size(); ++src) {
+    candidates[src].resize(per_file_metadata[src].ff.stripes.size());
+    std::iota(candidates[src].begin(), candidates[src].end(), 0);
+  }
+  return candidates;
+}
+
+/**
+ * @brief Reads the decompressed index streams of a kind, e.g. row indexes or bloom filters, of
+ * the given columns of a stripe.
+ *
+ * Only the stripe footer and the requested streams are read.
+ *
+ * @return The data of the streams that are present, keyed by ORC column id
+ */
+std::map<uint32_t, std::vector<uint8_t>> read_index_streams(metadata const& file,
+                                                            StripeInformation const& stripe,
+                                                            StreamKind kind,
+                                                            std::vector<uint32_t> const& column_ids,
+                                                            rmm::cuda_stream_view stream)
+{
+  auto read_decompressed = [&](uint64_t offset, uint64_t length) {
+    CUDF_EXPECTS(offset + length <= file.source->size(), "Invalid stripe information");
+    auto const buffer = file.source->host_read(offset, length);
+    auto const data =
+      file.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+    return std::vector<uint8_t>(data.begin(), data.end());
+  };
+  StripeFooter footer;
+  auto const footer_data =
+    read_decompressed(stripe.offset + stripe.indexLength + stripe.dataLength, stripe.footerLength);
+  ProtobufReader(footer_data.data(), footer_data.size()).read(footer);
+
+  std::map<uint32_t, std::vector<uint8_t>> index_streams;
+  auto stream_offset = stripe.offset;
+  for (auto const& strm : footer.streams) {
+    if (strm.kind == kind and strm.column_id.has_value() and
+        std::find(column_ids.cbegin(), column_ids.cend(), *strm.column_id) != column_ids.cend()) {
+      index_streams[*strm.column_id] = read_decompressed(stream_offset, strm.length);
+    }
+    stream_offset += strm.length;
+  }
+  return index_streams;
+}
+
+}  // namespace
+
+std::vector<std::vector<size_type>> reader::impl::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes)
+{
+  auto const& out_columns = selected_columns.levels[0];
+
+  // Statistics are used for the top-level numeric and timestamp columns
+  std::vector<std::optional<data_type>> stats_types(out_columns.size());
+  for (size_t col = 0; col < out_columns.size(); ++col) {
+    auto const& schema = _metadata.get_col_type(out_columns[col].id);
+    switch (schema.kind) {
+      case orc::BYTE:
+      case orc::SHORT:
+      case orc::INT:
+      case orc::LONG:
+      case orc::FLOAT:
+      case orc::DOUBLE:
+      case orc::DATE:
+      case orc::TIMESTAMP:
+        stats_types[col] = data_type{
+          to_type_id(schema, _use_np_dtypes, _timestamp_type.id(), type_id::EMPTY)};
+        break;
+      default: break;
+    }
+  }
+
+  stats_expression_converter const converter(_filter->get(), stats_types, _stream);
+  if (converter.is_always_true()) { return stripes; }
+
+  auto const& per_file_metadata = _metadata.per_file_metadata;
+  auto const candidates         = candidate_stripes(stripes, per_file_metadata);
+  auto const num_stripes = std::accumulate(
+    candidates.cbegin(), candidates.cend(), size_type{0}, [](auto sum, auto const& src_stripes) {
+      return sum + static_cast<size_type>(src_stripes.size());
+    });
+
+  // Stripe statistics of the referenced columns; stripes without statistics are always read
+  std::vector<std::vector<std::optional<orc::column_statistics>>> stripe_stats(
+    out_columns.size());
+  for (auto const col : converter.get_referenced_columns()) {
+    auto const orc_col_id = static_cast<size_t>(out_columns[col].id);
+    for (size_t src = 0; src < candidates.size(); ++src) {
+      auto const& file_stats = per_file_metadata[src].md.stripeStats;
+      for (auto const stripe_idx : candidates[src]) {
+        auto& stats = stripe_stats[col].emplace_back();
+        if (static_cast<size_t>(stripe_idx) < file_stats.size() and
+            orc_col_id < file_stats[stripe_idx].colStats.size()) {
+          auto const& blob = file_stats[stripe_idx].colStats[orc_col_id];
+          ProtobufReader(blob.data(), blob.size()).read(stats.emplace());
+        }
+      }
+    }
+  }
+
+  // Evaluates the filter on the statistics of `num_ranges` row ranges, per referenced column
+  auto evaluate = [&](std::vector<std::vector<std::optional<orc::column_statistics>>> const& stats,
+                      size_type num_ranges) {
+    std::vector<std::unique_ptr<column>> stats_columns;
+    for (size_t col = 0; col < out_columns.size(); ++col) {
+      for (auto const is_minimum : {true, false}) {
+        if (stats[col].empty()) {
+          stats_columns.push_back(make_numeric_column(
+            data_type{type_id::INT8}, num_ranges, mask_state::ALL_NULL, _stream));
+        } else {
+          stats_columns.push_back(type_dispatcher(*stats_types[col],
+                                                  stats_column_builder{},
+                                                  *stats_types[col],
+                                                  stats[col],
+                                                  is_minimum,
+                                                  _stream));
+        }
+      }
+    }
+    auto const stats_table = table(std::move(stats_columns));
+    return evaluate_stats_filter(converter, stats_table.view(), _stream);
+  };
+  auto keep = evaluate(stripe_stats, num_stripes);
+
+  // Refine the remaining stripes with the row group statistics of the row indexes of the
+  // referenced columns: a stripe is read if any of its row groups may contain matching rows. The
+  // row groups of a stripe that is read are all decoded.
+  std::vector<uint32_t> referenced_ids;
+  for (auto const col : converter.get_referenced_columns()) {
+    referenced_ids.push_back(out_columns[col].id);
+  }
+  std::vector<std::vector<std::optional<orc::column_statistics>>> row_group_stats(
+    out_columns.size());
+  std::vector<size_t> row_group_stripes;  // stripe of each row group
+  std::vector<bool> has_row_group_stats(num_stripes, false);
+  for (size_t src = 0, stripe = 0; src < candidates.size(); ++src) {
+    auto const& file = per_file_metadata[src];
+    for (auto const stripe_idx : candidates[src]) {
+      auto const current = stripe++;
+      if (not keep[current]) { continue; }
+      CUDF_EXPECTS(stripe_idx >= 0 and stripe_idx < file.get_num_stripes(),
+                   "Invalid stripe index");
+      auto const index_streams =
+        read_index_streams(file, file.ff.stripes[stripe_idx], ROW_INDEX, referenced_ids, _stream);
+      if (index_streams.size() != referenced_ids.size()) { continue; }
+
+      // all referenced columns must have the statistics of the same row groups
+      std::vector<RowIndex> row_indexes(referenced_ids.size());
+      for (size_t i = 0; i < referenced_ids.size(); ++i) {
+        auto const& index_data = index_streams.at(referenced_ids[i]);
+        ProtobufReader(index_data.data(), index_data.size()).read(row_indexes[i]);
+      }
+      auto const num_row_groups = row_indexes.front().entry.size();
+      if (num_row_groups == 0 or
+          std::any_of(row_indexes.cbegin(), row_indexes.cend(), [&](auto const& index) {
+            return index.entry.size() != num_row_groups;
+          })) {
+        continue;
+      }
+
+      has_row_group_stats[current] = true;
+      row_group_stripes.insert(row_group_stripes.end(), num_row_groups, current);
+      auto index_it = row_indexes.cbegin();
+      for (auto const col : converter.get_referenced_columns()) {
+        auto const& entries = (index_it++)->entry;
+        std::transform(entries.cbegin(),
+                       entries.cend(),
+                       std::back_inserter(row_group_stats[col]),
+                       [](auto const& entry) { return entry.statistics; });
+      }
+    }
+  }
+  if (not row_group_stripes.empty()) {
+    auto const row_group_keep =
+      evaluate(row_group_stats, static_cast<size_type>(row_group_stripes.size()));
+    for (size_t stripe = 0; stripe < keep.size(); ++stripe) {
+      if (has_row_group_stats[stripe]) { keep[stripe] = false; }
+    }
+    for (size_t row_group = 0; row_group < row_group_stripes.size(); ++row_group) {
+      if (row_group_keep[row_group]) { keep[row_group_stripes[row_group]] = true; }
+    }
+  }
+
+  std::vector<std::vector<size_type>> selected(candidates.size());
+  size_t stripe = 0;
+  for (size_t src = 0; src < candidates.size(); ++src) {
+    std::copy_if(candidates[src].cbegin(),
+                 candidates[src].cend(),
+                 std::back_inserter(selected[src]),
+                 [&](auto) { return keep[stripe++]; });
+  }
+  return selected;
+}
+
+std::vector<std::vector<size_type>> reader::impl::probe_bloom_filters(
+  std::vector<std::vector<size_type>> const& stripes)
+{
+  auto const& out_columns = selected_columns.levels[0];
+
+  // Bloom filters are probed for the top-level integer and floating point columns
+  std::vector<std::optional<data_type>> probe_types(out_columns.size());
+  for (size_t col = 0; col < out_columns.size(); ++col) {
+    auto const& schema = _metadata.get_col_type(out_columns[col].id);
+    switch (schema.kind) {
+      case orc::BYTE:
+      case orc::SHORT:
+      case orc::INT:
+      case orc::LONG:
+      case orc::FLOAT:
+      case orc::DOUBLE:
+        probe_types[col] = data_type{
+          to_type_id(schema, _use_np_dtypes, _timestamp_type.id(), type_id::EMPTY)};
+        break;
+      default: break;
+    }
+  }
+
+  equality_filter const filter(_filter->get(), probe_types, _stream);
+  auto const& predicates = filter.get_predicates();
+  if (predicates.empty()) { return stripes; }
+
+  std::vector<uint64_t> hashes;
+  std::vector<uint32_t> probed_ids;
+  for (auto const& predicate : predicates) {
+    hashes.push_back(type_dispatcher(predicate.type, bloom_filter_value_hasher{}, predicate.value));
+    probed_ids.push_back(out_columns[predicate.column].id);
+  }
+
+  auto const& per_file_metadata = _metadata.per_file_metadata;
+  auto const candidates         = candidate_stripes(stripes, per_file_metadata);
+
+  std::vector<std::vector<size_type>> selected(candidates.size());
+  for (size_t src = 0; src < candidates.size(); ++src) {
+    auto const& file = per_file_metadata[src];
+    for (auto const stripe_idx : candidates[src]) {
+      CUDF_EXPECTS(stripe_idx >= 0 and stripe_idx < file.get_num_stripes(),
+                   "Invalid stripe index");
+      auto const& stripe = file.ff.stripes[stripe_idx];
+
+      std::map<uint32_t, BloomFilterIndex> bloom_filters;
+      for (auto const& [column_id, index_data] :
+           read_index_streams(file, stripe, BLOOM_FILTER_UTF8, probed_ids, _stream)) {
+        ProtobufReader(index_data.data(), index_data.size()).read(bloom_filters[column_id]);
+      }
+
+      // A predicate may be satisfied in the stripe if any of its rowgroups may contain the value
+      std::vector<bool> may_match(predicates.size(), true);
+      for (size_t i = 0; i < predicates.size(); ++i) {
+        auto const index = bloom_filters.find(probed_ids[i]);
+        if (index == bloom_filters.cend()) { continue; }
+        may_match[i] = std::any_of(
+          index->second.bloomFilter.cbegin(),
+          index->second.bloomFilter.cend(),
+          [&](auto const& bloom_filter) {
+            auto const num_bits = static_cast<uint32_t>(bloom_filter.utf8bitset.size() * 8);
+            return num_bits == 0 or bloom_filter.numHashFunctions == 0 or
+                   bloom_filter_may_contain(
+                     reinterpret_cast<uint8_t const*>(bloom_filter.utf8bitset.data()),
+                     num_bits,
+                     bloom_filter.numHashFunctions,
+                     hashes[i]);
+          });
+      }
+      if (filter.evaluate(may_match)) { selected[src].push_back(stripe_idx); }
+    }
+  }
+  return selected;
+}
+
+table_with_metadata reader::impl::apply_filter(table_with_metadata&& result)
+{
+  if (not _filter.has_value()) { return std::move(result); }
+
+  auto const predicate = cudf::detail::compute_column(
+    result.tbl->view(), _filter->get(), _stream, rmm::mr::get_current_device_resource());
+  CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8,
+               "Filter must evaluate to a boolean column");
+  result.tbl =
+    cudf::detail::apply_boolean_mask(result.tbl->view(), predicate->view(), _stream, _mr);
+  return std::move(result);
+}
+
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        const std::vector<std::vector<size_type>>& stripes,
@@ -939,6 +1406,27 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   CUDF_EXPECTS(skip_rows == 0 or selected_columns.num_levels() == 1,
                "skip_rows is not supported by nested columns");
 
+  // There are no columns in the table
+  if (selected_columns.num_levels() == 0) return {std::make_unique<table>(), table_metadata{}};
+
+  // Select only stripes required (aka row groups), skipping the stripes excluded by the filter
+  const auto selected_stripes = _metadata.select_stripes(
+    _filter.has_value() ? probe_bloom_filters(filter_stripes(stripes)) : stripes,
+    skip_rows,
+    num_rows,
+    stream);
+
+  _tz_table = compute_timezone_table(selected_stripes, stream);
+
+  return apply_filter(read_stripes(skip_rows, num_rows, selected_stripes, stream));
+}
+
+table_with_metadata reader::impl::read_stripes(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<cudf::io::orc::metadata::stripe_source_mapping> const& selected_stripes,
+  rmm::cuda_stream_view stream)
+{
   std::vector<std::unique_ptr<column>> out_columns;
   // buffer and stripe data are stored as per nesting level
   std::vector<std::vector<column_buffer>> out_buffers(selected_columns.num_levels());
@@ -951,10 +1439,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (selected_columns.num_levels() == 0)
     return {std::make_unique<table>(), std::move(out_metadata)};
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows, stream);
-
-  auto const tz_table = compute_timezone_table(selected_stripes, stream);
+  // The column mapping is rebuilt for every set of stripes
+  _col_meta = reader_column_meta{};
 
   // Iterates through levels of nested columns, child column will be one level down
   // compared to parent column.
@@ -1048,6 +1534,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       int stripe_idx          = 0;
 
       std::vector<std::pair<std::future<size_t>, size_t>> read_tasks;
+      // Streams read through the host are requested from each source at once, so that the source
+      // can merge nearby ranges and fetch them in parallel
+      struct host_read_group {
+        std::vector<datasource::range> ranges;
+        std::vector<uint8_t*> destinations;
+        std::future<std::vector<std::unique_ptr<datasource::buffer>>> buffers;
+      };
+      std::map<int, host_read_group> host_reads;
       for (auto const& stripe_source_mapping : selected_stripes) {
         // Iterate through the source files selected stripes
         for (auto const& stripe : stripe_source_mapping.stripe_info) {
@@ -1091,21 +1585,21 @@ table_with_metadata reader::impl::read(size_type skip_rows,
               len += stream_info[stream_count].length;
               stream_count++;
             }
-            if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                  .source->is_device_read_preferred(len)) {
+            if (auto const prefetched = get_prefetched_data(stripe_info, offset, len);
+                prefetched != nullptr) {
+              CUDF_CUDA_TRY(
+                cudaMemcpyAsync(d_dst, prefetched, len, cudaMemcpyHostToDevice, stream.value()));
+            } else if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
+                         .source->is_device_read_preferred(len)) {
               read_tasks.push_back(
                 std::pair(_metadata.per_file_metadata[stripe_source_mapping.source_idx]
                             .source->device_read_async(offset, len, d_dst, stream),
                           len));
 
             } else {
-              const auto buffer =
-                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                  offset, len);
-              CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-              CUDF_CUDA_TRY(cudaMemcpyAsync(
-                d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
+              auto& group = host_reads[stripe_source_mapping.source_idx];
+              group.ranges.push_back({offset, len});
+              group.destinations.push_back(d_dst);
             }
           }
 
@@ -1170,6 +1664,24 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           stripe_idx++;
         }
       }
+      for (auto& [source_idx, group] : host_reads) {
+        group.buffers = _metadata.per_file_metadata[source_idx].source->host_read_async(
+          group.ranges, host_read_max_gap());
+      }
+      for (auto& [source_idx, group] : host_reads) {
+        auto const buffers = group.buffers.get();
+        for (size_t i = 0; i < buffers.size(); ++i) {
+          CUDF_EXPECTS(buffers[i]->size() == group.ranges[i].size,
+                       "Unexpected discrepancy in bytes read.");
+          CUDF_CUDA_TRY(cudaMemcpyAsync(group.destinations[i],
+                                        buffers[i]->data(),
+                                        buffers[i]->size(),
+                                        cudaMemcpyHostToDevice,
+                                        stream.value()));
+        }
+        // The host buffers are released at the end of the scope
+        stream.synchronize();
+      }
       for (auto& task : read_tasks) {
         CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
       }
@@ -1242,7 +1754,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           decode_stream_data(chunks,
                              num_dict_entries,
                              skip_rows,
-                             tz_table.view(),
+                             _tz_table.view(),
                              row_groups,
                              _metadata.get_row_index_stride(),
                              out_buffers[level],
@@ -1312,6 +1824,218 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+void reader::impl::prepare_chunked_read()
+{
+  if (_chunked_read_prepared) { return; }
+  _chunked_read_prepared = true;
+
+  if (selected_columns.num_levels() == 0) { return; }
+  CUDF_EXPECTS(_skip_rows == 0 or selected_columns.num_levels() == 1,
+               "skip_rows is not supported by nested columns");
+
+  // The stripes and their footers are selected once, and shared by all chunks
+  if (_filter.has_value()) { _stripes = probe_bloom_filters(filter_stripes(_stripes)); }
+  auto const selected_stripes = _metadata.select_stripes(_stripes, _skip_rows, _num_rows, _stream);
+  _tz_table                   = compute_timezone_table(selected_stripes, _stream);
+
+  // Output type and nesting level of each selected ORC column
+  std::vector<std::pair<size_type, data_type>> column_types(_metadata.get_num_cols(),
+                                                            {-1, data_type{type_id::EMPTY}});
+  for (size_t level = 0; level < selected_columns.num_levels(); ++level) {
+    for (auto const& col : selected_columns.levels[level]) {
+      column_types[col.id] = {
+        static_cast<size_type>(level),
+        data_type{to_type_id(_metadata.get_col_type(col.id),
+                             _use_np_dtypes,
+                             _timestamp_type.id(),
+                             decimal_column_type(decimal128_columns, _metadata, col.id))}};
+    }
+  }
+
+  size_t start_row = 0;
+  for (auto const& mapping : selected_stripes) {
+    for (auto const& stripe : mapping.stripe_info) {
+      auto const stripe_info   = stripe.first;
+      auto const stripe_footer = stripe.second;
+      auto const num_rows      = static_cast<size_t>(stripe_info->numberOfRows);
+
+      // Find the range of the streams of the selected columns, and the size of their data
+      std::vector<size_t> stream_sizes(column_types.size(), 0);
+      std::vector<bool> has_nulls(column_types.size(), false);
+      uint64_t src_offset = 0;
+      auto data_begin     = std::numeric_limits<uint64_t>::max();
+      uint64_t data_end   = 0;
+      for (auto const& strm : stripe_footer->streams) {
+        if (strm.column_id and *strm.column_id < column_types.size() and
+            column_types[*strm.column_id].first >= 0) {
+          data_begin = std::min(data_begin, src_offset);
+          data_end   = std::max(data_end, src_offset + strm.length);
+          if (strm.kind != orc::ROW_INDEX and strm.kind != orc::BLOOM_FILTER and
+              strm.kind != orc::BLOOM_FILTER_UTF8) {
+            stream_sizes[*strm.column_id] += strm.length;
+          }
+          if (strm.kind == orc::PRESENT) { has_nulls[*strm.column_id] = true; }
+        }
+        src_offset += strm.length;
+      }
+
+      // Top-level fixed-width columns have an exact decoded size; the decoded size of other
+      // columns is estimated from the size of their stream data
+      size_t output_size = 0;
+      for (size_t col_id = 0; col_id < column_types.size(); ++col_id) {
+        auto const [level, type] = column_types[col_id];
+        if (level < 0) { continue; }
+        if (level == 0 and is_fixed_width(type)) {
+          output_size += num_rows * size_of(type);
+        } else {
+          output_size += stream_sizes[col_id] + (level == 0 ? num_rows * sizeof(size_type) : 0);
+        }
+        if (level == 0 and has_nulls[col_id]) {
+          output_size += bitmask_allocation_size_bytes(num_rows);
+        }
+      }
+
+      _chunk_stripes.push_back({mapping.source_idx,
+                                stripe,
+                                start_row,
+                                stripe_info->offset + (data_end > 0 ? data_begin : 0),
+                                data_end > 0 ? data_end - data_begin : 0,
+                                output_size});
+      start_row += num_rows;
+    }
+  }
+}
+
+size_t reader::impl::find_chunk_end(size_t first_stripe) const
+{
+  // Scale the estimates by the ratio of actual to estimated sizes of the chunks read so far
+  auto const output_ratio =
+    _estimated_output_size > 0
+      ? static_cast<double>(_actual_output_size) / static_cast<double>(_estimated_output_size)
+      : 1.0;
+
+  double output_size = 0;
+  size_t data_size   = 0;
+  auto end           = first_stripe;
+  while (end < _chunk_stripes.size()) {
+    auto const& stripe          = _chunk_stripes[end];
+    auto const next_output_size = output_size + stripe.output_size * output_ratio;
+    auto const next_data_size   = data_size + stripe.data_length;
+    if (end > first_stripe and
+        ((_chunk_read_limit > 0 and next_output_size > _chunk_read_limit) or
+         (_pass_read_limit > 0 and next_data_size > _pass_read_limit))) {
+      break;
+    }
+    output_size = next_output_size;
+    data_size   = next_data_size;
+    ++end;
+  }
+  return end;
+}
+
+void reader::impl::prefetch_stripes(size_t begin, size_t end)
+{
+  for (auto i = begin; i < end; ++i) {
+    auto const& stripe = _chunk_stripes[i];
+    auto const source  = _metadata.per_file_metadata[stripe.source_idx].source;
+    // the current chunk is read from the same source while the prefetch is running
+    if (stripe.data_length == 0 or _prefetched_stripes.count(stripe.stripe.first) != 0 or
+        not source->supports_concurrent_host_reads() or
+        source->is_device_read_preferred(stripe.data_length)) {
+      continue;
+    }
+    _prefetched_stripes.emplace(
+      stripe.stripe.first,
+      prefetched_stripe{stripe.data_offset,
+                        std::async(std::launch::async,
+                                   [source, offset = stripe.data_offset, len = stripe.data_length] {
+                                     return source->host_read(offset, len);
+                                   }),
+                        nullptr});
+  }
+}
+
+uint8_t const* reader::impl::get_prefetched_data(const StripeInformation* stripe,
+                                                 uint64_t offset,
+                                                 size_t length)
+{
+  auto const it = _prefetched_stripes.find(stripe);
+  if (it == _prefetched_stripes.end()) { return nullptr; }
+
+  auto& prefetched = it->second;
+  if (prefetched.buffer == nullptr) { prefetched.buffer = prefetched.task.get(); }
+  if (offset < prefetched.offset or
+      offset + length > prefetched.offset + prefetched.buffer->size()) {
+    return nullptr;
+  }
+  return prefetched.buffer->data() + (offset - prefetched.offset);
+}
+
+bool reader::impl::has_next()
+{
+  prepare_chunked_read();
+  return _num_chunks_read == 0 or _next_stripe < _chunk_stripes.size();
+}
+
+table_with_metadata reader::impl::read_chunk()
+{
+  prepare_chunked_read();
+
+  // Return an empty table once all the chunks have been read
+  if (_num_chunks_read > 0 and _next_stripe >= _chunk_stripes.size()) {
+    return apply_filter(read_stripes(0, 0, {}, _stream));
+  }
+
+  auto const begin = _next_stripe;
+  auto const end   = find_chunk_end(begin);
+  _next_stripe     = end;
+  ++_num_chunks_read;
+
+  // Start reading the stripe data of the next chunk while this chunk is decoded
+  prefetch_stripes(end, find_chunk_end(end));
+
+  // Rows of the chunk, relative to the first selected stripe
+  size_t chunk_begin_row = 0;
+  size_t chunk_end_row   = 0;
+  if (begin < end) {
+    auto const& last_stripe = _chunk_stripes[end - 1];
+    chunk_begin_row         = _chunk_stripes[begin].start_row;
+    chunk_end_row           = last_stripe.start_row + last_stripe.stripe.first->numberOfRows;
+  }
+  auto const read_begin_row = std::max<size_t>(chunk_begin_row, _skip_rows);
+  auto const read_end_row   = std::min<size_t>(chunk_end_row, _skip_rows + _num_rows);
+  auto const skip_rows      = static_cast<size_type>(read_begin_row - chunk_begin_row);
+  auto const num_rows =
+    static_cast<size_type>(read_end_row > read_begin_row ? read_end_row - read_begin_row : 0);
+
+  std::vector<cudf::io::orc::metadata::stripe_source_mapping> chunk_stripes;
+  size_t estimated_output_size = 0;
+  for (auto i = begin; i < end; ++i) {
+    auto const& stripe = _chunk_stripes[i];
+    if (chunk_stripes.empty() or chunk_stripes.back().source_idx != stripe.source_idx) {
+      chunk_stripes.push_back({stripe.source_idx, {}});
+    }
+    chunk_stripes.back().stripe_info.push_back(stripe.stripe);
+    estimated_output_size += stripe.output_size;
+  }
+
+  auto result = read_stripes(skip_rows, num_rows, chunk_stripes, _stream);
+
+  for (auto i = begin; i < end; ++i) {
+    _prefetched_stripes.erase(_chunk_stripes[i].stripe.first);
+  }
+
+  // Refine the output size estimates of the following chunks
+  auto const table = result.tbl->view();
+  _estimated_output_size += estimated_output_size;
+  _actual_output_size += std::accumulate(
+    table.begin(), table.end(), size_t{0}, [](auto sum, auto const& col) {
+      return sum + device_memory_size(col);
+    });
+
+  return apply_filter(std::move(result));
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                orc_reader_options const& options,
@@ -1321,6 +2045,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
   _impl = std::make_unique<impl>(std::move(sources), options, stream, mr);
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
@@ -1331,6 +2057,27 @@ table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_st
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
 
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(
+    chunk_read_limit, pass_read_limit, std::move(sources), options, stream, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -29,7 +29,11 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -70,6 +74,27 @@ struct reader_column_meta {
   std::vector<row_group_meta> rwgrp_meta;  // rowgroup metadata [rowgroup][column]
 };
 
+/**
+ * @brief Struct describing a selected stripe of a chunked read.
+ */
+struct chunked_stripe_info {
+  int source_idx;  // index of the source the stripe is read from
+  std::pair<const StripeInformation*, const StripeFooter*> stripe;
+  size_t start_row;      // first row of the stripe, relative to the first selected stripe
+  uint64_t data_offset;  // file offset of the first stream of the selected columns
+  size_t data_length;    // length of the range of the streams of the selected columns
+  size_t output_size;    // estimated size of the decoded selected columns
+};
+
+/**
+ * @brief Struct holding stripe data that is read in the background ahead of its chunk.
+ */
+struct prefetched_stripe {
+  uint64_t offset;  // file offset of the prefetched data
+  std::future<std::unique_ptr<datasource::buffer>> task;
+  std::unique_ptr<datasource::buffer> buffer;
+};
+
 /**
  * @brief Implementation for ORC reader
  */
@@ -87,6 +112,29 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from read limits and an array of dataset sources with reader options.
+   *
+   * The metadata is parsed once. The selected stripes are then grouped into chunks of whole
+   * stripes such that each chunk is estimated to fit within the given limits, and each call to
+   * `read_chunk()` reads and decodes the next chunk.
+   *
+   * @param chunk_read_limit Limit on the total number of bytes returned per chunk, or `0` if
+   * there is no limit
+   * @param pass_read_limit Limit on the number of bytes of stripe data loaded per chunk, or `0`
+   * if there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::size_t pass_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                orc_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -102,7 +150,125 @@ class reader::impl {
                            const std::vector<std::vector<size_type>>& stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next();
+
+  /**
+   * @brief Read a chunk of rows in the given ORC file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return The output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk();
+
  private:
+  /**
+   * @brief Reads and decodes the given stripes and returns a set of columns
+   *
+   * @param skip_rows Number of rows to skip from the start of the first stripe
+   * @param num_rows Number of rows to read
+   * @param selected_stripes Stripes to read, with their footers
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_stripes(
+    size_type skip_rows,
+    size_type num_rows,
+    std::vector<cudf::io::orc::metadata::stripe_source_mapping> const& selected_stripes,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Selects the stripes whose column statistics do not rule out rows that satisfy the
+   * filter.
+   *
+   * The filter is evaluated on the stripe statistics of the file metadata, and then on the row
+   * group statistics of the row indexes of the remaining stripes, if present. A stripe is selected
+   * if any of its row groups may contain matching rows.
+   *
+   * @param stripes Stripes selected in the reader options for each source; empty for all stripes
+   *
+   * @return Stripes to read for each source
+   */
+  std::vector<std::vector<size_type>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes);
+
+  /**
+   * @brief Removes the stripes whose bloom filters show that they cannot contain rows satisfying
+   * the filter.
+   *
+   * Only the equality predicates of the filter on top-level integer and floating point columns
+   * are used. A predicate is satisfiable in a stripe if the column has no bloom filter in the
+   * stripe, or if the bloom filter of any of its rowgroups may contain the value.
+   *
+   * @param stripes Stripes to read for each source; empty for all stripes
+   *
+   * @return Stripes that may contain matching rows, for each source
+   */
+  std::vector<std::vector<size_type>> probe_bloom_filters(
+    std::vector<std::vector<size_type>> const& stripes);
+
+  /**
+   * @brief Removes the rows that do not satisfy the filter, if one is set.
+   *
+   * @param result Decoded table and its metadata
+   *
+   * @return The table with only the rows that satisfy the filter, and its metadata
+   */
+  table_with_metadata apply_filter(table_with_metadata&& result);
+
+  /**
+   * @brief Selects the stripes of a chunked read and estimates their sizes.
+   *
+   * This is done only once per file; subsequent calls are no-ops.
+   */
+  void prepare_chunked_read();
+
+  /**
+   * @brief Returns the end of the chunk starting at the given stripe.
+   *
+   * Stripes are added to the chunk while the estimated output size and the size of the stripe
+   * data stay within the read limits. A chunk contains at least one stripe.
+   *
+   * @param first_stripe Index of the first stripe of the chunk
+   *
+   * @return Index after the last stripe of the chunk
+   */
+  [[nodiscard]] size_t find_chunk_end(size_t first_stripe) const;
+
+  /**
+   * @brief Starts reading the stripe data of the given stripes in the background.
+   *
+   * Stripes of sources that do not support concurrent host reads are not prefetched, and are read
+   * when they are decoded.
+   *
+   * @param begin Index of the first stripe to prefetch
+   * @param end Index after the last stripe to prefetch
+   */
+  void prefetch_stripes(size_t begin, size_t end);
+
+  /**
+   * @brief Returns the prefetched data of a stripe, if it contains the given range.
+   *
+   * @param stripe Stripe the range belongs to
+   * @param offset File offset of the range
+   * @param length Length of the range
+   *
+   * @return Pointer to the data of the range, or `nullptr` if the range has not been prefetched
+   */
+  uint8_t const* get_prefetched_data(const StripeInformation* stripe,
+                                     uint64_t offset,
+                                     size_t length);
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -215,6 +381,7 @@ class reader::impl {
     rmm::cuda_stream_view stream);
 
  private:
+  rmm::cuda_stream_view _stream;
   rmm::mr::device_memory_resource* _mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
   cudf::io::orc::detail::aggregate_orc_metadata _metadata;
@@ -225,6 +392,27 @@ class reader::impl {
   std::vector<std::string> decimal128_columns;
   data_type _timestamp_type{type_id::EMPTY};
   reader_column_meta _col_meta{};
+  timezone_table _tz_table;
+
+  // Rows and stripes to read, used by the chunked read
+  size_type _skip_rows{0};
+  size_type _num_rows{-1};
+  std::vector<std::vector<size_type>> _stripes;
+
+  // Predicate filter on the output columns; `nullopt` is no filtering
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Chunked reading state, shared between the chunks of a read
+  std::size_t _chunk_read_limit{0};
+  std::size_t _pass_read_limit{0};
+  bool _chunked_read_prepared{false};
+  std::vector<chunked_stripe_info> _chunk_stripes;
+  size_t _next_stripe{0};
+  size_t _num_chunks_read{0};
+  // Estimated and actual output sizes of the chunks read so far, used to refine the estimates
+  size_t _estimated_output_size{0};
+  size_t _actual_output_size{0};
+  std::map<const StripeInformation*, prefetched_stripe> _prefetched_stripes;
 };
 
 }  // namespace orc
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include "bloom_filter.hpp"
 #include "orc_common.hpp"
 #include "orc_gpu.hpp"
 
+#include <io/comp/host_codec.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/config_utils.hpp>
@@ -1272,6 +1274,58 @@ __global__ void __launch_bounds__(1024)
   }
 }
 
+/**
+ * @brief Inserts the values of each rowgroup of a column into the rowgroup's bloom filter
+ *
+ * @param[in] columns Device view of the table columns
+ * @param[in] rowgroups Rowgroup bounds [rowgroup][column]
+ * @param[in] bloom_columns Indices of the columns that have a bloom filter
+ * @param[in,out] bitsets Zero-initialized bloom filters [rowgroup][bloom_column]
+ * @param[in] num_bits Number of bits of each bloom filter
+ * @param[in] num_hash_functions Number of hash functions of each bloom filter
+ */
+// blockDim {block_size,1,1}
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  gpuEncodeBloomFilters(device_span<orc_column_device_view const> columns,
+                        device_2dspan<rowgroup_rows const> rowgroups,
+                        device_span<uint32_t const> bloom_columns,
+                        uint32_t* bitsets,
+                        uint32_t num_bits,
+                        uint32_t num_hash_functions)
+{
+  auto const rg_idx    = blockIdx.x;
+  auto const col_idx   = bloom_columns[blockIdx.y];
+  auto const& col      = columns[col_idx];
+  auto const& rowgroup = rowgroups[rg_idx][col_idx];
+  auto bitset = bitsets + (static_cast<size_t>(rg_idx) * bloom_columns.size() + blockIdx.y) *
+                            (num_bits / 32);
+
+  for (auto row = rowgroup.begin + static_cast<size_type>(threadIdx.x); row < rowgroup.end;
+       row += block_size) {
+    if (not col.is_valid(row)) { continue; }
+    uint64_t const hash = [&]() {
+      switch (col.type().id()) {
+        case type_id::INT8: return bloom_filter_hash(int64_t{col.element<int8_t>(row)});
+        case type_id::INT16: return bloom_filter_hash(int64_t{col.element<int16_t>(row)});
+        case type_id::INT32: return bloom_filter_hash(int64_t{col.element<int32_t>(row)});
+        case type_id::INT64: return bloom_filter_hash(col.element<int64_t>(row));
+        case type_id::FLOAT32: return bloom_filter_hash(double{col.element<float>(row)});
+        case type_id::FLOAT64: return bloom_filter_hash(col.element<double>(row));
+        default: {
+          auto const str = col.element<string_view>(row);
+          return bloom_filter_hash(reinterpret_cast<uint8_t const*>(str.data()),
+                                   str.size_bytes());
+        }
+      }
+    }();
+    for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+      auto const bit = bloom_filter_bit(hash, i, num_bits);
+      atomicOr(bitset + bit / 32, 1u << (bit % 32));
+    }
+  }
+}
+
 void EncodeOrcColumnData(device_2dspan<EncChunk const> chunks,
                          device_2dspan<encoder_chunk_streams> streams,
                          rmm::cuda_stream_view stream)
@@ -1295,6 +1349,20 @@ void EncodeStripeDictionaries(StripeDictionary const* stripes,
     <<<dim_grid, dim_block, 0, stream.value()>>>(stripes, chunks, enc_streams);
 }
 
+void EncodeBloomFilters(device_span<orc_column_device_view const> columns,
+                        device_2dspan<rowgroup_rows const> rowgroups,
+                        device_span<uint32_t const> bloom_columns,
+                        uint32_t* bitsets,
+                        uint32_t num_bits,
+                        uint32_t num_hash_functions,
+                        rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 256;
+  dim3 dim_grid(rowgroups.size().first, bloom_columns.size());
+  gpuEncodeBloomFilters<block_size><<<dim_grid, block_size, 0, stream.value()>>>(
+    columns, rowgroups, bloom_columns, bitsets, num_bits, num_hash_functions);
+}
+
 void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
                            device_2dspan<encoder_chunk_streams> enc_streams,
                            rmm::cuda_stream_view stream)
@@ -1348,13 +1416,23 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
       // Since SNAPPY is the default compression (may not be explicitly requested), fall back to
       // writing without compression
     }
-  } else if (compression == ZLIB and
-             nvcomp::is_compression_enabled(nvcomp::compression_type::DEFLATE)) {
-    nvcomp::batched_compress(
-      nvcomp::compression_type::DEFLATE, comp_in, comp_out, comp_res, stream);
+  } else if (compression == ZLIB) {
+    if (nvcomp::is_compression_enabled(nvcomp::compression_type::DEFLATE)) {
+      nvcomp::batched_compress(
+        nvcomp::compression_type::DEFLATE, comp_in, comp_out, comp_res, stream);
+    } else {
+      // ORC ZLIB streams are raw DEFLATE, same as the host ZLIB codec
+      host::batched_compress(compression_type::ZLIB, comp_in, comp_out, comp_res, stream);
+    }
   } else if (compression == ZSTD and
              nvcomp::is_compression_enabled(nvcomp::compression_type::ZSTD)) {
     nvcomp::batched_compress(nvcomp::compression_type::ZSTD, comp_in, comp_out, comp_res, stream);
+  } else if (compression == LZ4) {
+    if (nvcomp::is_compression_enabled(nvcomp::compression_type::LZ4)) {
+      nvcomp::batched_compress(nvcomp::compression_type::LZ4, comp_in, comp_out, comp_res, stream);
+    } else {
+      host::batched_compress(compression_type::LZ4, comp_in, comp_out, comp_res, stream);
+    }
   } else if (compression != NONE) {
     CUDF_FAIL("Unsupported compression type");
   }
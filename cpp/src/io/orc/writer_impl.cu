@@ -21,9 +21,13 @@
 
 #include "writer_impl.hpp"
 
+#include "bloom_filter.hpp"
+
+#include <io/comp/host_codec.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/host_memory.hpp>
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -78,12 +82,6 @@ struct row_group_index_info {
 };
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Translates ORC compression to nvCOMP compression
  */
@@ -92,6 +90,7 @@ auto to_nvcomp_compression_type(CompressionKind compression_kind)
   if (compression_kind == SNAPPY) return nvcomp::compression_type::SNAPPY;
   if (compression_kind == ZLIB) return nvcomp::compression_type::DEFLATE;
   if (compression_kind == ZSTD) return nvcomp::compression_type::ZSTD;
+  if (compression_kind == LZ4) return nvcomp::compression_type::LZ4;
   CUDF_FAIL("Unsupported compression type");
 }
 
@@ -105,6 +104,7 @@ orc::CompressionKind to_orc_compression(compression_type compression)
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
     case compression_type::ZLIB: return orc::CompressionKind::ZLIB;
     case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_FAIL("Unsupported compression type");
   }
@@ -211,6 +211,23 @@ class orc_column_view {
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
+    if (metadata.is_enabled_bloom_filter()) {
+      auto const is_supported_type = [&]() {
+        switch (col.type().id()) {
+          case type_id::INT8:
+          case type_id::INT16:
+          case type_id::INT32:
+          case type_id::INT64:
+          case type_id::FLOAT32:
+          case type_id::FLOAT64:
+          case type_id::STRING: return true;
+          default: return false;
+        }
+      }();
+      CUDF_EXPECTS(parent == nullptr and is_supported_type,
+                   "Bloom filters are not supported for the type of the column");
+      _bloom_filter = true;
+    }
     if (parent != nullptr) {
       parent->add_child(_index);
       _parent_index = parent->index();
@@ -292,6 +309,7 @@ class orc_column_view {
   [[nodiscard]] auto orc_kind() const noexcept { return _type_kind; }
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
+  [[nodiscard]] auto has_bloom_filter() const noexcept { return _bloom_filter; }
 
  private:
   column_view cudf_column;
@@ -323,6 +341,7 @@ class orc_column_view {
   uint32_t* d_decimal_offsets = nullptr;
 
   std::optional<bool> nullable_from_metadata;
+  bool _bloom_filter = false;
   std::vector<uint32_t> children;
   std::optional<uint32_t> _parent_index;
 };
@@ -1379,6 +1398,48 @@ writer::impl::encoded_footer_statistics writer::impl::finish_statistic_blobs(
   return {std::move(stripe_blobs), std::move(file_blobs)};
 }
 
+encoded_bloom_filters build_bloom_filters(orc_table_view const& orc_table,
+                                          file_segmentation const& segmentation,
+                                          size_type row_index_stride,
+                                          rmm::cuda_stream_view stream)
+{
+  encoded_bloom_filters bloom_filters;
+  for (auto const& column : orc_table.columns) {
+    if (column.has_bloom_filter()) { bloom_filters.columns.push_back(column.index()); }
+  }
+  if (bloom_filters.columns.empty() or segmentation.num_rowgroups() == 0) {
+    return bloom_filters;
+  }
+
+  // All filters are sized for a full rowgroup, like in the Apache ORC writer
+  bloom_filters.num_bits = bloom_filter_num_bits(row_index_stride);
+  bloom_filters.num_hash_functions =
+    bloom_filter_num_hash_functions(row_index_stride, bloom_filters.num_bits);
+
+  auto const num_words =
+    segmentation.num_rowgroups() * bloom_filters.columns.size() * (bloom_filters.num_bits / 32);
+  rmm::device_uvector<uint32_t> bitsets(num_words, stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.data(), 0, num_words * sizeof(uint32_t), stream.value()));
+  auto const d_columns = cudf::detail::make_device_uvector_async(bloom_filters.columns, stream);
+  gpu::EncodeBloomFilters(orc_table.d_columns,
+                          segmentation.rowgroups,
+                          d_columns,
+                          bitsets.data(),
+                          bloom_filters.num_bits,
+                          bloom_filters.num_hash_functions,
+                          stream);
+
+  bloom_filters.bitsets.resize(num_words * sizeof(uint32_t));
+  CUDF_CUDA_TRY(cudaMemcpyAsync(bloom_filters.bitsets.data(),
+                                bitsets.data(),
+                                bloom_filters.bitsets.size(),
+                                cudaMemcpyDeviceToHost,
+                                stream.value()));
+  stream.synchronize();
+  return bloom_filters;
+}
+
 void writer::impl::write_index_stream(int32_t stripe_id,
                                       int32_t stream_id,
                                       host_span<orc_column_view const> columns,
@@ -1476,6 +1537,39 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
+void writer::impl::write_bloom_filter_stream(int32_t stripe_id,
+                                             size_t bloom_filter_idx,
+                                             file_segmentation const& segmentation,
+                                             encoded_bloom_filters const& bloom_filters,
+                                             StripeInformation* stripe,
+                                             std::vector<Stream>* bloom_filter_streams,
+                                             ProtobufWriter* pbw)
+{
+  auto const bitset_size = bloom_filters.num_bits / 8;
+
+  BloomFilterIndex index;
+  auto const& rowgroups_range = segmentation.stripes[stripe_id];
+  std::transform(rowgroups_range.cbegin(),
+                 rowgroups_range.cend(),
+                 std::back_inserter(index.bloomFilter),
+                 [&](auto rowgroup) {
+                   auto const bitset =
+                     bloom_filters.bitsets.data() +
+                     (rowgroup * bloom_filters.columns.size() + bloom_filter_idx) * bitset_size;
+                   return BloomFilter{
+                     bloom_filters.num_hash_functions,
+                     std::string(reinterpret_cast<char const*>(bitset), bitset_size)};
+                 });
+
+  buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+  pbw->write(index);
+  add_uncompressed_block_headers(buffer_);
+  out_sink_->host_write(buffer_.data(), buffer_.size());
+  stripe->indexLength += buffer_.size();
+  bloom_filter_streams->push_back(
+    Stream{BLOOM_FILTER_UTF8, bloom_filters.columns[bloom_filter_idx] + 1, buffer_.size()});
+}
+
 std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
                                                   gpu::encoder_chunk_streams const& enc_stream,
                                                   uint8_t const* compressed_data,
@@ -2055,6 +2149,15 @@ __global__ void copy_string_data(char* string_pool,
 size_t max_compression_output_size(CompressionKind compression_kind, uint32_t compression_blocksize)
 {
   if (compression_kind == NONE) return 0;
+  // ZLIB and LZ4 blocks are compressed on the host when nvCOMP cannot compress them
+  if (not nvcomp::is_compression_enabled(to_nvcomp_compression_type(compression_kind))) {
+    if (compression_kind == ZLIB) {
+      return host::compress_max_output_chunk_size(compression_type::ZLIB, compression_blocksize);
+    }
+    if (compression_kind == LZ4) {
+      return host::compress_max_output_chunk_size(compression_type::LZ4, compression_blocksize);
+    }
+  }
 
   return compress_max_output_chunk_size(to_nvcomp_compression_type(compression_kind),
                                         compression_blocksize);
@@ -2213,14 +2316,9 @@ void writer::impl::write(table_view const& table)
       }
 
       if (all_device_write) {
-        return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
+        return cudf::io::detail::pinned_buffer<uint8_t>{};
       } else {
-        return pinned_buffer<uint8_t>{[](size_t size) {
-                                        uint8_t* ptr = nullptr;
-                                        CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                        return ptr;
-                                      }(max_stream_size),
-                                      cudaFreeHost};
+        return cudf::io::detail::make_pinned_buffer<uint8_t>(max_stream_size);
       }
     }();
 
@@ -2251,6 +2349,9 @@ void writer::impl::write(table_view const& table)
 
     auto intermediate_stats = gather_statistic_blobs(stats_freq_, orc_table, segmentation);
 
+    auto const bloom_filters =
+      build_bloom_filters(orc_table, segmentation, row_index_stride, stream);
+
     if (intermediate_stats.stripe_stat_chunks.size() > 0) {
       persisted_stripe_statistics.persist(
         orc_table.num_rows(), single_write_mode, intermediate_stats, stream);
@@ -2278,6 +2379,13 @@ void writer::impl::write(table_view const& table)
                            &pbw_);
       }
 
+      // Bloom filters are also skippable, and follow the row index streams
+      std::vector<Stream> bloom_filter_streams;
+      for (size_t i = 0; i < bloom_filters.columns.size(); ++i) {
+        write_bloom_filter_stream(
+          stripe_id, i, segmentation, bloom_filters, &stripe, &bloom_filter_streams, &pbw_);
+      }
+
       // Column data consisting one or more separate streams
       for (auto const& strm_desc : strm_descs[stripe_id]) {
         write_tasks.push_back(write_data_stream(
@@ -2292,6 +2400,9 @@ void writer::impl::write(table_view const& table)
       // Write stripefooter consisting of stream information
       StripeFooter sf;
       sf.streams = streams;
+      sf.streams.insert(sf.streams.begin() + num_index_streams,
+                        bloom_filter_streams.begin(),
+                        bloom_filter_streams.end());
       sf.columns.resize(orc_table.num_columns() + 1);
       sf.columns[0].kind = DIRECT;
       for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -168,6 +168,16 @@ struct string_dictionaries {
   thrust::host_vector<bool> dictionary_enabled;
 };
 
+/**
+ * @brief Bloom filters of each rowgroup of the columns that have one, in host memory.
+ */
+struct encoded_bloom_filters {
+  std::vector<uint32_t> columns;    // Indices of the columns with a bloom filter
+  std::vector<uint8_t> bitsets;     // Bitsets of the bloom filters [rowgroup][bloom filter column]
+  uint32_t num_bits           = 0;  // Number of bits of each bloom filter
+  uint32_t num_hash_functions = 0;  // Number of hash functions of each bloom filter
+};
+
 /**
  * @brief Maximum size of stripes in the output file.
  */
@@ -396,6 +406,25 @@ class writer::impl {
                           orc_streams* streams,
                           ProtobufWriter* pbw);
 
+  /**
+   * @brief Writes the bloom filter stream of a column.
+   *
+   * @param[in] stripe_id Stripe's identifier
+   * @param[in] bloom_filter_idx Index of the column in `bloom_filters.columns`
+   * @param[in] segmentation stripe and rowgroup ranges
+   * @param[in] bloom_filters Bloom filters of all rowgroups
+   * @param[in,out] stripe Stream's parent stripe
+   * @param[in,out] bloom_filter_streams List of the stripe's bloom filter streams
+   * @param[in,out] pbw Protobuf writer
+   */
+  void write_bloom_filter_stream(int32_t stripe_id,
+                                 size_t bloom_filter_idx,
+                                 file_segmentation const& segmentation,
+                                 encoded_bloom_filters const& bloom_filters,
+                                 StripeInformation* stripe,
+                                 std::vector<Stream>* bloom_filter_streams,
+                                 ProtobufWriter* pbw);
+
   /**
    * @brief Write the specified column's data streams
    *
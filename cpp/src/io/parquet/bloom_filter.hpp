@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+/**
+ * Split block bloom filters, as specified by the Parquet format: the bitset is made of 256-bit
+ * blocks, and each value sets one bit in each of the eight 32-bit words of a single block.
+ */
+
+constexpr uint32_t bloom_filter_block_words  = 8;  //!< Number of 32-bit words in a block
+constexpr uint32_t bloom_filter_block_bytes  = bloom_filter_block_words * sizeof(uint32_t);
+constexpr std::size_t bloom_filter_min_bytes = bloom_filter_block_bytes;
+constexpr std::size_t bloom_filter_max_bytes = 128 * 1024 * 1024;
+constexpr double bloom_filter_fpp            = 0.01;  //!< Target false positive probability
+
+namespace xxhash {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+CUDF_HOST_DEVICE inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+CUDF_HOST_DEVICE inline uint64_t load64(uint8_t const* p)
+{
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; --i) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+CUDF_HOST_DEVICE inline uint32_t load32(uint8_t const* p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+CUDF_HOST_DEVICE inline uint64_t round_step(uint64_t acc, uint64_t input)
+{
+  acc += input * prime2;
+  return rotl64(acc, 31) * prime1;
+}
+
+CUDF_HOST_DEVICE inline uint64_t merge_step(uint64_t acc, uint64_t val)
+{
+  acc ^= round_step(0, val);
+  return acc * prime1 + prime4;
+}
+
+}  // namespace xxhash
+
+/**
+ * @brief Computes the 64-bit xxHash of a byte sequence with a zero seed, as used by Parquet bloom
+ * filters
+ */
+CUDF_HOST_DEVICE inline uint64_t xxhash64(uint8_t const* data, std::size_t len)
+{
+  using namespace xxhash;
+  uint8_t const* p   = data;
+  uint8_t const* end = data + len;
+  uint64_t h;
+  if (len >= 32) {
+    uint64_t v1 = prime1 + prime2;
+    uint64_t v2 = prime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - prime1;
+    do {
+      v1 = round_step(v1, load64(p));
+      v2 = round_step(v2, load64(p + 8));
+      v3 = round_step(v3, load64(p + 16));
+      v4 = round_step(v4, load64(p + 24));
+      p += 32;
+    } while (p + 32 <= end);
+    h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+    h = merge_step(h, v1);
+    h = merge_step(h, v2);
+    h = merge_step(h, v3);
+    h = merge_step(h, v4);
+  } else {
+    h = prime5;
+  }
+  h += len;
+  for (; p + 8 <= end; p += 8) {
+    h ^= round_step(0, load64(p));
+    h = rotl64(h, 27) * prime1 + prime4;
+  }
+  if (p + 4 <= end) {
+    h ^= load32(p) * prime1;
+    h = rotl64(h, 23) * prime2 + prime3;
+    p += 4;
+  }
+  for (; p < end; ++p) {
+    h ^= *p * prime5;
+    h = rotl64(h, 11) * prime1;
+  }
+  h ^= h >> 33;
+  h *= prime2;
+  h ^= h >> 29;
+  h *= prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+/**
+ * @brief Computes the xxHash of the PLAIN encoding of a fixed-width value
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline uint64_t xxhash64(T value)
+{
+  uint8_t bytes[sizeof(T)];
+  memcpy(bytes, &value, sizeof(T));
+  return xxhash64(bytes, sizeof(T));
+}
+
+/**
+ * @brief Returns the index of the block of the bloom filter that holds the bits of a hash
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_block_index(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit that a hash sets in the `i`-th word of its block
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_word_mask(uint64_t hash, uint32_t i)
+{
+  constexpr uint32_t salt[bloom_filter_block_words] = {0x47b6137bu,
+                                                       0x44974d91u,
+                                                       0x8824ad5bu,
+                                                       0xa2b7289du,
+                                                       0x705495c7u,
+                                                       0x2df1424bu,
+                                                       0x9efc4947u,
+                                                       0x5c6bfb31u};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[i]) >> 27);
+}
+
+/**
+ * @brief Returns whether the value with the given hash may have been inserted in the bloom filter
+ *
+ * @param bitset Bloom filter bitset, as stored in the file
+ * @param num_blocks Number of blocks in the bitset
+ * @param hash xxHash of the PLAIN encoding of the value
+ */
+inline bool bloom_filter_may_contain(uint8_t const* bitset, uint32_t num_blocks, uint64_t hash)
+{
+  auto const block =
+    bitset + bloom_filter_block_index(hash, num_blocks) * bloom_filter_block_bytes;
+  for (uint32_t i = 0; i < bloom_filter_block_words; ++i) {
+    auto const word = xxhash::load32(block + i * sizeof(uint32_t));
+    if ((word & bloom_filter_word_mask(hash, i)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the size of the bloom filter bitset for a column chunk, in bytes
+ *
+ * The size is a power of two that achieves the target false positive probability for the given
+ * number of distinct values, clamped to the range allowed by the Parquet format.
+ *
+ * @param num_distinct Upper bound of the number of distinct values in the column chunk
+ */
+inline std::size_t bloom_filter_size(std::size_t num_distinct)
+{
+  auto const num_bits =
+    -8.0 * num_distinct / std::log(1.0 - std::pow(bloom_filter_fpp, 1.0 / 8.0));
+  auto const num_bytes = static_cast<std::size_t>(num_bits / 8);
+  std::size_t size     = bloom_filter_min_bytes;
+  while (size < num_bytes and size < bloom_filter_max_bytes) {
+    size *= 2;
+  }
+  return size;
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
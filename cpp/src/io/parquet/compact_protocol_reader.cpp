@@ -245,7 +245,9 @@ bool CompactProtocolReader::read(ColumnChunkMetaData* c)
                             ParquetFieldInt64(9, c->data_page_offset),
                             ParquetFieldInt64(10, c->index_page_offset),
                             ParquetFieldInt64(11, c->dictionary_page_offset),
-                            ParquetFieldStructBlob(12, c->statistics_blob));
+                            ParquetFieldStructBlob(12, c->statistics_blob),
+                            ParquetFieldInt64(14, c->bloom_filter_offset),
+                            ParquetFieldInt32(15, c->bloom_filter_length));
   return function_builder(this, op);
 }
 
@@ -316,6 +318,33 @@ bool CompactProtocolReader::read(Statistics* s)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(BloomFilterAlgorithm* a)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, a->isset.BLOCK, a->BLOCK));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHash* h)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, h->isset.XXHASH, h->XXHASH));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterCompression* c)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, c->isset.UNCOMPRESSED, c->UNCOMPRESSED));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHeader* h)
+{
+  auto op = std::make_tuple(ParquetFieldInt32(1, h->num_bytes),
+                            ParquetFieldStruct(2, h->algorithm),
+                            ParquetFieldStruct(3, h->hash),
+                            ParquetFieldStruct(4, h->compression));
+  return function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -119,6 +119,10 @@ class CompactProtocolReader {
   bool read(OffsetIndex* o);
   bool read(ColumnIndex* c);
   bool read(Statistics* s);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* h);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -202,6 +202,10 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_length != 0) {
+    c.field_int(14, s.bloom_filter_offset);
+    c.field_int(15, s.bloom_filter_length);
+  }
   return c.value();
 }
 
@@ -221,6 +225,37 @@ size_t CompactProtocolWriter::write(const OffsetIndex& s)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm& algorithm)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (algorithm.isset.BLOCK) { c.field_struct(1, algorithm.BLOCK); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash& hash)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (hash.isset.XXHASH) { c.field_struct(1, hash.XXHASH); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression& compression)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (compression.isset.UNCOMPRESSED) { c.field_struct(1, compression.UNCOMPRESSED); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader& header)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, header.num_bytes);
+  c.field_struct(2, header.algorithm);
+  c.field_struct(3, header.hash);
+  c.field_struct(4, header.compression);
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(const uint8_t* raw, uint32_t len)
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "footer.hpp"
+
+#include "compact_protocol_reader.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+namespace {
+
+/**
+ * @brief Identifies a version of a file; the footer of a file that has been rewritten is not reused
+ */
+struct file_version {
+  std::uintmax_t size;
+  std::filesystem::file_time_type last_write_time;
+
+  bool operator==(file_version const& other) const
+  {
+    return size == other.size && last_write_time == other.last_write_time;
+  }
+};
+
+/**
+ * @brief Returns the current version of the file, or nothing if it cannot be queried
+ */
+std::optional<file_version> get_file_version(std::string const& filepath)
+{
+  std::error_code ec;
+  auto const size = std::filesystem::file_size(filepath, ec);
+  if (ec) { return std::nullopt; }
+  auto const last_write_time = std::filesystem::last_write_time(filepath, ec);
+  if (ec) { return std::nullopt; }
+  return file_version{size, last_write_time};
+}
+
+/**
+ * @brief Process-wide LRU cache of parsed footers, keyed by file path
+ */
+class footer_cache {
+  struct entry {
+    std::string filepath;
+    file_version version;
+    std::shared_ptr<FileMetaData const> footer;
+  };
+
+ public:
+  footer_cache()
+    : _capacity(cudf::io::detail::getenv_or<std::size_t>("LIBCUDF_PARQUET_FOOTER_CACHE_SIZE", 0))
+  {
+  }
+
+  std::shared_ptr<FileMetaData const> find(std::string const& filepath,
+                                           file_version const& version)
+  {
+    std::lock_guard lock(_mutex);
+    auto const it = _index.find(filepath);
+    if (it == _index.end()) { return nullptr; }
+    if (not(it->second->version == version)) {
+      // The file has changed since its footer was cached
+      _entries.erase(it->second);
+      _index.erase(it);
+      return nullptr;
+    }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->footer;
+  }
+
+  void insert(std::string const& filepath,
+              file_version const& version,
+              std::shared_ptr<FileMetaData const> footer)
+  {
+    std::lock_guard lock(_mutex);
+    if (_capacity == 0) { return; }
+    if (auto const it = _index.find(filepath); it != _index.end()) {
+      _entries.erase(it->second);
+      _index.erase(it);
+    }
+    _entries.push_front({filepath, version, std::move(footer)});
+    _index[filepath] = _entries.begin();
+    evict();
+  }
+
+  void set_capacity(std::size_t capacity)
+  {
+    std::lock_guard lock(_mutex);
+    _capacity = capacity;
+    evict();
+  }
+
+  [[nodiscard]] std::size_t capacity()
+  {
+    std::lock_guard lock(_mutex);
+    return _capacity;
+  }
+
+  [[nodiscard]] bool is_enabled() { return capacity() != 0; }
+
+ private:
+  void evict()
+  {
+    while (_entries.size() > _capacity) {
+      _index.erase(_entries.back().filepath);
+      _entries.pop_back();
+    }
+  }
+
+  std::mutex _mutex;
+  std::size_t _capacity;
+  std::list<entry> _entries;  // Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+};
+
+footer_cache& get_footer_cache()
+{
+  static footer_cache cache;
+  return cache;
+}
+
+/**
+ * @brief Reads the footer from the end of the source and decodes it
+ */
+std::shared_ptr<FileMetaData const> parse_footer(datasource* source)
+{
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len = source->size();
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  const auto header_buffer = source->host_read(0, header_len);
+  const auto header        = reinterpret_cast<const file_header_s*>(header_buffer->data());
+  const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
+  const auto ender         = reinterpret_cast<const file_ender_s*>(ender_buffer->data());
+  CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  auto footer       = std::make_shared<FileMetaData>();
+  const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  CUDF_EXPECTS(cp.read(footer.get()), "Cannot parse metadata");
+  CUDF_EXPECTS(cp.InitSchema(footer.get()), "Cannot initialize schema");
+  return footer;
+}
+
+}  // namespace
+
+std::shared_ptr<FileMetaData const> read_footer(datasource* source, std::string const& filepath)
+{
+  auto& cache = get_footer_cache();
+  if (filepath.empty() or not cache.is_enabled()) { return parse_footer(source); }
+
+  auto const version = get_file_version(filepath);
+  if (not version.has_value() or version->size != source->size()) { return parse_footer(source); }
+
+  if (auto cached = cache.find(filepath, *version); cached != nullptr) { return cached; }
+  auto footer = parse_footer(source);
+  cache.insert(filepath, *version, footer);
+  return footer;
+}
+
+void set_footer_cache_capacity(std::size_t num_footers)
+{
+  get_footer_cache().set_capacity(num_footers);
+}
+
+std::size_t get_footer_cache_capacity() { return get_footer_cache().capacity(); }
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <cudf/io/datasource.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+
+/**
+ * @brief Reads and parses the footer of a Parquet data source
+ *
+ * When `filepath` is not empty and the footer cache is enabled, the parsed footer is looked up in
+ * the process-wide footer cache first. Cache entries are keyed by the path, size and modification
+ * time of the file, so a file that has been rewritten since its footer was cached is parsed again.
+ *
+ * @param source Data source to read the footer from
+ * @param filepath Path of the file behind `source`, or empty if the source is not a file
+ *
+ * @return The parsed footer, with an initialized schema tree
+ */
+std::shared_ptr<FileMetaData const> read_footer(datasource* source, std::string const& filepath);
+
+/**
+ * @brief Sets the maximum number of footers held by the footer cache
+ *
+ * Least recently used footers are evicted when the cache is full. A capacity of zero disables
+ * the cache and drops all cached footers.
+ *
+ * @param num_footers Maximum number of cached footers
+ */
+void set_footer_cache_capacity(std::size_t num_footers);
+
+/**
+ * @brief Returns the maximum number of footers held by the footer cache
+ */
+std::size_t get_footer_cache_capacity();
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -24,8 +24,13 @@
 #include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/cub.cuh>
+
+#include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_categories.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -853,7 +858,16 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
     // our starting row (absolute index) is
     // col.start_row == absolute row index
     // page.chunk-row == relative row index within the chunk
-    size_t page_start_row = s->col.start_row + s->page.chunk_row;
+    // the first page of a row range can start before the range, and before the first output row
+    int64_t const page_start_row =
+      static_cast<int64_t>(s->col.start_row) + s->page.chunk_row - s->col.row_range_offset;
+
+    // rows to output, the pages of a row range can hold rows of other ranges
+    auto const begin_row = static_cast<int64_t>(
+      s->col.is_row_range ? max(min_row, s->col.start_row) : min_row);
+    auto const end_row = static_cast<int64_t>(
+      s->col.is_row_range ? min(min_row + num_rows, s->col.start_row + s->col.num_rows)
+                          : min_row + num_rows);
 
     // IMPORTANT : nested schemas can have 0 rows in a page but still have
     // values. The case is:
@@ -915,16 +929,15 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       }
 
       // first row within the page to output
-      if (page_start_row >= min_row) {
+      if (page_start_row >= begin_row) {
         s->first_row = 0;
       } else {
-        s->first_row = (int32_t)min(min_row - page_start_row, (size_t)s->page.num_rows);
+        s->first_row = (int32_t)min(begin_row - page_start_row, (int64_t)s->page.num_rows);
       }
       // # of rows within the page to output
       s->num_rows = s->page.num_rows;
-      if ((page_start_row + s->first_row) + s->num_rows > min_row + num_rows) {
-        s->num_rows =
-          (int32_t)max((int64_t)(min_row + num_rows - (page_start_row + s->first_row)), INT64_C(0));
+      if ((page_start_row + s->first_row) + s->num_rows > end_row) {
+        s->num_rows = (int32_t)max(end_row - (page_start_row + s->first_row), INT64_C(0));
       }
 
       // during the decoding step we need to offset the global output buffers
@@ -940,7 +953,8 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
           size_t output_offset;
           // schemas without lists
           if (s->col.max_level[level_type::REPETITION] == 0) {
-            output_offset = page_start_row >= min_row ? page_start_row - min_row : 0;
+            auto const first_row = page_start_row + s->first_row;
+            output_offset = first_row >= static_cast<int64_t>(min_row) ? first_row - min_row : 0;
           }
           // for schemas with lists, we've already got the exactly value precomputed
           else {
@@ -1044,7 +1058,7 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       // previous row is within the overall row bounds, include the values by allowing relative row
       // index -1
       int const max_row = (min_row + num_rows) - 1;
-      if (min_row < page_start_row && max_row >= page_start_row - 1) {
+      if (static_cast<int64_t>(min_row) < page_start_row && max_row >= page_start_row - 1) {
         s->row_index_lower_bound = -1;
       } else {
         s->row_index_lower_bound = s->first_row;
@@ -1681,6 +1695,528 @@ __global__ void __launch_bounds__(block_size) gpuDecodePageData(
   }
 }
 
+/**
+ * @brief Read a 64-bit ULEB128 varint
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ */
+inline __device__ uint64_t get_uleb64(const uint8_t*& cur, const uint8_t* end)
+{
+  uint64_t v = 0;
+  for (int shift = 0; cur < end && shift < 64; shift += 7) {
+    uint64_t const c = *cur++;
+    v |= (c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Read a 64-bit zigzag encoded varint
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ */
+inline __device__ int64_t get_zigzag64(const uint8_t*& cur, const uint8_t* end)
+{
+  uint64_t const u = get_uleb64(cur, end);
+  return static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+}
+
+inline __device__ bool is_expanded_encoding(Encoding encoding)
+{
+  return encoding == Encoding::DELTA_BINARY_PACKED ||
+         encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY || encoding == Encoding::DELTA_BYTE_ARRAY ||
+         encoding == Encoding::BYTE_STREAM_SPLIT;
+}
+
+/**
+ * @brief Returns the end of a DELTA_BINARY_PACKED stream by walking its block headers
+ *
+ * @param[in] cur Start of the stream
+ * @param[in] end End of the page data
+ *
+ * @return The end of the stream, or nullptr if the stream is malformed
+ */
+__device__ const uint8_t* delta_binary_end(const uint8_t* cur, const uint8_t* end)
+{
+  uint64_t const block_size  = get_uleb64(cur, end);
+  uint64_t const mini_blocks = get_uleb64(cur, end);
+  uint64_t const value_count = get_uleb64(cur, end);
+  get_zigzag64(cur, end);  // first value
+  if (mini_blocks == 0 || block_size % mini_blocks != 0) { return nullptr; }
+  uint64_t const values_per_mb = block_size / mini_blocks;
+
+  // blocks hold the deltas of values [pos, pos + block_size)
+  for (uint64_t pos = 1; pos < value_count && cur < end; pos += block_size) {
+    get_zigzag64(cur, end);  // min delta
+    const uint8_t* widths = cur;
+    cur += mini_blocks;
+    if (cur > end) { return nullptr; }
+    // mini blocks past the last value are not stored
+    uint64_t const num_mbs =
+      min(mini_blocks, (value_count - pos + values_per_mb - 1) / values_per_mb);
+    for (uint64_t mb = 0; mb < num_mbs; mb++) {
+      cur += values_per_mb * widths[mb] / 8;
+    }
+  }
+  return (cur <= end) ? cur : nullptr;
+}
+
+constexpr int max_delta_mini_blocks = 64;
+using delta_block_scan              = cub::BlockScan<uint64_t, block_size>;
+
+/**
+ * @brief Block-wide decoder of a DELTA_BINARY_PACKED stream
+ *
+ * The values are decoded in tiles: the first tile holds the first value of the stream, and each
+ * subsequent tile holds the values of the next `block_size` deltas. Since the number of values
+ * in an encoded block is a multiple of 128, a tile never spans two encoded blocks.
+ */
+struct delta_binary_decoder {
+  const uint8_t* block_start;  // start of the next block header
+  const uint8_t* end;          // end of the page data
+  uint32_t block_size;         // number of values in a block
+  uint32_t mini_block_count;   // number of mini blocks in a block
+  uint32_t values_per_mb;      // number of values in a mini block
+  uint32_t value_count;        // total number of values in the stream
+  uint32_t values_decoded;     // number of values returned by the previous tiles
+  uint32_t tile_start;         // index of the first value of the current tile
+  uint32_t tile_size;          // number of values in the current tile
+  int32_t error;
+  int64_t first_value;
+  int64_t last_value;  // last value of the previous tile
+  int64_t min_delta;   // min delta of the current block
+  const uint8_t* mb_start[max_delta_mini_blocks];
+  uint8_t mb_width[max_delta_mini_blocks];
+
+  /**
+   * @brief Parses the stream header; called by a single thread
+   *
+   * @return false if the header is invalid or not supported
+   */
+  __device__ bool init(const uint8_t* start, const uint8_t* page_end)
+  {
+    const uint8_t* cur = start;
+    end                = page_end;
+    block_size         = get_uleb64(cur, end);
+    mini_block_count   = get_uleb64(cur, end);
+    value_count        = get_uleb64(cur, end);
+    first_value        = get_zigzag64(cur, end);
+    last_value         = first_value;
+    block_start        = cur;
+    values_decoded     = 0;
+    tile_start         = 0;
+    tile_size          = 0;
+    error              = 0;
+    if (mini_block_count == 0 || mini_block_count > max_delta_mini_blocks ||
+        block_size % ::block_size != 0 || block_size % mini_block_count != 0) {
+      error = 1;
+      return false;
+    }
+    values_per_mb = block_size / mini_block_count;
+    if (values_per_mb % 32 != 0 || cur > end) { error = 1; }
+    return error == 0;
+  }
+
+  /**
+   * @brief Parses the header of the block starting at `block_start`; called by a single thread
+   */
+  __device__ bool setup_block()
+  {
+    const uint8_t* cur = block_start;
+    min_delta          = get_zigzag64(cur, end);
+    if (cur + mini_block_count > end) { return false; }
+    // mini blocks past the last value are not stored
+    uint32_t const remaining = value_count - values_decoded;
+    uint32_t const num_mbs = min(mini_block_count, (remaining + values_per_mb - 1) / values_per_mb);
+    const uint8_t* data    = cur + mini_block_count;
+    for (uint32_t mb = 0; mb < num_mbs; mb++) {
+      mb_width[mb] = cur[mb];
+      mb_start[mb] = data;
+      if (mb_width[mb] > 64) { return false; }
+      data += values_per_mb * mb_width[mb] / 8;
+    }
+    block_start = data;
+    return data <= end;
+  }
+
+  /**
+   * @brief Unpacks the delta at index `idx` of a mini block
+   */
+  __device__ uint64_t unpack(int mb, uint32_t idx) const
+  {
+    uint32_t const width = mb_width[mb];
+    if (width == 0) { return 0; }
+    uint64_t const bit = static_cast<uint64_t>(idx) * width;
+    const uint8_t* p   = mb_start[mb] + (bit >> 3);
+    int shift          = -static_cast<int>(bit & 7);
+    uint64_t v         = 0;
+    for (; shift < static_cast<int>(width); shift += 8, p++) {
+      uint64_t const byte = (p < end) ? *p : 0;
+      v |= (shift >= 0) ? (byte << shift) : (byte >> -shift);
+    }
+    return (width < 64) ? (v & ((uint64_t{1} << width) - 1)) : v;
+  }
+
+  /**
+   * @brief Decodes the next tile of values; must be called by all the threads of the block
+   *
+   * @param[in] t Thread ID
+   * @param[in] scan_storage Temporary storage for the block-wide prefix sum of the deltas
+   *
+   * @return The value at index `tile_start + t` of the stream, valid if `t < tile_size`
+   */
+  __device__ int64_t decode_tile(int t, delta_block_scan::TempStorage& scan_storage)
+  {
+    __syncthreads();
+    if (t == 0) {
+      tile_start = values_decoded;
+      tile_size  = (values_decoded == 0) ? min(value_count, 1u)
+                                         : min(static_cast<uint32_t>(::block_size),
+                                              value_count - values_decoded);
+      // the first delta of an encoded block starts a new tile
+      if (values_decoded > 0 && tile_size > 0 && (values_decoded - 1) % block_size == 0 &&
+          !setup_block()) {
+        error     = 1;
+        tile_size = 0;
+      }
+      values_decoded += tile_size;
+    }
+    __syncthreads();
+    if (tile_start == 0) { return first_value; }
+
+    uint64_t delta = 0;
+    if (t < tile_size) {
+      uint32_t const idx = (tile_start - 1 + t) % block_size;
+      delta = static_cast<uint64_t>(min_delta) + unpack(idx / values_per_mb, idx % values_per_mb);
+    }
+    uint64_t sum;
+    delta_block_scan(scan_storage).InclusiveSum(delta, sum);
+    auto const value = static_cast<int64_t>(static_cast<uint64_t>(last_value) + sum);
+    __syncthreads();
+    if (t == tile_size - 1) { last_value = value; }
+    __syncthreads();
+    return value;
+  }
+};
+
+/**
+ * @brief Shared state of the expansion of a DELTA encoded page into PLAIN encoding
+ */
+struct delta_page_state_s {
+  delta_binary_decoder decoders[2];
+  delta_block_scan::TempStorage scan_storage;
+  const uint8_t* values_start;  // start of the encoded values, after the level sections
+  const uint8_t* data;          // start of the byte array data
+  const uint8_t* end;           // end of the page data
+  uint8_t* out;                 // output position of the PLAIN encoded values
+  uint64_t data_pos;            // bytes of byte array data consumed
+  uint64_t out_pos;             // bytes of PLAIN encoded values
+  uint8_t* prev_value;          // output position of the previous byte array
+  uint32_t prev_len;            // length of the previous byte array
+  int32_t level_bytes;          // size of the level sections
+  int32_t error;
+  uint8_t* tile_values[block_size];
+  uint32_t tile_prefix[block_size];
+  uint32_t tile_len[block_size];
+};
+
+inline __device__ void write_byte_array_length(uint8_t* dst, uint32_t len)
+{
+  dst[0] = len;
+  dst[1] = len >> 8;
+  dst[2] = len >> 16;
+  dst[3] = len >> 24;
+}
+
+/**
+ * @brief Expands DELTA_BINARY_PACKED INT32/INT64 values
+ */
+template <bool write_output>
+__device__ void gpuExpandDeltaBinaryPacked(page_state_s* s, delta_page_state_s* ds, int t)
+{
+  auto& values           = ds->decoders[0];
+  auto const physical    = s->col.data_type & 7;
+  uint32_t const val_len = (physical == INT32) ? 4 : 8;
+  if (!t) {
+    if ((physical != INT32 && physical != INT64) || !values.init(ds->values_start, ds->end)) {
+      ds->error = 1;
+    }
+  }
+  __syncthreads();
+  if (ds->error) { return; }
+
+  while (true) {
+    auto const value = values.decode_tile(t, ds->scan_storage);
+    if (values.tile_size == 0) { break; }
+    if (write_output && t < values.tile_size) {
+      // little-endian, truncated to the physical type
+      memcpy(ds->out + static_cast<size_t>(values.tile_start + t) * val_len, &value, val_len);
+    }
+  }
+  if (!t) {
+    ds->out_pos = static_cast<uint64_t>(values.values_decoded) * val_len;
+    if (values.error) { ds->error = 1; }
+  }
+}
+
+/**
+ * @brief Expands DELTA_LENGTH_BYTE_ARRAY values into length-prefixed byte arrays
+ */
+template <bool write_output>
+__device__ void gpuExpandDeltaLengthByteArray(page_state_s* s, delta_page_state_s* ds, int t)
+{
+  auto& lengths = ds->decoders[0];
+  if (!t) {
+    ds->data = delta_binary_end(ds->values_start, ds->end);
+    if ((s->col.data_type & 7) != BYTE_ARRAY || ds->data == nullptr ||
+        !lengths.init(ds->values_start, ds->end)) {
+      ds->error = 1;
+    }
+  }
+  __syncthreads();
+  if (ds->error) { return; }
+
+  while (true) {
+    auto const len = lengths.decode_tile(t, ds->scan_storage);
+    if (lengths.tile_size == 0) { break; }
+    uint64_t const value_len = (t < lengths.tile_size) ? static_cast<uint64_t>(len) : 0;
+    uint64_t offset, tile_bytes;
+    delta_block_scan(ds->scan_storage).ExclusiveSum(value_len, offset, tile_bytes);
+    if (t < lengths.tile_size) {
+      const uint8_t* src = ds->data + ds->data_pos + offset;
+      if (len < 0 || len > INT32_MAX || src + value_len > ds->end) {
+        ds->error = 1;
+      } else if (write_output) {
+        uint8_t* dst =
+          ds->out + 4 * static_cast<size_t>(lengths.tile_start + t) + ds->data_pos + offset;
+        write_byte_array_length(dst, value_len);
+        memcpy(dst + 4, src, value_len);
+      }
+    }
+    __syncthreads();
+    if (!t) { ds->data_pos += tile_bytes; }
+  }
+  if (!t) {
+    ds->out_pos = 4 * static_cast<uint64_t>(lengths.values_decoded) + ds->data_pos;
+    if (lengths.error) { ds->error = 1; }
+  }
+}
+
+/**
+ * @brief Expands DELTA_BYTE_ARRAY values into length-prefixed (BYTE_ARRAY) or fixed-length
+ * (FIXED_LEN_BYTE_ARRAY) byte arrays
+ *
+ * The suffixes of all the values of a tile are written in parallel, then the prefixes shared with
+ * the previous values are copied in order by a single warp.
+ */
+template <bool write_output>
+__device__ void gpuExpandDeltaByteArray(page_state_s* s, delta_page_state_s* ds, int t)
+{
+  auto& prefixes        = ds->decoders[0];
+  auto& suffixes        = ds->decoders[1];
+  bool const has_length = (s->col.data_type & 7) == BYTE_ARRAY;
+  if (!t) {
+    const uint8_t* suffixes_start = delta_binary_end(ds->values_start, ds->end);
+    ds->data = suffixes_start ? delta_binary_end(suffixes_start, ds->end) : nullptr;
+    if ((!has_length && (s->col.data_type & 7) != FIXED_LEN_BYTE_ARRAY) || ds->data == nullptr ||
+        !prefixes.init(ds->values_start, ds->end) || !suffixes.init(suffixes_start, ds->end) ||
+        prefixes.value_count != suffixes.value_count) {
+      ds->error = 1;
+    }
+    ds->prev_value = nullptr;
+    ds->prev_len   = 0;
+  }
+  __syncthreads();
+  if (ds->error) { return; }
+
+  while (true) {
+    auto const prefix_len = prefixes.decode_tile(t, ds->scan_storage);
+    auto const suffix_len = suffixes.decode_tile(t, ds->scan_storage);
+    uint32_t const tile_size = prefixes.tile_size;
+    if (tile_size == 0 || suffixes.tile_size != tile_size) { break; }
+
+    bool const is_valid = t < tile_size && prefix_len >= 0 && suffix_len >= 0 &&
+                          prefix_len + suffix_len <= INT32_MAX;
+    uint64_t const suffix_bytes = is_valid ? suffix_len : 0;
+    uint64_t const value_bytes  = is_valid ? prefix_len + suffix_len : 0;
+    uint64_t src_offset, tile_src_bytes, dst_offset, tile_dst_bytes;
+    delta_block_scan(ds->scan_storage).ExclusiveSum(suffix_bytes, src_offset, tile_src_bytes);
+    __syncthreads();
+    delta_block_scan(ds->scan_storage).ExclusiveSum(value_bytes, dst_offset, tile_dst_bytes);
+
+    if (t < tile_size) {
+      const uint8_t* src = ds->data + ds->data_pos + src_offset;
+      if (!is_valid || src + suffix_bytes > ds->end) { ds->error = 1; }
+      uint8_t* value = nullptr;
+      if (write_output) {
+        uint8_t* dst = ds->out + ds->out_pos + (has_length ? 4 * t : 0) + dst_offset;
+        if (has_length) { write_byte_array_length(dst, value_bytes); }
+        value = has_length ? dst + 4 : dst;
+        if (is_valid && src + suffix_bytes <= ds->end) {
+          memcpy(value + prefix_len, src, suffix_bytes);
+        }
+      }
+      ds->tile_values[t] = value;
+      ds->tile_prefix[t] = is_valid ? prefix_len : 0;
+      ds->tile_len[t]    = value_bytes;
+    }
+    __syncthreads();
+    if (t < tile_size) {
+      uint32_t const prev_len = (t == 0) ? ds->prev_len : ds->tile_len[t - 1];
+      if (ds->tile_prefix[t] > prev_len) { ds->error = 1; }
+    }
+    if (write_output && t < 32) {
+      // the prefix of each value is copied from the previous value, so the values are completed
+      // in order
+      for (uint32_t i = 0; i < tile_size; i++) {
+        const uint8_t* prev     = (i == 0) ? ds->prev_value : ds->tile_values[i - 1];
+        uint32_t const prev_len = (i == 0) ? ds->prev_len : ds->tile_len[i - 1];
+        uint32_t const prefix   = min(ds->tile_prefix[i], prev_len);
+        for (uint32_t j = t; j < prefix; j += 32) {
+          ds->tile_values[i][j] = prev[j];
+        }
+        __syncwarp();
+      }
+    }
+    __syncthreads();
+    if (!t) {
+      ds->data_pos += tile_src_bytes;
+      ds->out_pos += tile_dst_bytes + (has_length ? 4 * tile_size : 0);
+      ds->prev_value = ds->tile_values[tile_size - 1];
+      ds->prev_len   = ds->tile_len[tile_size - 1];
+    }
+  }
+  if (!t) {
+    if (prefixes.error || suffixes.error || prefixes.values_decoded != prefixes.value_count) {
+      ds->error = 1;
+    }
+  }
+}
+
+/**
+ * @brief Expands BYTE_STREAM_SPLIT FLOAT/DOUBLE/INT32/INT64 values
+ *
+ * The k-th byte of every value is stored in the k-th of `val_len` consecutive streams, so the
+ * expansion is a transpose of a `val_len` x `num_values` byte matrix.
+ */
+template <bool write_output>
+__device__ void gpuExpandByteStreamSplit(page_state_s* s, delta_page_state_s* ds, int t)
+{
+  auto const physical     = s->col.data_type & 7;
+  uint32_t const val_len  = (physical == FLOAT || physical == INT32) ? 4 : 8;
+  uint64_t const data_len = ds->end - ds->values_start;
+  if (!t) {
+    if ((physical != FLOAT && physical != DOUBLE && physical != INT32 && physical != INT64) ||
+        data_len % val_len != 0) {
+      ds->error = 1;
+    }
+    ds->out_pos = data_len;
+  }
+  __syncthreads();
+  if (ds->error || !write_output) { return; }
+
+  uint64_t const num_values = data_len / val_len;
+  for (uint64_t i = t; i < num_values; i += block_size) {
+    for (uint32_t k = 0; k < val_len; k++) {
+      ds->out[i * val_len + k] = ds->values_start[k * num_values + i];
+    }
+  }
+}
+
+/**
+ * @brief Kernel for expanding the values of DELTA and BYTE_STREAM_SPLIT encoded data pages into
+ * PLAIN encoding
+ *
+ * The level sections of the pages are copied as they are, so that the expanded pages can be
+ * decoded like any other PLAIN encoded page. Pages using other encodings are left untouched.
+ *
+ * @param pages List of pages
+ * @param chunks List of column chunks
+ * @param page_sizes Per-page size of the expanded page, computed when `write_output` is false
+ * @param page_offsets Per-page output offset of the expanded page, used when `write_output` is
+ * true
+ * @param output Output buffer of the expanded pages
+ * @param error Set to a non-zero value if a page is malformed
+ */
+template <bool write_output>
+__global__ void __launch_bounds__(block_size)
+  gpuExpandEncodedPages(PageInfo* pages,
+                        device_span<ColumnChunkDesc const> chunks,
+                        size_t* page_sizes,
+                        size_t const* page_offsets,
+                        uint8_t* output,
+                        int32_t* error)
+{
+  __shared__ __align__(16) page_state_s state_g;
+  __shared__ __align__(16) delta_page_state_s delta_state_g;
+
+  page_state_s* const s        = &state_g;
+  delta_page_state_s* const ds = &delta_state_g;
+  PageInfo* const pp           = &pages[blockIdx.x];
+  int const t                  = threadIdx.x;
+
+  if ((pp->flags & PAGEINFO_FLAGS_DICTIONARY) || !is_expanded_encoding(pp->encoding)) { return; }
+
+  if (!t) {
+    s->page  = *pp;
+    s->col   = chunks[s->page.chunk_idx];
+    s->error = 0;
+
+    const uint8_t* cur = s->page.page_data;
+    const uint8_t* end = cur + s->page.uncompressed_page_size;
+    cur += InitLevelSection(s, cur, end, level_type::REPETITION);
+    cur += InitLevelSection(s, cur, end, level_type::DEFINITION);
+
+    ds->error        = (s->error != 0 || cur > end);
+    ds->level_bytes  = static_cast<int32_t>(cur - s->page.page_data);
+    ds->values_start = cur;
+    ds->end          = end;
+    ds->data_pos     = 0;
+    ds->out_pos      = 0;
+    ds->out = write_output ? output + page_offsets[blockIdx.x] + ds->level_bytes : nullptr;
+  }
+  __syncthreads();
+  if (ds->error) {
+    if (!t) { *error = 1; }
+    return;
+  }
+
+  if (write_output) {
+    for (int i = t; i < ds->level_bytes; i += block_size) {
+      output[page_offsets[blockIdx.x] + i] = s->page.page_data[i];
+    }
+  }
+
+  switch (s->page.encoding) {
+    case Encoding::DELTA_BINARY_PACKED: gpuExpandDeltaBinaryPacked<write_output>(s, ds, t); break;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      gpuExpandDeltaLengthByteArray<write_output>(s, ds, t);
+      break;
+    case Encoding::DELTA_BYTE_ARRAY: gpuExpandDeltaByteArray<write_output>(s, ds, t); break;
+    default: gpuExpandByteStreamSplit<write_output>(s, ds, t); break;
+  }
+  __syncthreads();
+
+  if (!t) {
+    if (ds->error) { *error = 1; }
+    if (write_output) {
+      pp->page_data              = output + page_offsets[blockIdx.x];
+      pp->uncompressed_page_size = ds->level_bytes + ds->out_pos;
+      pp->encoding               = Encoding::PLAIN;
+    } else {
+      page_sizes[blockIdx.x] = ds->level_bytes + ds->out_pos;
+      if (ds->level_bytes + ds->out_pos > INT32_MAX) { *error = 1; }
+    }
+  }
+}
+
 struct chunk_row_output_iter {
   PageInfo* p;
   using value_type        = size_type;
@@ -1884,6 +2420,34 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
   pages.device_to_host(stream);
 }
 
+/**
+ * @copydoc cudf::io::parquet::gpu::ComputePageRowCounts
+ */
+void ComputePageRowCounts(hostdevice_vector<PageInfo>& pages,
+                          hostdevice_vector<ColumnChunkDesc> const& chunks,
+                          rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(block_size, 1);
+  dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
+
+  // computes PageInfo::num_rows for all pages, ignoring any row bounds
+  gpuComputePageSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks, 0, INT_MAX, false);
+
+  // computes PageInfo::chunk_row for all pages
+  auto key_input = thrust::make_transform_iterator(
+    pages.device_ptr(), [] __device__(PageInfo const& page) { return page.chunk_idx; });
+  auto page_input = thrust::make_transform_iterator(
+    pages.device_ptr(), [] __device__(PageInfo const& page) { return page.num_rows; });
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                key_input,
+                                key_input + pages.size(),
+                                page_input,
+                                chunk_row_output_iter{pages.device_ptr()});
+
+  pages.device_to_host(stream, true);
+}
+
 /**
  * @copydoc cudf::io::parquet::gpu::DecodePageData
  */
@@ -1900,6 +2464,44 @@ void __host__ DecodePageData(hostdevice_vector<PageInfo>& pages,
     pages.device_ptr(), chunks, min_row, num_rows);
 }
 
+/**
+ * @copydoc cudf::io::parquet::gpu::ExpandEncodedPages
+ */
+rmm::device_buffer ExpandEncodedPages(hostdevice_vector<PageInfo>& pages,
+                                      hostdevice_vector<ColumnChunkDesc> const& chunks,
+                                      rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(block_size, 1);
+  dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
+
+  rmm::device_scalar<int32_t> error(0, stream);
+  rmm::device_uvector<size_t> page_sizes(pages.size(), stream);
+  thrust::fill(rmm::exec_policy(stream), page_sizes.begin(), page_sizes.end(), 0);
+  gpuExpandEncodedPages<false><<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks, page_sizes.data(), nullptr, nullptr, error.data());
+  CUDF_EXPECTS(error.value(stream) == 0,
+               "Error expanding DELTA or BYTE_STREAM_SPLIT encoded page data");
+
+  rmm::device_uvector<size_t> page_offsets(pages.size(), stream);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), page_sizes.begin(), page_sizes.end(), page_offsets.begin());
+  auto const total_size = page_offsets.back_element(stream) + page_sizes.back_element(stream);
+
+  rmm::device_buffer expanded_data(total_size, stream);
+  gpuExpandEncodedPages<true>
+    <<<dim_grid, dim_block, 0, stream.value()>>>(pages.device_ptr(),
+                                                 chunks,
+                                                 nullptr,
+                                                 page_offsets.data(),
+                                                 static_cast<uint8_t*>(expanded_data.data()),
+                                                 error.data());
+  CUDF_EXPECTS(error.value(stream) == 0,
+               "Error expanding DELTA or BYTE_STREAM_SPLIT encoded page data");
+
+  pages.device_to_host(stream, true);
+  return expanded_data;
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
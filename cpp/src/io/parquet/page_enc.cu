@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "bloom_filter.hpp"
 #include "parquet_gpu.hpp"
 
 #include <io/utilities/block_utils.cuh>
@@ -61,6 +62,12 @@ constexpr int32_t NO_TRUNC_STATS = 0;
 // minimum scratch space required for encoding statistics
 constexpr size_t MIN_STATS_SCRATCH_SIZE = sizeof(__int128_t);
 
+// DELTA_BINARY_PACKED block layout: 4 mini blocks of 32 values, one warp per mini block
+constexpr uint32_t delta_block_size      = 128;
+constexpr uint32_t delta_mini_block_size = 32;
+constexpr uint32_t delta_mini_blocks     = delta_block_size / delta_mini_block_size;
+constexpr uint32_t delta_buffer_size     = 2 * delta_block_size;
+
 struct frag_init_state_s {
   parquet_column_device_view col;
   PageFragment frag;
@@ -85,6 +92,27 @@ struct page_enc_state_s {
   uint32_t vals[rle_buffer_size];
 };
 
+/**
+ * @brief Shared state of the DELTA_BINARY_PACKED encoder
+ *
+ * The value at position `i` of the stream is buffered in `values[i % delta_buffer_size]` until the
+ * block holding its delta is encoded.
+ */
+struct delta_enc_state_s {
+  using block_reduce = cub::BlockReduce<int64_t, delta_block_size>;
+
+  uint8_t* cur;         //!< current output ptr
+  uint32_t num_values;  //!< number of values added to the stream
+  uint32_t num_deltas;  //!< number of deltas encoded so far
+  size_type prev_idx;   //!< leaf index of the last valid value of the previous tile, or -1
+  int64_t min_delta;    //!< min delta of the current block
+  uint8_t widths[delta_mini_blocks];   //!< bit widths of the mini blocks of the current block
+  size_type idx[delta_block_size];     //!< leaf indices of the valid values of the current tile
+  int64_t values[delta_buffer_size];   //!< values waiting to be encoded
+  uint64_t packed[delta_block_size];   //!< deltas of the current block minus the min delta
+  typename block_reduce::TempStorage reduce_storage;
+};
+
 /**
  * @brief Returns the size of the type in the Parquet file.
  */
@@ -217,6 +245,29 @@ __global__ void __launch_bounds__(128)
   if (frag_id < num_fragments_per_column and lane_id == 0) groups[column_id][frag_id] = *g;
 }
 
+/**
+ * @brief Returns the worst case number of bytes that a page of `num_values` values needs on top of
+ * its PLAIN encoded size when using `encoding`
+ */
+__device__ uint32_t encoding_overhead(Encoding encoding, Type physical_type, uint32_t num_values)
+{
+  // header, plus the min delta and bit widths of each block, plus padding of the last mini block
+  auto const binary_packed_overhead = [num_values](uint32_t value_len) {
+    uint32_t const num_blocks = (num_values + delta_block_size - 1) / delta_block_size;
+    return 18 + num_blocks * (10 + delta_mini_blocks) + delta_mini_block_size * value_len;
+  };
+  switch (encoding) {
+    case Encoding::DELTA_BINARY_PACKED:
+      return binary_packed_overhead(physical_type == INT64 ? sizeof(int64_t) : sizeof(int32_t));
+    // lengths are DELTA_BINARY_PACKED instead of 4-byte prefixes
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY: return binary_packed_overhead(sizeof(int32_t));
+    // prefix lengths are stored on top of the suffix lengths
+    case Encoding::DELTA_BYTE_ARRAY:
+      return num_values * sizeof(int32_t) + 2 * binary_packed_overhead(sizeof(int32_t));
+    default: return 0;
+  }
+}
+
 // blockDim {128,1,1}
 __global__ void __launch_bounds__(128)
   gpuInitPages(device_2dspan<EncColumnChunk> chunks,
@@ -345,6 +396,8 @@ __global__ void __launch_bounds__(128)
         if (ck_g.use_dictionary) {
           page_size =
             1 + 5 + ((values_in_page * ck_g.dict_rle_bits + 7) >> 3) + (values_in_page >> 8);
+        } else {
+          page_size += encoding_overhead(ck_g.encoding, col_g.physical_type, leaf_values_in_page);
         }
         if (!t) {
           page_g.num_fragments = fragments_in_chunk - page_start;
@@ -864,6 +917,381 @@ static __device__ std::pair<duration_ns, duration_D> convert_nanoseconds(timesta
   return {last_day_ticks, julian_days};
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ */
+inline __device__ uint8_t* VlqEncode64(uint8_t* p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+/**
+ * @brief Zigzag and variable-length encode a 64-bit signed integer
+ */
+inline __device__ uint8_t* ZigZagEncode(uint8_t* p, int64_t v)
+{
+  return VlqEncode64(p, (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+}
+
+/**
+ * @brief Returns the INT32 or INT64 value at `val_idx` of the leaf column, as written by the PLAIN
+ * encoder
+ */
+template <typename T>
+inline __device__ T get_int_value(parquet_column_device_view const& col,
+                                  size_type val_idx,
+                                  uint32_t dtype_len_in)
+{
+  if constexpr (std::is_same_v<T, int32_t>) {
+    if (dtype_len_in == 4) { return col.leaf_column->element<int32_t>(val_idx); }
+    if (dtype_len_in == 2) { return col.leaf_column->element<int16_t>(val_idx); }
+    return col.leaf_column->element<int8_t>(val_idx);
+  } else {
+    int64_t v = col.leaf_column->element<int64_t>(val_idx);
+    if (col.ts_scale != 0) { v = (col.ts_scale < 0) ? v / -col.ts_scale : v * col.ts_scale; }
+    return v;
+  }
+}
+
+/**
+ * @brief Returns the bytes of the BYTE_ARRAY value at `val_idx` of the leaf column
+ */
+inline __device__ statistics::byte_array_view get_byte_array(parquet_column_device_view const& col,
+                                                             size_type val_idx)
+{
+  if (col.leaf_column->type().id() == type_id::STRING) {
+    auto const str = col.leaf_column->element<string_view>(val_idx);
+    return {reinterpret_cast<std::byte const*>(str.data()),
+            static_cast<std::size_t>(str.size_bytes())};
+  }
+  return get_element<statistics::byte_array_view>(*col.leaf_column, val_idx);
+}
+
+/**
+ * @brief Gathers the leaf indices of the valid values in the tile of the page starting at
+ * `tile_start` into `d->idx`; must be called by all the threads of the block
+ *
+ * @return Number of valid values in the tile
+ */
+template <int block_size>
+__device__ uint32_t gather_valid_values(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint32_t tile_start,
+  uint32_t t,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& scan_storage)
+{
+  uint32_t const val_idx_in_page = tile_start + t;
+  size_type const val_idx        = s->page_start_val + val_idx_in_page;
+  uint32_t const is_valid =
+    (val_idx_in_page < s->page.num_leaf_values && val_idx < s->col.leaf_column->size())
+      ? s->col.leaf_column->is_valid(val_idx)
+      : 0;
+  uint32_t pos, num_valid;
+  cub::BlockScan<uint32_t, block_size>(scan_storage).ExclusiveSum(is_valid, pos, num_valid);
+  if (is_valid) { d->idx[pos] = val_idx; }
+  __syncthreads();
+  return num_valid;
+}
+
+/**
+ * @brief Encodes the next block of buffered deltas; must be called by all the threads of the block
+ *
+ * @tparam T Physical type of the values, the deltas wrap around in this type
+ */
+template <typename T>
+__device__ void delta_encode_block(delta_enc_state_s* d, uint32_t t)
+{
+  using U                   = std::make_unsigned_t<T>;
+  uint32_t const num_deltas = min(d->num_values - 1 - d->num_deltas, delta_block_size);
+  uint32_t const lane       = t % delta_mini_block_size;
+  uint32_t const mb         = t / delta_mini_block_size;
+
+  T delta = 0;
+  if (t < num_deltas) {
+    uint32_t const pos = d->num_deltas + t;
+    auto const prev    = static_cast<U>(d->values[pos % delta_buffer_size]);
+    auto const cur     = static_cast<U>(d->values[(pos + 1) % delta_buffer_size]);
+    delta              = static_cast<T>(static_cast<U>(cur - prev));
+  }
+  auto const min_delta = delta_enc_state_s::block_reduce(d->reduce_storage)
+                           .Reduce(t < num_deltas ? int64_t{delta}
+                                                  : std::numeric_limits<int64_t>::max(),
+                                   cub::Min());
+  if (t == 0) { d->min_delta = min_delta; }
+  __syncthreads();
+
+  uint64_t const packed =
+    (t < num_deltas) ? static_cast<U>(static_cast<U>(delta) - static_cast<U>(d->min_delta)) : 0;
+  d->packed[t]  = packed;
+  uint64_t bits = packed;
+  for (uint32_t i = delta_mini_block_size / 2; i > 0; i /= 2) {
+    bits |= __shfl_xor_sync(0xffff'ffff, bits, i);
+  }
+  // mini blocks past the last delta have no data and a bit width of zero
+  if (lane == 0) {
+    d->widths[mb] = (mb * delta_mini_block_size < num_deltas) ? 64 - __clzll(bits) : 0;
+  }
+  __syncthreads();
+
+  if (t == 0) {
+    uint8_t* cur = ZigZagEncode(d->cur, d->min_delta);
+    for (uint32_t i = 0; i < delta_mini_blocks; i++) {
+      *cur++ = d->widths[i];
+    }
+    d->cur = cur;
+  }
+  __syncthreads();
+
+  // each warp packs one mini block, one output byte per lane at a time
+  uint8_t* mb_out = d->cur;
+  for (uint32_t i = 0; i < mb; i++) {
+    mb_out += d->widths[i] * delta_mini_block_size / 8;
+  }
+  uint32_t const width      = d->widths[mb];
+  uint64_t const* mb_values = d->packed + mb * delta_mini_block_size;
+  for (uint32_t b = lane; b < width * delta_mini_block_size / 8; b += delta_mini_block_size) {
+    uint32_t bit  = b * 8;
+    uint32_t byte = 0;
+    for (uint32_t num_bits = 0; num_bits < 8;) {
+      uint32_t const shift = bit % width;
+      uint32_t const len   = min(width - shift, 8 - num_bits);
+      byte |= static_cast<uint32_t>((mb_values[bit / width] >> shift) & ((1u << len) - 1))
+              << num_bits;
+      num_bits += len;
+      bit += len;
+    }
+    mb_out[b] = byte;
+  }
+  __syncthreads();
+
+  if (t == 0) {
+    for (uint32_t i = 0; i < delta_mini_blocks; i++) {
+      d->cur += d->widths[i] * delta_mini_block_size / 8;
+    }
+    d->num_deltas += num_deltas;
+  }
+  __syncthreads();
+}
+
+/**
+ * @brief Encodes the valid values of the page as a DELTA_BINARY_PACKED stream; must be called by
+ * all the threads of the block
+ *
+ * @tparam T Physical type of the values
+ * @param value Functor returning the value to encode, given the leaf index of a valid value and the
+ * leaf index of the valid value preceding it in the page (-1 for the first one)
+ *
+ * @return End of the encoded stream
+ */
+template <typename T, int block_size, typename ValueFn>
+__device__ uint8_t* delta_binary_encode(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint8_t* dst,
+  uint32_t num_valid,
+  ValueFn value,
+  uint32_t t,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& scan_storage)
+{
+  static_assert(block_size == delta_block_size, "One thread per delta of a block is required");
+
+  if (t == 0) {
+    uint8_t* cur = VlqEncode64(dst, delta_block_size);
+    cur          = VlqEncode64(cur, delta_mini_blocks);
+    cur          = VlqEncode64(cur, num_valid);
+    // the first value is written once it is known
+    if (num_valid == 0) { cur = ZigZagEncode(cur, 0); }
+    d->cur        = cur;
+    d->num_values = 0;
+    d->num_deltas = 0;
+    d->prev_idx   = -1;
+  }
+  __syncthreads();
+
+  for (uint32_t tile_start = 0; tile_start < s->page.num_leaf_values; tile_start += block_size) {
+    uint32_t const tile_valid = gather_valid_values<block_size>(s, d, tile_start, t, scan_storage);
+    if (t < tile_valid) {
+      size_type const prev_idx = (t > 0) ? d->idx[t - 1] : d->prev_idx;
+      d->values[(d->num_values + t) % delta_buffer_size] = value(d->idx[t], prev_idx);
+    }
+    __syncthreads();
+    if (t == 0 && tile_valid > 0) {
+      if (d->num_values == 0) { d->cur = ZigZagEncode(d->cur, d->values[0]); }
+      d->prev_idx = d->idx[tile_valid - 1];
+      d->num_values += tile_valid;
+    }
+    __syncthreads();
+    while (d->num_values > d->num_deltas + delta_block_size) {
+      delta_encode_block<T>(d, t);
+    }
+  }
+  while (d->num_values > d->num_deltas + 1) {
+    delta_encode_block<T>(d, t);
+  }
+  return d->cur;
+}
+
+/**
+ * @brief Copies the bytes of the valid BYTE_ARRAY values of the page, without the first
+ * `prefix(val_idx, prev_idx)` bytes of each value; must be called by all the threads of the block
+ *
+ * @return End of the copied data
+ */
+template <int block_size, typename PrefixFn>
+__device__ uint8_t* copy_byte_arrays(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint8_t* dst,
+  PrefixFn prefix,
+  uint32_t t,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& scan_storage)
+{
+  if (t == 0) { d->prev_idx = -1; }
+  __syncthreads();
+
+  for (uint32_t tile_start = 0; tile_start < s->page.num_leaf_values; tile_start += block_size) {
+    uint32_t const tile_valid = gather_valid_values<block_size>(s, d, tile_start, t, scan_storage);
+    statistics::byte_array_view bytes;
+    uint32_t skip = 0;
+    uint32_t len  = 0;
+    if (t < tile_valid) {
+      size_type const prev_idx = (t > 0) ? d->idx[t - 1] : d->prev_idx;
+      bytes                    = get_byte_array(s->col, d->idx[t]);
+      skip                     = prefix(d->idx[t], prev_idx);
+      len                      = bytes.size_bytes() - skip;
+    }
+    uint32_t pos, total_len;
+    cub::BlockScan<uint32_t, block_size>(scan_storage).ExclusiveSum(len, pos, total_len);
+    if (len != 0) { memcpy(dst + pos, bytes.data() + skip, len); }
+    dst += total_len;
+    __syncthreads();
+    if (t == 0 && tile_valid > 0) { d->prev_idx = d->idx[tile_valid - 1]; }
+    __syncthreads();
+  }
+  return dst;
+}
+
+/**
+ * @brief Encodes the valid FLOAT/DOUBLE values of the page with BYTE_STREAM_SPLIT; must be called
+ * by all the threads of the block
+ *
+ * @return End of the encoded data
+ */
+template <int block_size>
+__device__ uint8_t* byte_stream_split_encode(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint8_t* dst,
+  uint32_t num_valid,
+  uint32_t t,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& scan_storage)
+{
+  uint32_t const val_len = (s->col.physical_type == FLOAT) ? sizeof(float) : sizeof(double);
+  uint32_t num_written   = 0;
+  for (uint32_t tile_start = 0; tile_start < s->page.num_leaf_values; tile_start += block_size) {
+    uint32_t const tile_valid = gather_valid_values<block_size>(s, d, tile_start, t, scan_storage);
+    if (t < tile_valid) {
+      uint64_t const v = (val_len == sizeof(float))
+                           ? s->col.leaf_column->element<uint32_t>(d->idx[t])
+                           : s->col.leaf_column->element<uint64_t>(d->idx[t]);
+      // byte k of every value goes to the k-th stream
+      for (uint32_t k = 0; k < val_len; k++) {
+        dst[k * num_valid + num_written + t] = v >> (k * 8);
+      }
+    }
+    num_written += tile_valid;
+    __syncthreads();
+  }
+  return dst + num_valid * val_len;
+}
+
+/**
+ * @brief Encodes the values of a data page that uses one of the DELTA encodings or
+ * BYTE_STREAM_SPLIT; must be called by all the threads of the block
+ *
+ * @return End of the encoded data
+ */
+template <int block_size>
+__device__ uint8_t* encode_non_plain_values(
+  page_enc_state_s const* s,
+  delta_enc_state_s* d,
+  uint8_t* dst,
+  uint32_t dtype_len_in,
+  uint32_t t,
+  typename cub::BlockScan<uint32_t, block_size>::TempStorage& scan_storage)
+{
+  uint32_t num_valid = 0;
+  for (uint32_t tile_start = 0; tile_start < s->page.num_leaf_values; tile_start += block_size) {
+    num_valid += gather_valid_values<block_size>(s, d, tile_start, t, scan_storage);
+  }
+
+  auto const byte_array_len = [s](size_type val_idx, size_type) {
+    return static_cast<int32_t>(get_byte_array(s->col, val_idx).size_bytes());
+  };
+  auto const prefix_len = [s](size_type val_idx, size_type prev_idx) {
+    if (prev_idx < 0) { return int32_t{0}; }
+    auto const cur    = get_byte_array(s->col, val_idx);
+    auto const prev   = get_byte_array(s->col, prev_idx);
+    auto const length = min(cur.size_bytes(), prev.size_bytes());
+    std::size_t len   = 0;
+    while (len < length && cur[len] == prev[len]) {
+      len++;
+    }
+    return static_cast<int32_t>(len);
+  };
+
+  switch (s->ck.encoding) {
+    case Encoding::DELTA_BINARY_PACKED:
+      if (s->col.physical_type == INT32) {
+        return delta_binary_encode<int32_t, block_size>(
+          s,
+          d,
+          dst,
+          num_valid,
+          [s, dtype_len_in](size_type val_idx, size_type) {
+            return get_int_value<int32_t>(s->col, val_idx, dtype_len_in);
+          },
+          t,
+          scan_storage);
+      }
+      return delta_binary_encode<int64_t, block_size>(
+        s,
+        d,
+        dst,
+        num_valid,
+        [s](size_type val_idx, size_type) { return get_int_value<int64_t>(s->col, val_idx, 0); },
+        t,
+        scan_storage);
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      dst = delta_binary_encode<int32_t, block_size>(
+        s, d, dst, num_valid, byte_array_len, t, scan_storage);
+      return copy_byte_arrays<block_size>(
+        s, d, dst, [](size_type, size_type) { return 0; }, t, scan_storage);
+    case Encoding::DELTA_BYTE_ARRAY:
+      // prefix lengths, then the suffixes as DELTA_LENGTH_BYTE_ARRAY
+      dst = delta_binary_encode<int32_t, block_size>(
+        s, d, dst, num_valid, prefix_len, t, scan_storage);
+      dst = delta_binary_encode<int32_t, block_size>(
+        s,
+        d,
+        dst,
+        num_valid,
+        [&](size_type val_idx, size_type prev_idx) {
+          return byte_array_len(val_idx, prev_idx) - prefix_len(val_idx, prev_idx);
+        },
+        t,
+        scan_storage);
+      return copy_byte_arrays<block_size>(s, d, dst, prefix_len, t, scan_storage);
+    default: return byte_stream_split_encode<block_size>(s, d, dst, num_valid, t, scan_storage);
+  }
+}
+
 // blockDim(128, 1, 1)
 template <int block_size>
 __global__ void __launch_bounds__(128, 8)
@@ -873,6 +1301,7 @@ __global__ void __launch_bounds__(128, 8)
                  device_span<compression_result> comp_results)
 {
   __shared__ __align__(8) page_enc_state_s state_g;
+  __shared__ __align__(8) delta_enc_state_s delta_g;
   using block_scan = cub::BlockScan<uint32_t, block_size>;
   __shared__ typename block_scan::TempStorage temp_storage;
 
@@ -1023,7 +1452,17 @@ __global__ void __launch_bounds__(128, 8)
     s->chunk_start_val = row_to_value_idx(s->ck.start_row, s->col);
   }
   __syncthreads();
-  for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
+  // DELTA and BYTE_STREAM_SPLIT pages are encoded at once; the loop below encodes the PLAIN and
+  // dictionary pages
+  auto const is_plain_or_dictionary = s->page.page_type == PageType::DICTIONARY_PAGE or
+                                      s->ck.use_dictionary or s->ck.encoding == Encoding::PLAIN;
+  if (not is_plain_or_dictionary) {
+    auto const end =
+      encode_non_plain_values<block_size>(s, &delta_g, s->cur, dtype_len_in, t, temp_storage);
+    if (t == 0) { s->cur = end; }
+    __syncthreads();
+  }
+  for (uint32_t cur_val_idx = 0; is_plain_or_dictionary && cur_val_idx < s->page.num_leaf_values;) {
     uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
     uint32_t len, pos;
 
@@ -1725,11 +2164,11 @@ __global__ void __launch_bounds__(128)
       encoding = (col_g.physical_type == BOOLEAN) ? Encoding::RLE
                  : (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+                   : ck_g.encoding;
     } else {
       encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+                   : ck_g.encoding;
     }
     encoder.field_int32(1, page_type);
     encoder.field_int32(2, uncompressed_page_size);
@@ -2010,6 +2449,45 @@ __global__ void __launch_bounds__(1)
   ck_g->column_index_size = static_cast<uint32_t>(col_idx_end - ck_g->column_index_blob);
 }
 
+// blockDim(128, 1, 1)
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  gpuEncodeBloomFilters(device_span<EncColumnChunk const> chunks)
+{
+  EncColumnChunk const& ck = chunks[blockIdx.x];
+  if (ck.bloom_filter == nullptr) { return; }
+
+  auto const& col         = *ck.col_desc;
+  auto const& leaf        = *col.leaf_column;
+  auto const num_blocks   = ck.bloom_filter_size / bloom_filter_block_bytes;
+  auto const dtype_len_in = int32_logical_len(leaf.type().id());
+  auto const start_value  = row_to_value_idx(ck.start_row, col);
+  auto const end_value    = row_to_value_idx(ck.start_row + ck.num_rows, col);
+
+  for (auto val_idx = start_value + static_cast<size_type>(threadIdx.x); val_idx < end_value;
+       val_idx += block_size) {
+    if (not leaf.is_valid(val_idx)) { continue; }
+    uint64_t const hash = [&]() {
+      switch (col.physical_type) {
+        case INT32: return xxhash64(get_int_value<int32_t>(col, val_idx, dtype_len_in));
+        case INT64: return xxhash64(get_int_value<int64_t>(col, val_idx, 8));
+        case FLOAT: return xxhash64(leaf.element<float>(val_idx));
+        case DOUBLE: return xxhash64(leaf.element<double>(val_idx));
+        default: {
+          // BYTE_ARRAY values are hashed without their length prefix
+          auto const bytes = get_byte_array(col, val_idx);
+          return xxhash64(reinterpret_cast<uint8_t const*>(bytes.data()), bytes.size_bytes());
+        }
+      }
+    }();
+    auto const block = ck.bloom_filter +
+                       bloom_filter_block_index(hash, num_blocks) * bloom_filter_block_words;
+    for (uint32_t i = 0; i < bloom_filter_block_words; ++i) {
+      atomicOr(block + i, bloom_filter_word_mask(hash, i));
+    }
+  }
+}
+
 void InitPageFragments(device_2dspan<PageFragment> frag,
                        device_span<parquet_column_device_view const> col_desc,
                        device_span<partition_info const> partitions,
@@ -2110,6 +2588,12 @@ void EncodeColumnIndexes(device_span<EncColumnChunk> chunks,
     chunks, column_stats, column_index_truncate_length);
 }
 
+void EncodeBloomFilters(device_span<EncColumnChunk const> chunks, rmm::cuda_stream_view stream)
+{
+  constexpr int block_size = 128;
+  gpuEncodeBloomFilters<block_size><<<chunks.size(), block_size, 0, stream.value()>>>(chunks);
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -236,6 +236,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // Byte offset from beginning of file to bloom filter
+  int32_t bloom_filter_length = 0;       // Size of the bloom filter, including its header
 };
 
 /**
@@ -362,6 +364,53 @@ struct ColumnIndex {
   std::vector<int64_t> null_counts;  // Optional count of null values per page
 };
 
+/**
+ * @brief Thrift-derived structs describing the algorithm, hash and compression of a bloom filter.
+ *
+ * Only the split block algorithm, the xxHash64 hash and uncompressed bitsets are defined.
+ */
+struct SplitBlockAlgorithm {
+};
+using BloomFilterAlgorithm_isset = struct BloomFilterAlgorithm_isset {
+  bool BLOCK{false};
+};
+struct BloomFilterAlgorithm {
+  BloomFilterAlgorithm_isset isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+struct XxHash {
+};
+using BloomFilterHash_isset = struct BloomFilterHash_isset {
+  bool XXHASH{false};
+};
+struct BloomFilterHash {
+  BloomFilterHash_isset isset;
+  XxHash XXHASH;
+};
+
+struct Uncompressed {
+};
+using BloomFilterCompression_isset = struct BloomFilterCompression_isset {
+  bool UNCOMPRESSED{false};
+};
+struct BloomFilterCompression {
+  BloomFilterCompression_isset isset;
+  Uncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a bloom filter.
+ *
+ * The header is followed by the `num_bytes` bytes of the bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 // bit space we are reserving in column_buffer::user_data
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xff'ffffu);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
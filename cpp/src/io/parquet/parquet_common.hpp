@@ -85,6 +85,7 @@ enum class Encoding : uint8_t {
   DELTA_LENGTH_BYTE_ARRAY = 6,
   DELTA_BYTE_ARRAY        = 7,
   RLE_DICTIONARY          = 8,
+  BYTE_STREAM_SPLIT       = 9,
 };
 
 /**
@@ -98,6 +99,7 @@ enum Compression {
   BROTLI       = 4,  // Added in 2.3.2
   LZ4          = 5,  // Added in 2.3.2
   ZSTD         = 6,  // Added in 2.3.2
+  LZ4_RAW      = 7,  // Added in 2.9.0
 };
 
 /**
@@ -24,6 +24,7 @@
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/io/types.hpp>
 #include <cudf/lists/lists_column_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -32,6 +33,7 @@
 #include <cuco/static_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
@@ -199,7 +201,9 @@ struct ColumnChunkDesc {
       decimal_scale(decimal_scale_),
       ts_clock_rate(ts_clock_rate_),
       src_col_index(src_col_index_),
-      src_col_schema(src_col_schema_)
+      src_col_schema(src_col_schema_),
+      is_row_range(false),
+      row_range_offset(0)
   {
   }
 
@@ -230,6 +234,11 @@ struct ColumnChunkDesc {
 
   int32_t src_col_index;   // my input column index
   int32_t src_col_schema;  // my schema index in the file
+
+  // Whether only the pages of the rows [start_row, start_row + num_rows) of the row group are read,
+  // in which case the rows of these pages outside of the range are not decoded
+  bool is_row_range;
+  int32_t row_range_offset;  // number of rows of the first read page before `start_row`
 };
 
 /**
@@ -252,6 +261,7 @@ struct parquet_column_device_view : stats_column_desc {
                                //!< nullability of parent_column. May be different from
                                //!< col.nullable() in case of chunked writing.
   bool output_as_byte_array;   //!< Indicates this list column is being written as a byte array
+  column_encoding requested_encoding;  //!< User specified encoding for this column
 };
 
 constexpr int max_page_fragment_size = 5000;  //!< Max number of rows in a page fragment
@@ -358,8 +368,11 @@ struct EncColumnChunk {
   size_type* dict_index;  //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
   uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
+  Encoding encoding;      //!< Encoding of the data pages if the chunk is not dictionary encoded
   uint8_t* column_index_blob;  //!< Binary blob containing encoded column index for this chunk
   uint32_t column_index_size;  //!< Size of column index blob
+  uint32_t* bloom_filter;      //!< Bloom filter bitset; nullptr if the chunk has no bloom filter
+  uint32_t bloom_filter_size;  //!< Size of the bloom filter bitset in bytes
 };
 
 /**
@@ -435,6 +448,42 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Computes the row counts of all pages for nested schemas.
+ *
+ * For flat schemas the row counts are known after header decoding. For nested schemas they can
+ * only be determined by examining the repetition levels. This fills in `PageInfo::num_rows` and
+ * `PageInfo::chunk_row` for every page without allocating any output memory, so that row ranges
+ * can be planned before decoding.
+ *
+ * @param pages All pages to be decoded
+ * @param chunks All chunks to be decoded
+ * @param stream Cuda stream
+ */
+void ComputePageRowCounts(hostdevice_vector<PageInfo>& pages,
+                          hostdevice_vector<ColumnChunkDesc> const& chunks,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @brief Expands the values of DELTA and BYTE_STREAM_SPLIT encoded data pages into PLAIN encoding.
+ *
+ * DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY values cannot be decoded at
+ * an arbitrary position, so they are decoded up front into the PLAIN layout of their physical
+ * type. BYTE_STREAM_SPLIT values are transposed back into the PLAIN layout at the same time. The
+ * repetition and definition levels are copied as they are. On return, the expanded pages point
+ * into the returned buffer and are marked as PLAIN encoded, both on the host and the device. Other
+ * pages are left untouched.
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] stream CUDA stream to use
+ *
+ * @return Device buffer holding the expanded pages
+ */
+rmm::device_buffer ExpandEncodedPages(hostdevice_vector<PageInfo>& pages,
+                                      hostdevice_vector<ColumnChunkDesc> const& chunks,
+                                      rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for reading the column data stored in the pages
  *
@@ -615,6 +664,16 @@ void EncodeColumnIndexes(device_span<EncColumnChunk> chunks,
                          size_type column_index_truncate_length,
                          rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel to insert the values of each chunk into its split block bloom filter
+ *
+ * Chunks without a bloom filter are skipped. The bitsets must be zero-initialized.
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] stream CUDA stream to use
+ */
+void EncodeBloomFilters(device_span<EncColumnChunk const> chunks, rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -21,18 +21,28 @@
 
 #include "reader_impl.hpp"
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_reader.hpp"
+#include "footer.hpp"
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/host_codec.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -48,8 +58,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
 #include <numeric>
 #include <regex>
+#include <set>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -301,26 +316,9 @@ std::string name_from_path(const std::vector<std::string>& path_in_schema)
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource* source)
+  explicit metadata(datasource* source, std::string const& filepath)
+    : FileMetaData(*read_footer(source, filepath))
   {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->host_read(0, header_len);
-    const auto header        = reinterpret_cast<const file_header_s*>(header_buffer->data());
-    const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
-    const auto ender         = reinterpret_cast<const file_ender_s*>(ender_buffer->data());
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
   }
 };
 
@@ -332,13 +330,13 @@ class aggregate_reader_metadata {
   /**
    * @brief Create a metadata object from each element in the source vector
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                              std::vector<std::string> const& filepaths)
   {
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    for (size_t i = 0; i < sources.size(); ++i) {
+      metadatas.emplace_back(sources[i].get(), i < filepaths.size() ? filepaths[i] : "");
+    }
     return metadatas;
   }
 
@@ -388,8 +386,9 @@ class aggregate_reader_metadata {
   }
 
  public:
-  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                            std::vector<std::string> const& filepaths)
+    : per_file_metadata(metadatas_from_sources(sources, filepaths)),
       keyval_maps(collect_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -419,9 +418,9 @@ class aggregate_reader_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
-                                                size_type src_idx,
-                                                int schema_idx) const
+  [[nodiscard]] auto const& get_column_chunk(size_type row_group_index,
+                                             size_type src_idx,
+                                             int schema_idx) const
   {
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
@@ -429,13 +428,25 @@ class aggregate_reader_metadata {
       [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
+                                                size_type src_idx,
+                                                int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
 
   [[nodiscard]] auto get_num_row_groups() const { return num_row_groups; }
 
+  [[nodiscard]] auto get_num_row_groups(size_type src_idx) const
+  {
+    return static_cast<size_type>(per_file_metadata[src_idx].row_groups.size());
+  }
+
   [[nodiscard]] auto const& get_schema(int schema_idx) const
   {
     return per_file_metadata[0].schema[schema_idx];
@@ -989,22 +1000,36 @@ std::future<void> reader::impl::read_column_chunks(
   hostdevice_vector<gpu::ColumnChunkDesc>& chunks,  // TODO const?
   size_t begin_chunk,
   size_t end_chunk,
-  const std::vector<size_t>& column_chunk_offsets,
+  std::vector<std::vector<datasource::range>> const& column_chunk_ranges,
   std::vector<size_type> const& chunk_source_map)
 {
+  // Chunks read through the host are requested from each source at once, so that the source can
+  // merge nearby ranges and fetch them in parallel
+  struct host_read_group {
+    std::vector<datasource::range> ranges;
+    // [begin, end) chunks of each read, and the number of ranges whose data make up the read
+    std::vector<std::tuple<size_t, size_t, size_t>> reads;
+    std::future<std::vector<std::unique_ptr<datasource::buffer>>> buffers;
+  };
+  std::map<size_type, host_read_group> host_reads;
+
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
+    auto const& chunk_ranges = column_chunk_ranges[chunk];
+    const size_t io_offset   = chunk_ranges.front().offset;
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
+    // Chunks made of several ranges, when only some of their pages are read, are read on their own
+    while (chunk_ranges.size() == 1 && next_chunk < end_chunk) {
+      const size_t next_offset = column_chunk_ranges[next_chunk].front().offset;
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk] ||
+          column_chunk_ranges[next_chunk].size() != 1) {
+        // Can't merge if not contiguous, mixing compressed and uncompressed, or across sources
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
         break;
@@ -1012,34 +1037,79 @@ std::future<void> reader::impl::read_column_chunks(
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
+    auto const io_ranges = chunk_ranges.size() == 1
+                             ? std::vector<datasource::range>{{io_offset, io_size}}
+                             : chunk_ranges;
     if (io_size != 0) {
       auto& source = _sources[chunk_source_map[chunk]];
       if (source->is_device_read_preferred(io_size)) {
-        auto buffer        = rmm::device_buffer(io_size, _stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), _stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
+        auto buffer = rmm::device_buffer(io_size, _stream);
+        auto dst    = static_cast<uint8_t*>(buffer.data());
+        for (auto const& range : io_ranges) {
+          read_tasks.emplace_back(
+            source->device_read_async(range.offset, range.size, dst, _stream));
+          dst += range.size;
+        }
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
+        auto d_compdata  = page_data[chunk]->data();
+        do {
+          chunks[chunk].compressed_data = d_compdata;
+          d_compdata += chunks[chunk].compressed_size;
+        } while (++chunk != next_chunk);
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), _stream));
+        auto& group = host_reads[chunk_source_map[chunk]];
+        group.ranges.insert(group.ranges.end(), io_ranges.cbegin(), io_ranges.cend());
+        group.reads.emplace_back(chunk, next_chunk, io_ranges.size());
+        chunk = next_chunk;
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
     } else {
       chunk = next_chunk;
     }
   }
-  auto sync_fn = [](decltype(read_tasks) read_tasks) {
+  for (auto& [source_idx, group] : host_reads) {
+    group.buffers = _sources[source_idx]->host_read_async(group.ranges, host_read_max_gap());
+  }
+
+  auto sync_fn = [this, &page_data, &chunks](decltype(read_tasks) read_tasks,
+                                             decltype(host_reads) host_reads) {
+    for (auto& [source_idx, group] : host_reads) {
+      auto const buffers = group.buffers.get();
+      size_t buffer_idx  = 0;
+      for (auto const& [begin, end, num_ranges] : group.reads) {
+        auto const first_buffer = buffer_idx;
+        buffer_idx += num_ranges;
+        if (num_ranges == 1) {
+          page_data[begin] = datasource::buffer::create(rmm::device_buffer(
+            buffers[first_buffer]->data(), buffers[first_buffer]->size(), _stream));
+        } else {
+          size_t size = 0;
+          for (auto i = first_buffer; i < buffer_idx; ++i) {
+            size += buffers[i]->size();
+          }
+          auto buffer = rmm::device_buffer(size, _stream);
+          auto dst    = static_cast<uint8_t*>(buffer.data());
+          for (auto i = first_buffer; i < buffer_idx; ++i) {
+            CUDF_CUDA_TRY(cudaMemcpyAsync(dst,
+                                          buffers[i]->data(),
+                                          buffers[i]->size(),
+                                          cudaMemcpyHostToDevice,
+                                          _stream.value()));
+            dst += buffers[i]->size();
+          }
+          page_data[begin] = datasource::buffer::create(std::move(buffer));
+        }
+        auto d_compdata = page_data[begin]->data();
+        for (auto chunk = begin; chunk != end; ++chunk) {
+          chunks[chunk].compressed_data = d_compdata;
+          d_compdata += chunks[chunk].compressed_size;
+        }
+      }
+    }
     for (auto& task : read_tasks) {
       task.wait();
     }
   };
-  return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
+  return std::async(std::launch::deferred, sync_fn, std::move(read_tasks), std::move(host_reads));
 }
 
 /**
@@ -1114,7 +1184,8 @@ rmm::device_buffer reader::impl::decompress_page_data(
   std::array codecs{codec_stats{parquet::GZIP},
                     codec_stats{parquet::SNAPPY},
                     codec_stats{parquet::BROTLI},
-                    codec_stats{parquet::ZSTD}};
+                    codec_stats{parquet::ZSTD},
+                    codec_stats{parquet::LZ4_RAW}};
 
   auto is_codec_supported = [&codecs](int8_t codec) {
     if (codec == parquet::UNCOMPRESSED) return true;
@@ -1207,6 +1278,20 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                    codec.total_decomp_size,
                                    _stream);
         break;
+      case parquet::LZ4_RAW:
+        if (nvcomp::is_compression_enabled(nvcomp::compression_type::LZ4)) {
+          nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                     d_comp_in,
+                                     d_comp_out,
+                                     d_comp_res_view,
+                                     codec.max_decompressed_size,
+                                     codec.total_decomp_size,
+                                     _stream);
+        } else {
+          host::batched_decompress(
+            compression_type::LZ4, d_comp_in, d_comp_out, d_comp_res_view, _stream);
+        }
+        break;
       case parquet::BROTLI:
         gpu_debrotli(d_comp_in,
                      d_comp_out,
@@ -1582,10 +1667,29 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    parquet_reader_options const& options,
                    rmm::cuda_stream_view stream,
                    rmm::mr::device_memory_resource* mr)
-  : _stream(stream), _mr(mr), _sources(std::move(sources))
+  : impl(0 /*chunk_read_limit*/, std::move(sources), options, stream, mr)
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
+}
+
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   parquet_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : _stream(stream),
+    _mr(mr),
+    _sources(std::move(sources)),
+    _chunk_read_limit(chunk_read_limit),
+    _skip_rows(options.get_skip_rows()),
+    _num_rows(options.get_num_rows()),
+    _uses_custom_row_bounds(options.get_num_rows() >= 0 || options.get_skip_rows() != 0),
+    _row_group_list(options.get_row_groups())
+{
+  // Open and parse the source dataset metadata; the file paths are used to look up cached footers
+  auto const& source = options.get_source();
+  _metadata          = std::make_unique<aggregate_reader_metadata>(
+    _sources,
+    source.type() == io_type::FILEPATH ? source.filepaths() : std::vector<std::string>{});
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1598,67 +1702,603 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   // Binary columns can be read as binary or strings
   _reader_column_schema = options.get_column_schema();
 
+  // Rows that do not satisfy the filter are removed from the output
+  _filter = options.get_filter();
+  CUDF_EXPECTS(not _filter.has_value() or not _uses_custom_row_bounds,
+               "skip_rows and num_rows can't be set along with a filter");
+
   // Select only columns required by the options
-  std::tie(_input_columns, _output_columns, _output_column_schemas) =
+  std::tie(_input_columns, _output_buffers_template, _output_column_schemas) =
     _metadata->select_columns(options.get_columns(),
                               options.is_enabled_use_pandas_metadata(),
                               _strings_to_categorical,
                               _timestamp_type.id());
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       bool uses_custom_row_bounds,
-                                       std::vector<std::vector<size_type>> const& row_group_list)
+namespace {
+
+/**
+ * @brief Functor to create a statistics column from plain-encoded min/max values.
+ *
+ * Missing values, and NaN floating point values, result in null entries.
+ */
+struct stats_column_builder {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(data_type type,
+                                     parquet::Type physical_type,
+                                     std::vector<std::vector<uint8_t> const*> const& values,
+                                     rmm::cuda_stream_view stream) const
+  {
+    using rep_type = typename stats_rep<T>::type;
+    // avoid std::vector<bool>, the device representation of a bool is a byte
+    using host_type = std::conditional_t<std::is_same_v<rep_type, bool>, uint8_t, rep_type>;
+
+    std::vector<std::optional<host_type>> host_values(values.size());
+    std::transform(values.begin(), values.end(), host_values.begin(), [&](auto const* bytes) {
+      return decode<rep_type>(physical_type, bytes);
+    });
+    return make_stats_column(type, host_values, stream);
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  std::unique_ptr<column> operator()(data_type,
+                                     parquet::Type,
+                                     std::vector<std::vector<uint8_t> const*> const&,
+                                     rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Statistics are only supported for numeric and chrono columns");
+  }
+
+ private:
+  template <typename R>
+  static std::optional<R> decode(parquet::Type physical_type, std::vector<uint8_t> const* bytes)
+  {
+    if (bytes == nullptr) { return std::nullopt; }
+
+    auto read = [bytes](auto value) -> std::optional<R> {
+      if (bytes->size() != sizeof(value)) { return std::nullopt; }
+      std::memcpy(&value, bytes->data(), sizeof(value));
+      if constexpr (std::is_floating_point_v<decltype(value)>) {
+        if (std::isnan(value)) { return std::nullopt; }
+      }
+      return static_cast<R>(value);
+    };
+
+    switch (physical_type) {
+      case parquet::BOOLEAN: return read(uint8_t{});
+      case parquet::INT32: return std::is_unsigned_v<R> ? read(uint32_t{}) : read(int32_t{});
+      case parquet::INT64: return std::is_unsigned_v<R> ? read(uint64_t{}) : read(int64_t{});
+      case parquet::FLOAT: return read(float{});
+      case parquet::DOUBLE: return read(double{});
+      default: return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Evaluates the statistics expression of a filter on the plain-encoded min/max values of
+ * row ranges.
+ *
+ * @param converter Statistics expression of the filter
+ * @param stats_types Type of the statistics of each output column
+ * @param physical_types Parquet physical type of each output column
+ * @param min_values Plain-encoded minimum values per output column and per row range; empty for
+ * the columns that are not referenced by the filter
+ * @param max_values Plain-encoded maximum values, with the same layout as `min_values`
+ * @param num_ranges Number of row ranges
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Whether each row range may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_stats_filter(
+  stats_expression_converter const& converter,
+  std::vector<std::optional<data_type>> const& stats_types,
+  std::vector<parquet::Type> const& physical_types,
+  std::vector<std::vector<std::vector<uint8_t> const*>> const& min_values,
+  std::vector<std::vector<std::vector<uint8_t> const*>> const& max_values,
+  size_type num_ranges,
+  rmm::cuda_stream_view stream)
 {
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  if (num_ranges == 0) { return {}; }
+
+  std::vector<std::unique_ptr<column>> stats_columns;
+  for (size_t col = 0; col < stats_types.size(); ++col) {
+    for (auto const* values : {&min_values[col], &max_values[col]}) {
+      if (values->empty()) {
+        stats_columns.push_back(make_numeric_column(
+          data_type{type_id::INT8}, num_ranges, mask_state::ALL_NULL, stream));
+      } else {
+        stats_columns.push_back(type_dispatcher(*stats_types[col],
+                                                stats_column_builder{},
+                                                *stats_types[col],
+                                                physical_types[col],
+                                                *values,
+                                                stream));
+      }
+    }
+  }
+  auto const stats_table = table(std::move(stats_columns));
+  return detail::evaluate_stats_filter(converter, stats_table.view(), stream);
+}
 
-  table_metadata out_metadata;
+/**
+ * @brief Functor to compute the bloom filter hash of the plain encoding of a filter value.
+ *
+ * Returns nothing if the value cannot be encoded with the physical type of the column.
+ */
+struct plain_value_hasher {
+  template <typename T,
+            std::enable_if_t<(cudf::is_numeric<T>() and not std::is_same_v<T, bool>) or
+                             cudf::is_chrono<T>()>* = nullptr>
+  std::optional<uint64_t> operator()(parquet::Type physical_type,
+                                     std::vector<uint8_t> const& value) const
+  {
+    using rep_type = typename stats_rep<T>::type;
+    rep_type v;
+    std::memcpy(&v, value.data(), sizeof(v));
+    if constexpr (std::is_integral_v<rep_type>) {
+      // narrower integers are stored sign- or zero-extended to INT32
+      if (physical_type == parquet::INT32) { return xxhash64(static_cast<int32_t>(v)); }
+      if (physical_type == parquet::INT64) { return xxhash64(static_cast<int64_t>(v)); }
+    } else {
+      if (physical_type == parquet::FLOAT and std::is_same_v<rep_type, float>) {
+        return xxhash64(v);
+      }
+      if (physical_type == parquet::DOUBLE and std::is_same_v<rep_type, double>) {
+        return xxhash64(v);
+      }
+    }
+    return std::nullopt;
+  }
 
-  // output cudf columns as determined by the top level schema
-  std::vector<std::unique_ptr<column>> out_columns;
-  out_columns.reserve(_output_columns.size());
+  template <typename T,
+            std::enable_if_t<not((cudf::is_numeric<T>() and not std::is_same_v<T, bool>) or
+                                 cudf::is_chrono<T>())>* = nullptr>
+  std::optional<uint64_t> operator()(parquet::Type, std::vector<uint8_t> const&) const
+  {
+    return std::nullopt;
+  }
+};
+
+}  // namespace
+
+std::vector<std::vector<size_type>> reader::impl::filter_row_groups(
+  std::vector<std::vector<size_type>> const& row_group_list)
+{
+  auto const num_columns = _output_buffers_template.size();
+
+  // Statistics are used for the flat columns whose output type has the same representation as
+  // their plain-encoded values
+  std::vector<std::optional<data_type>> stats_types(num_columns);
+  std::vector<parquet::Type> physical_types(num_columns);
+  for (size_t col = 0; col < num_columns; ++col) {
+    auto const& schema  = _metadata->get_schema(_output_column_schemas[col]);
+    auto const type     = _output_buffers_template[col].type;
+    physical_types[col] = schema.type;
+
+    auto const is_supported_physical_type =
+      schema.type == parquet::BOOLEAN or schema.type == parquet::INT32 or
+      schema.type == parquet::INT64 or schema.type == parquet::FLOAT or
+      schema.type == parquet::DOUBLE;
+    auto const is_supported_type =
+      is_numeric(type) or (is_chrono(type) and _timestamp_type.id() == type_id::EMPTY);
+    if (schema.num_children == 0 and schema.max_repetition_level == 0 and
+        is_supported_physical_type and is_supported_type) {
+      stats_types[col] = type;
+    }
+  }
+
+  stats_expression_converter const converter(_filter->get(), stats_types, _stream);
+  if (converter.is_always_true()) { return row_group_list; }
+  auto const& referenced_columns = converter.get_referenced_columns();
+
+  // Start from the requested row groups, or from all the row groups of every source
+  std::vector<std::pair<size_type, size_type>> candidates;
+  if (row_group_list.empty()) {
+    for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+      for (size_type rg_idx = 0; rg_idx < _metadata->get_num_row_groups(src_idx); ++rg_idx) {
+        candidates.emplace_back(src_idx, rg_idx);
+      }
+    }
+  } else {
+    CUDF_EXPECTS(row_group_list.size() == _sources.size(),
+                 "Must specify row groups for each source");
+    for (size_t src_idx = 0; src_idx < row_group_list.size(); ++src_idx) {
+      for (auto const rg_idx : row_group_list[src_idx]) {
+        CUDF_EXPECTS(rg_idx >= 0 and rg_idx < _metadata->get_num_row_groups(src_idx),
+                     "Invalid rowgroup index");
+        candidates.emplace_back(src_idx, rg_idx);
+      }
+    }
+  }
+
+  // The deprecated min/max values use the signed comparison order, so they are only a fallback
+  // for signed types
+  auto stats_value = [](std::vector<uint8_t> const& value,
+                        std::vector<uint8_t> const& deprecated_value,
+                        data_type type) -> std::vector<uint8_t> const* {
+    if (not value.empty()) { return &value; }
+    if (not deprecated_value.empty() and not is_unsigned(type)) { return &deprecated_value; }
+    return nullptr;
+  };
+
+  // Evaluate the filter on the column chunk statistics of every row group
+  std::vector<std::vector<std::vector<uint8_t> const*>> min_values(num_columns);
+  std::vector<std::vector<std::vector<uint8_t> const*>> max_values(num_columns);
+  std::vector<Statistics> chunk_stats(candidates.size() * referenced_columns.size());
+  auto stats_it = chunk_stats.begin();
+  for (auto const& [src_idx, rg_idx] : candidates) {
+    for (auto const col : referenced_columns) {
+      auto& stats = *stats_it++;
+      auto const& blob =
+        _metadata->get_column_metadata(rg_idx, src_idx, _output_column_schemas[col])
+          .statistics_blob;
+      if (not blob.empty()) {
+        CompactProtocolReader cp(blob.data(), blob.size());
+        if (not cp.read(&stats)) { stats = Statistics{}; }
+      }
+      min_values[col].push_back(stats_value(stats.min_value, stats.min, *stats_types[col]));
+      max_values[col].push_back(stats_value(stats.max_value, stats.max, *stats_types[col]));
+    }
+  }
+  auto row_group_keep = evaluate_stats_filter(converter,
+                                              stats_types,
+                                              physical_types,
+                                              min_values,
+                                              max_values,
+                                              candidates.size(),
+                                              _stream);
+
+  // Refine the remaining row groups with the per-page statistics of the column indexes. The rows
+  // of a row group are split at the page boundaries of all referenced columns, and a row group is
+  // read if any of these row ranges may contain matching rows. The ranges that may match are kept
+  // so that only their pages are read.
+  struct page_index {
+    ColumnIndex column_index;
+    OffsetIndex offset_index;
+  };
+  std::vector<std::vector<page_index>> page_indexes(candidates.size());
+  for (size_t rg = 0; rg < candidates.size(); ++rg) {
+    if (not row_group_keep[rg]) { continue; }
+    auto const src_idx = candidates[rg].first;
+    auto const rg_idx  = candidates[rg].second;
+
+    auto const has_page_index =
+      std::all_of(referenced_columns.cbegin(), referenced_columns.cend(), [&](auto col) {
+        auto const& chunk =
+          _metadata->get_column_chunk(rg_idx, src_idx, _output_column_schemas[col]);
+        return chunk.column_index_length > 0 and chunk.offset_index_length > 0;
+      });
+    if (not has_page_index) { continue; }
+
+    for (auto const col : referenced_columns) {
+      auto const& chunk =
+        _metadata->get_column_chunk(rg_idx, src_idx, _output_column_schemas[col]);
+      auto& index = page_indexes[rg].emplace_back();
+
+      auto const column_index_buffer =
+        _sources[src_idx]->host_read(chunk.column_index_offset, chunk.column_index_length);
+      CompactProtocolReader ci_reader(column_index_buffer->data(), column_index_buffer->size());
+      auto const offset_index_buffer =
+        _sources[src_idx]->host_read(chunk.offset_index_offset, chunk.offset_index_length);
+      CompactProtocolReader oi_reader(offset_index_buffer->data(), offset_index_buffer->size());
+
+      if (not ci_reader.read(&index.column_index) or not oi_reader.read(&index.offset_index) or
+          index.offset_index.page_locations.empty() or
+          index.column_index.null_pages.size() != index.offset_index.page_locations.size() or
+          index.column_index.min_values.size() != index.offset_index.page_locations.size() or
+          index.column_index.max_values.size() != index.offset_index.page_locations.size()) {
+        page_indexes[rg].clear();
+        break;
+      }
+    }
+  }
+
+  std::vector<size_t> range_row_groups;
+  std::vector<std::pair<int64_t, int64_t>> range_rows;
+  for (auto& values : min_values) {
+    values.clear();
+  }
+  for (auto& values : max_values) {
+    values.clear();
+  }
+  for (size_t rg = 0; rg < candidates.size(); ++rg) {
+    if (page_indexes[rg].empty()) { continue; }
+    auto const [src_idx, rg_idx] = candidates[rg];
+    auto const num_rows          = _metadata->get_row_group(rg_idx, src_idx).num_rows;
+
+    std::set<int64_t> range_starts{0};
+    for (auto const& index : page_indexes[rg]) {
+      for (auto const& location : index.offset_index.page_locations) {
+        if (location.first_row_index < num_rows) { range_starts.insert(location.first_row_index); }
+      }
+    }
+
+    for (auto it = range_starts.cbegin(); it != range_starts.cend(); ++it) {
+      auto const start_row = *it;
+      range_row_groups.push_back(rg);
+      range_rows.emplace_back(start_row,
+                              std::next(it) == range_starts.cend() ? num_rows : *std::next(it));
+      auto index_it = page_indexes[rg].cbegin();
+      for (auto const col : referenced_columns) {
+        auto const& index     = *index_it++;
+        auto const& locations = index.offset_index.page_locations;
+        // the page that contains the first row of the range
+        auto const page = std::distance(locations.cbegin(),
+                                        std::upper_bound(locations.cbegin(),
+                                                         locations.cend(),
+                                                         start_row,
+                                                         [](int64_t row, PageLocation const& loc) {
+                                                           return row < loc.first_row_index;
+                                                         })) -
+                          1;
+        auto const is_null_page = page < 0 or index.column_index.null_pages[page];
+        min_values[col].push_back(is_null_page ? nullptr : &index.column_index.min_values[page]);
+        max_values[col].push_back(is_null_page ? nullptr : &index.column_index.max_values[page]);
+      }
+    }
+  }
+  auto const range_keep = evaluate_stats_filter(converter,
+                                                stats_types,
+                                                physical_types,
+                                                min_values,
+                                                max_values,
+                                                range_row_groups.size(),
+                                                _stream);
+  for (size_t rg = 0; rg < candidates.size(); ++rg) {
+    if (not page_indexes[rg].empty()) { row_group_keep[rg] = false; }
+  }
+  for (size_t range = 0; range < range_row_groups.size(); ++range) {
+    if (not range_keep[range]) { continue; }
+    auto const rg = range_row_groups[range];
+    row_group_keep[rg] = true;
+    // adjacent ranges are merged
+    auto& ranges = _row_group_row_ranges[candidates[rg]];
+    if (not ranges.empty() and ranges.back().second == range_rows[range].first) {
+      ranges.back().second = range_rows[range].second;
+    } else {
+      ranges.push_back(range_rows[range]);
+    }
+  }
+
+  std::vector<std::vector<size_type>> selection(_sources.size());
+  for (size_t rg = 0; rg < candidates.size(); ++rg) {
+    if (row_group_keep[rg]) { selection[candidates[rg].first].push_back(candidates[rg].second); }
+  }
+  return selection;
+}
+
+std::vector<OffsetIndex> reader::impl::read_offset_indexes(size_type row_group_index,
+                                                          size_type source_index)
+{
+  std::vector<OffsetIndex> offset_indexes;
+  for (auto const& col : _input_columns) {
+    auto const& chunk = _metadata->get_column_chunk(row_group_index, source_index, col.schema_idx);
+    if (chunk.offset_index_length <= 0) { return {}; }
+
+    auto const buffer =
+      _sources[source_index]->host_read(chunk.offset_index_offset, chunk.offset_index_length);
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    auto& index = offset_indexes.emplace_back();
+    if (not cp.read(&index)) { return {}; }
+
+    // the pages must start at the first row, follow the dictionary page, if any, and be sorted
+    // within the column chunk
+    auto const& meta      = chunk.meta_data;
+    auto const& locations = index.page_locations;
+    auto const chunk_offset =
+      (meta.dictionary_page_offset != 0)
+        ? std::min(meta.data_page_offset, meta.dictionary_page_offset)
+        : meta.data_page_offset;
+    auto const is_valid =
+      not locations.empty() and locations.front().first_row_index == 0 and
+      locations.front().offset >= chunk_offset and
+      locations.back().offset + locations.back().compressed_page_size <=
+        chunk_offset + meta.total_compressed_size and
+      std::adjacent_find(locations.cbegin(),
+                         locations.cend(),
+                         [](PageLocation const& a, PageLocation const& b) {
+                           return b.first_row_index <= a.first_row_index or
+                                  b.offset < a.offset + a.compressed_page_size;
+                         }) == locations.cend();
+    if (not is_valid) { return {}; }
+  }
+  return offset_indexes;
+}
+
+std::vector<std::vector<size_type>> reader::impl::probe_bloom_filters(
+  std::vector<std::vector<size_type>> const& row_group_list)
+{
+  auto const num_columns = _output_buffers_template.size();
+
+  // Bloom filters are probed for the flat columns whose filter values can be plain-encoded
+  std::vector<std::optional<data_type>> probe_types(num_columns);
+  std::vector<parquet::Type> physical_types(num_columns);
+  for (size_t col = 0; col < num_columns; ++col) {
+    auto const& schema  = _metadata->get_schema(_output_column_schemas[col]);
+    auto const type     = _output_buffers_template[col].type;
+    physical_types[col] = schema.type;
+
+    auto const is_supported_physical_type =
+      schema.type == parquet::INT32 or schema.type == parquet::INT64 or
+      schema.type == parquet::FLOAT or schema.type == parquet::DOUBLE;
+    auto const is_supported_type =
+      is_numeric(type) or (is_chrono(type) and _timestamp_type.id() == type_id::EMPTY);
+    if (schema.num_children == 0 and schema.max_repetition_level == 0 and
+        is_supported_physical_type and is_supported_type) {
+      probe_types[col] = type;
+    }
+  }
+
+  equality_filter const filter(_filter->get(), probe_types, _stream);
+  auto const& predicates = filter.get_predicates();
+  if (predicates.empty()) { return row_group_list; }
+
+  std::vector<std::optional<uint64_t>> hashes;
+  for (auto const& predicate : predicates) {
+    hashes.push_back(type_dispatcher(predicate.type,
+                                     plain_value_hasher{},
+                                     physical_types[predicate.column],
+                                     predicate.value));
+  }
+
+  // Returns false if the bloom filter of the column chunk shows that it does not contain the value
+  auto may_contain = [&](size_t src_idx, ColumnChunkMetaData const& meta, uint64_t hash) {
+    if (meta.bloom_filter_offset <= 0) { return true; }
+    auto const& source = _sources[src_idx];
+    if (static_cast<size_t>(meta.bloom_filter_offset) >= source->size()) { return true; }
+
+    // Files that do not record the length of the bloom filter are read in two steps: first the
+    // header, whose encoded size is bounded but unknown, then the bitset
+    constexpr size_t max_header_size = 64;
+    auto const offset                = static_cast<size_t>(meta.bloom_filter_offset);
+    auto const read_size             = meta.bloom_filter_length > 0
+                                         ? static_cast<size_t>(meta.bloom_filter_length)
+                                         : max_header_size;
+    auto buffer = source->host_read(offset, std::min(read_size, source->size() - offset));
+
+    BloomFilterHeader header;
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    if (not cp.read(&header) or not header.algorithm.isset.BLOCK or
+        not header.hash.isset.XXHASH or not header.compression.isset.UNCOMPRESSED or
+        header.num_bytes <= 0 or header.num_bytes % bloom_filter_block_bytes != 0) {
+      return true;
+    }
+    auto const bitset_offset = static_cast<size_t>(cp.bytecount());
+    if (bitset_offset + header.num_bytes > buffer->size()) {
+      if (offset + bitset_offset + header.num_bytes > source->size()) { return true; }
+      buffer = source->host_read(offset + bitset_offset, header.num_bytes);
+      return bloom_filter_may_contain(
+        buffer->data(), header.num_bytes / bloom_filter_block_bytes, hash);
+    }
+    return bloom_filter_may_contain(
+      buffer->data() + bitset_offset, header.num_bytes / bloom_filter_block_bytes, hash);
+  };
+
+  CUDF_EXPECTS(row_group_list.empty() or row_group_list.size() == _sources.size(),
+               "Must specify row groups for each source");
+  std::vector<std::vector<size_type>> selection(_sources.size());
+  for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    std::vector<size_type> all_row_groups;
+    if (row_group_list.empty()) {
+      all_row_groups.resize(_metadata->get_num_row_groups(src_idx));
+      std::iota(all_row_groups.begin(), all_row_groups.end(), 0);
+    }
+    for (auto const rg_idx : row_group_list.empty() ? all_row_groups : row_group_list[src_idx]) {
+      CUDF_EXPECTS(rg_idx >= 0 and rg_idx < _metadata->get_num_row_groups(src_idx),
+                   "Invalid rowgroup index");
+      std::vector<bool> may_match(predicates.size(), true);
+      for (size_t i = 0; i < predicates.size(); ++i) {
+        if (not hashes[i].has_value()) { continue; }
+        auto const schema_idx = _output_column_schemas[predicates[i].column];
+        auto const& meta      = _metadata->get_column_metadata(rg_idx, src_idx, schema_idx);
+        may_match[i] = may_contain(src_idx, meta, *hashes[i]);
+      }
+      if (filter.evaluate(may_match)) { selection[src_idx].push_back(rg_idx); }
+    }
+  }
+  return selection;
+}
+
+void reader::impl::prepare_data(size_type skip_rows,
+                                size_type num_rows,
+                                bool uses_custom_row_bounds,
+                                std::vector<std::vector<size_type>> const& row_group_list)
+{
+  if (_file_preprocessed) { return; }
+
+  // Select only row groups required, skipping the ones that cannot match the filter
+  const auto selected_row_groups = _metadata->select_row_groups(
+    _filter.has_value() ? probe_bloom_filters(filter_row_groups(row_group_list)) : row_group_list,
+    skip_rows,
+    num_rows);
 
   if (selected_row_groups.size() != 0 && _input_columns.size() != 0) {
-    // Descriptors for all the chunks that make up the selected columns
     const auto num_input_columns = _input_columns.size();
-    const auto num_chunks        = selected_row_groups.size() * num_input_columns;
-    hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, _stream);
+
+    // this schema contains repetition levels and will require a preprocess
+    _file_itm_data.has_lists =
+      std::any_of(_input_columns.cbegin(), _input_columns.cend(), [&](auto const& col) {
+        return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+      });
+
+    // Row groups for which the filter kept only some row ranges are split into these ranges, and
+    // only the pages that hold their rows are read. The rows of the pages are only known for flat
+    // schemas, so row groups with list columns are read in full.
+    struct row_group_slice {
+      size_type index;
+      size_type source_index;
+      size_type start_row;                             // first output row
+      size_type num_rows;
+      int64_t first_row;                               // first row within the row group
+      std::vector<OffsetIndex> const* offset_indexes;  // null if the row group is read in full
+    };
+    std::vector<std::vector<OffsetIndex>> offset_indexes;
+    offset_indexes.reserve(selected_row_groups.size());  // the slices point to its elements
+    std::vector<row_group_slice> slices;
+    size_type num_skipped_rows = 0;
+    auto remaining_rows        = num_rows;
+    for (const auto& rg : selected_row_groups) {
+      const auto& row_group = _metadata->get_row_group(rg.index, rg.source_index);
+      auto const start_row  = rg.start_row - num_skipped_rows;
+      auto const ranges     = _row_group_row_ranges.find({rg.source_index, rg.index});
+      if (not _file_itm_data.has_lists and ranges != _row_group_row_ranges.end()) {
+        offset_indexes.push_back(read_offset_indexes(rg.index, rg.source_index));
+      }
+      if (_file_itm_data.has_lists or ranges == _row_group_row_ranges.end() or
+          offset_indexes.back().empty()) {
+        slices.push_back({rg.index,
+                          rg.source_index,
+                          start_row,
+                          std::min<int>(remaining_rows, row_group.num_rows),
+                          0,
+                          nullptr});
+      } else {
+        size_type num_range_rows = 0;
+        for (auto const& [first_row, end_row] : ranges->second) {
+          slices.push_back({rg.index,
+                            rg.source_index,
+                            start_row + num_range_rows,
+                            static_cast<size_type>(end_row - first_row),
+                            first_row,
+                            &offset_indexes.back()});
+          num_range_rows += end_row - first_row;
+        }
+        num_skipped_rows += row_group.num_rows - num_range_rows;
+      }
+      remaining_rows -= row_group.num_rows;
+    }
+    assert(remaining_rows <= 0);
+    num_rows -= num_skipped_rows;
+
+    // Descriptors for all the chunks that make up the selected columns
+    const auto num_chunks = slices.size() * num_input_columns;
+    _file_itm_data.chunks = hostdevice_vector<gpu::ColumnChunkDesc>(0, num_chunks, _stream);
+    auto& chunks          = _file_itm_data.chunks;
 
     // Association between each column chunk and its source
     std::vector<size_type> chunk_source_map(num_chunks);
 
     // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<std::unique_ptr<datasource::buffer>> page_data(num_chunks);
+    auto& page_data = _file_itm_data.raw_page_data;
+    page_data       = std::vector<std::unique_ptr<datasource::buffer>>(num_chunks);
 
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
-
-    // if there are lists present, we need to preprocess
-    bool has_lists = false;
+    // Keep track of the file ranges of the column chunks
+    std::vector<std::vector<datasource::range>> column_chunk_ranges(num_chunks);
 
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
-    std::vector<std::future<void>> read_rowgroup_tasks;
-    for (const auto& rg : selected_row_groups) {
-      const auto& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
-      auto const row_group_start  = rg.start_row;
-      auto const row_group_source = rg.source_index;
-      auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
+    for (const auto& slice : slices) {
+      const auto& row_group = _metadata->get_row_group(slice.index, slice.source_index);
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
         auto col = _input_columns[i];
         // look up metadata
-        auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
-        auto& schema   = _metadata->get_schema(col.schema_idx);
-
-        // this column contains repetition levels and will require a preprocess
-        if (schema.max_repetition_level > 0) { has_lists = true; }
+        auto& col_meta =
+          _metadata->get_column_metadata(slice.index, slice.source_index, col.schema_idx);
+        auto& schema = _metadata->get_schema(col.schema_idx);
 
         auto [type_width, clock_rate, converted_type] =
           conversion_info(to_type_id(schema, _strings_to_categorical, _timestamp_type.id()),
@@ -1667,18 +2307,67 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           schema.converted_type,
                           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        auto const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        auto& ranges             = column_chunk_ranges[chunks.size()];
+        auto compressed_size     = col_meta.total_compressed_size;
+        auto num_values          = col_meta.num_values;
+        int32_t row_range_offset = 0;
+        if (slice.offset_indexes == nullptr) {
+          ranges.push_back(
+            {static_cast<size_t>(chunk_offset), static_cast<size_t>(compressed_size)});
+        } else {
+          // the data pages that hold the rows of the slice
+          auto const& locations = (*slice.offset_indexes)[i].page_locations;
+          auto const end_row    = slice.first_row + slice.num_rows;
+          auto const first_page = std::prev(
+            std::upper_bound(locations.cbegin(),
+                             locations.cend(),
+                             slice.first_row,
+                             [](int64_t row, PageLocation const& loc) {
+                               return row < loc.first_row_index;
+                             }));
+          auto const last_page = std::prev(
+            std::lower_bound(locations.cbegin(),
+                             locations.cend(),
+                             end_row,
+                             [](PageLocation const& loc, int64_t row) {
+                               return loc.first_row_index < row;
+                             }));
+          auto const pages_end_row = std::next(last_page) == locations.cend()
+                                       ? row_group.num_rows
+                                       : std::next(last_page)->first_row_index;
+          auto const pages_size =
+            last_page->offset + last_page->compressed_page_size - first_page->offset;
+
+          // the dictionary page, if any, precedes the first data page
+          auto const dictionary_size = locations.front().offset - chunk_offset;
+          if (first_page == locations.cbegin()) {
+            ranges.push_back({static_cast<size_t>(chunk_offset),
+                              static_cast<size_t>(dictionary_size + pages_size)});
+          } else {
+            if (dictionary_size > 0) {
+              ranges.push_back(
+                {static_cast<size_t>(chunk_offset), static_cast<size_t>(dictionary_size)});
+            }
+            ranges.push_back(
+              {static_cast<size_t>(first_page->offset), static_cast<size_t>(pages_size)});
+          }
+          compressed_size = dictionary_size + pages_size;
+          num_values      = pages_end_row - first_page->first_row_index;
+          row_range_offset =
+            static_cast<int32_t>(slice.first_row - first_page->first_row_index);
+        }
 
-        chunks.push_back(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.push_back(gpu::ColumnChunkDesc(compressed_size,
                                               nullptr,
-                                              col_meta.num_values,
+                                              num_values,
                                               schema.type,
                                               type_width,
-                                              row_group_start,
-                                              row_group_rows,
+                                              slice.start_row,
+                                              slice.num_rows,
                                               schema.max_definition_level,
                                               schema.max_repetition_level,
                                               _metadata->get_output_nesting_depth(col.schema_idx),
@@ -1691,88 +2380,296 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                               clock_rate,
                                               i,
                                               col.schema_idx));
+        chunks[chunks.size() - 1].is_row_range     = slice.offset_indexes != nullptr;
+        chunks[chunks.size() - 1].row_range_offset = row_range_offset;
 
         // Map each column chunk to its column index and its source index
-        chunk_source_map[chunks.size() - 1] = row_group_source;
+        chunk_source_map[chunks.size() - 1] = slice.source_index;
 
         if (col_meta.codec != Compression::UNCOMPRESSED) {
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_rowgroup_tasks.push_back(read_column_chunks(
-        page_data, chunks, io_chunk_idx, chunks.size(), column_chunk_offsets, chunk_source_map));
-
-      remaining_rows -= row_group.num_rows;
-    }
-    for (auto& task : read_rowgroup_tasks) {
-      task.wait();
     }
-    assert(remaining_rows <= 0);
+    // Read compressed chunk data to device memory. All row groups are read at once, so that each
+    // source gets a single host read request: sources that do not support concurrent reads would
+    // otherwise be read from several threads.
+    read_column_chunks(page_data, chunks, 0, chunks.size(), column_chunk_ranges, chunk_source_map)
+      .wait();
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks);
     if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, _stream);
-      rmm::device_buffer decomp_page_data;
+      _file_itm_data.pages_info =
+        hostdevice_vector<gpu::PageInfo>(total_pages, total_pages, _stream);
+      auto& pages = _file_itm_data.pages_info;
 
       // decoding of column/page information
       decode_page_headers(chunks, pages);
       if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages);
+        _file_itm_data.decomp_page_data = decompress_page_data(chunks, pages);
         // Free compressed data
         for (size_t c = 0; c < chunks.size(); c++) {
           if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
         }
       }
 
-      // build output column info
-      // walk the schema, building out_buffers that mirror what our final cudf columns will look
-      // like. important : there is not necessarily a 1:1 mapping between input columns and output
-      // columns. For example, parquet does not explicitly store a ColumnChunkDesc for struct
-      // columns. The "structiness" is simply implied by the schema.  For example, this schema:
-      //  required group field_id=1 name {
-      //    required binary field_id=2 firstname (String);
-      //    required binary field_id=3 middlename (String);
-      //    required binary field_id=4 lastname (String);
-      // }
-      // will only contain 3 columns of data (firstname, middlename, lastname).  But of course
-      // "name" is a struct column that we want to return, so we have to make sure that we
-      // create it ourselves.
-      // std::vector<output_column_info> output_info = build_output_column_info();
-
       // nesting information (sizes, etc) stored -per page-
       // note : even for flat schemas, we allocate 1 level of "nesting" info
-      hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
-      allocate_nesting_info(chunks, pages, page_nesting_info);
-
-      // - compute column sizes and allocate output buffers.
-      //   important:
-      //   for nested schemas, we have to do some further preprocessing to determine:
-      //    - real column output sizes per level of nesting (in a flat schema, there's only 1 level
-      //    of
-      //      nesting and it's size is the row count)
-      //
-      // - for nested schemas, output buffer offset values per-page, per nesting-level for the
-      // purposes of decoding.
-      preprocess_columns(chunks, pages, skip_rows, num_rows, uses_custom_row_bounds, has_lists);
-
-      // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows);
-
-      // create the final output cudf columns
-      for (size_t i = 0; i < _output_columns.size(); ++i) {
-        column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-        auto const metadata =
-          _reader_column_schema.has_value()
-            ? std::make_optional<reader_column_schema>((*_reader_column_schema)[i])
-            : std::nullopt;
-        out_columns.emplace_back(
-          make_column(_output_columns[i], &col_name, metadata, _stream, _mr));
+      allocate_nesting_info(chunks, pages, _file_itm_data.page_nesting_info);
+
+      // DELTA and BYTE_STREAM_SPLIT encoded values are expanded into PLAIN encoding before decoding
+      auto const has_expanded_pages = std::any_of(pages.begin(), pages.end(), [](auto const& page) {
+        return page.encoding == Encoding::DELTA_BINARY_PACKED or
+               page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY or
+               page.encoding == Encoding::DELTA_BYTE_ARRAY or
+               page.encoding == Encoding::BYTE_STREAM_SPLIT;
+      });
+      if (has_expanded_pages) {
+        _file_itm_data.expanded_page_data = gpu::ExpandEncodedPages(pages, chunks, _stream);
+      }
+    }
+  }
+
+  // Compute the row ranges to be returned by each chunk. An empty selection still produces a
+  // single (empty) chunk so that the output schema is returned.
+  if (_file_itm_data.pages_info.size() > 0) {
+    compute_chunk_read_info(skip_rows, num_rows);
+  } else {
+    _chunk_read_info.push_back({static_cast<size_t>(skip_rows), static_cast<size_t>(num_rows)});
+  }
+
+  // Always apply the row bounds when the read is split into several chunks
+  _uses_custom_row_bounds = uses_custom_row_bounds || _chunk_read_info.size() > 1;
+  _file_preprocessed      = true;
+}
+
+namespace {
+
+struct cumulative_row_info {
+  size_t row_count;   // cumulative row count at the end of the page
+  size_t size_bytes;  // cumulative output size in bytes at the end of the page
+};
+
+/**
+ * @brief Returns a copy of the column buffer hierarchy without any allocated device memory.
+ */
+column_buffer copy_unallocated_buffer(column_buffer const& buf)
+{
+  column_buffer out(buf.type, buf.is_nullable);
+  out.name      = buf.name;
+  out.user_data = buf.user_data;
+  std::transform(buf.children.cbegin(),
+                 buf.children.cend(),
+                 std::back_inserter(out.children),
+                 copy_unallocated_buffer);
+  return out;
+}
+
+/**
+ * @brief Returns the estimated number of bytes a data page contributes to the decoded output.
+ *
+ * @param page The data page
+ * @param leaf_type Output type of the leaf column the page is decoded into
+ * @param nullable Whether the leaf column is nullable
+ * @param num_list_levels Number of list levels above the leaf, each adding an offsets entry
+ * @param avg_dict_value_size Average size of a dictionary entry of the column chunk
+ */
+size_t estimate_page_output_size(gpu::PageInfo const& page,
+                                 data_type leaf_type,
+                                 bool nullable,
+                                 int num_list_levels,
+                                 size_t avg_dict_value_size)
+{
+  auto const num_values = static_cast<size_t>(page.num_input_values);
+  size_t size           = nullable ? cudf::util::div_rounding_up_safe<size_t>(num_values, 8) : 0;
+  size += num_list_levels * num_values * sizeof(size_type);
+  if (leaf_type.id() == type_id::STRING) {
+    size += num_values * sizeof(size_type);
+    // dictionary pages hold indices only, so use the average dictionary entry size; plain pages
+    // hold the characters along with a 4-byte length per value
+    auto const is_dict =
+      page.encoding == Encoding::PLAIN_DICTIONARY || page.encoding == Encoding::RLE_DICTIONARY;
+    size += is_dict ? num_values * avg_dict_value_size
+                    : static_cast<size_t>(page.uncompressed_page_size);
+  } else {
+    size += num_values * size_of(leaf_type);
+  }
+  return size;
+}
+
+}  // namespace
+
+void reader::impl::compute_chunk_read_info(size_t skip_rows, size_t num_rows)
+{
+  auto& chunks = _file_itm_data.chunks;
+  auto& pages  = _file_itm_data.pages_info;
+
+  if (_chunk_read_limit == 0 || num_rows == 0) {
+    _chunk_read_info.push_back({skip_rows, num_rows});
+    return;
+  }
+
+  // for nested schemas the row count of each page is only known after examining the repetition
+  // levels
+  if (_file_itm_data.has_lists) { gpu::ComputePageRowCounts(pages, chunks, _stream); }
+
+  // cumulative output sizes of the data pages of each input column, in row order
+  std::vector<std::vector<cumulative_row_info>> column_sizes(_input_columns.size());
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    auto const& chunk     = chunks[c];
+    auto const& input_col = _input_columns[chunk.src_col_index];
+
+    // find the output buffer the leaf values are decoded into
+    int num_list_levels = 0;
+    auto const* cols    = &_output_buffers_template;
+    column_buffer const* leaf{nullptr};
+    for (size_t l_idx = 0; l_idx < input_col.nesting_depth(); l_idx++) {
+      leaf = &(*cols)[input_col.nesting[l_idx]];
+      if (leaf->type.id() == type_id::LIST) { num_list_levels++; }
+      cols = &leaf->children;
+    }
+
+    // NOTE: Assumes first page in the chunk is always the dictionary page
+    size_t avg_dict_value_size = 0;
+    if (chunk.num_dict_pages > 0 && pages[page_count].num_input_values > 0) {
+      avg_dict_value_size = pages[page_count].uncompressed_page_size /
+                            static_cast<size_t>(pages[page_count].num_input_values);
+    }
+
+    auto& sizes = column_sizes[chunk.src_col_index];
+    for (int p = chunk.num_dict_pages; p < chunk.max_num_pages; p++) {
+      auto const& page   = pages[page_count + p];
+      // the last page of a row range can hold rows past the range
+      auto const end_row =
+        std::min<size_t>(chunk.start_row + page.chunk_row + page.num_rows - chunk.row_range_offset,
+                         chunk.start_row + chunk.num_rows);
+      auto const prev    = sizes.empty() ? 0 : sizes.back().size_bytes;
+      auto const page_size = estimate_page_output_size(
+        page, leaf->type, leaf->is_nullable, num_list_levels, avg_dict_value_size);
+      sizes.push_back({end_row, prev + page_size});
+    }
+    page_count += chunk.max_num_pages;
+  }
+
+  // candidate split rows are the page boundaries within the selected rows
+  auto const end_row = skip_rows + num_rows;
+  std::vector<size_t> split_rows{end_row};
+  for (auto const& sizes : column_sizes) {
+    for (auto const& info : sizes) {
+      if (info.row_count > skip_rows && info.row_count < end_row) {
+        split_rows.push_back(info.row_count);
       }
     }
   }
+  std::sort(split_rows.begin(), split_rows.end());
+  split_rows.erase(std::unique(split_rows.begin(), split_rows.end()), split_rows.end());
+
+  // total output size up to a given row, counting the pages that contain the row in full
+  auto total_size_at = [&](size_t row) {
+    size_t total = 0;
+    for (auto const& sizes : column_sizes) {
+      if (sizes.empty()) { continue; }
+      auto const it = std::lower_bound(
+        sizes.cbegin(), sizes.cend(), row, [](cumulative_row_info const& info, size_t r) {
+          return info.row_count < r;
+        });
+      total += (it == sizes.cend() ? sizes.back() : *it).size_bytes;
+    }
+    return total;
+  };
+  std::vector<size_t> split_sizes(split_rows.size());
+  std::transform(split_rows.cbegin(), split_rows.cend(), split_sizes.begin(), total_size_at);
+
+  // greedily take the furthest split row that keeps the chunk within the limit, but always advance
+  // by at least one split row
+  size_t cur_row  = skip_rows;
+  size_t cur_size = std::accumulate(
+    column_sizes.cbegin(), column_sizes.cend(), size_t{0}, [&](size_t total, auto const& sizes) {
+      // size of the pages that end before the first selected row
+      auto const it = std::upper_bound(
+        sizes.cbegin(), sizes.cend(), skip_rows, [](size_t r, cumulative_row_info const& info) {
+          return r < info.row_count;
+        });
+      return it == sizes.cbegin() ? total : total + std::prev(it)->size_bytes;
+    });
+  for (size_t idx = 0; cur_row < end_row; ++idx) {
+    while (idx + 1 < split_rows.size() && split_sizes[idx + 1] - cur_size <= _chunk_read_limit) {
+      ++idx;
+    }
+    _chunk_read_info.push_back({cur_row, split_rows[idx] - cur_row});
+    cur_row  = split_rows[idx];
+    cur_size = split_sizes[idx];
+  }
+}
+
+table_with_metadata reader::impl::read_chunk_internal(bool uses_custom_row_bounds)
+{
+  auto const& read_info = _chunk_read_info[_current_read_chunk++];
+  auto& chunks          = _file_itm_data.chunks;
+  auto& pages           = _file_itm_data.pages_info;
+
+  table_metadata out_metadata;
+
+  // output cudf columns as determined by the top level schema
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(_output_buffers_template.size());
+
+  // fresh output buffers for every chunk
+  _output_columns.clear();
+  std::transform(_output_buffers_template.cbegin(),
+                 _output_buffers_template.cend(),
+                 std::back_inserter(_output_columns),
+                 copy_unallocated_buffer);
+
+  if (pages.size() > 0 && read_info.num_rows > 0) {
+    // the output pointers of a previous chunk must not be seen by the preprocess step
+    for (auto& chunk : chunks) {
+      chunk.valid_map_base   = nullptr;
+      chunk.column_data_base = nullptr;
+    }
+    chunks.host_to_device(_stream);
+
+    // - compute column sizes and allocate output buffers.
+    //   important:
+    //   for nested schemas, we have to do some further preprocessing to determine:
+    //    - real column output sizes per level of nesting (in a flat schema, there's only 1 level
+    //    of
+    //      nesting and it's size is the row count)
+    //
+    // - for nested schemas, output buffer offset values per-page, per nesting-level for the
+    // purposes of decoding.
+    preprocess_columns(chunks,
+                       pages,
+                       read_info.skip_rows,
+                       read_info.num_rows,
+                       uses_custom_row_bounds,
+                       _file_itm_data.has_lists);
+
+    // decoding of column data itself
+    decode_page_data(chunks,
+                     pages,
+                     _file_itm_data.page_nesting_info,
+                     read_info.skip_rows,
+                     read_info.num_rows);
+
+    // create the final output cudf columns
+    for (size_t i = 0; i < _output_columns.size(); ++i) {
+      column_name_info& col_name = out_metadata.schema_info.emplace_back("");
+      auto const metadata =
+        _reader_column_schema.has_value()
+          ? std::make_optional<reader_column_schema>((*_reader_column_schema)[i])
+          : std::nullopt;
+      out_columns.emplace_back(make_column(_output_columns[i], &col_name, metadata, _stream, _mr));
+    }
+  }
+
+  return finalize_output(std::move(out_columns), std::move(out_metadata));
+}
 
+table_with_metadata reader::impl::finalize_output(
+  std::vector<std::unique_ptr<column>>&& out_columns, table_metadata&& out_metadata)
+{
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_columns.size(); ++i) {
     column_name_info& col_name = out_metadata.schema_info.emplace_back("");
@@ -1791,7 +2688,51 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   out_metadata.user_data          = {out_metadata.per_file_user_data[0].begin(),
                             out_metadata.per_file_user_data[0].end()};
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto output = std::make_unique<table>(std::move(out_columns));
+
+  // Remove the rows of the pages that were read but do not satisfy the filter
+  if (_filter.has_value()) {
+    auto const predicate = cudf::detail::compute_column(
+      output->view(), _filter->get(), _stream, rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8,
+                 "Filter must evaluate to a boolean column");
+    output = cudf::detail::apply_boolean_mask(output->view(), predicate->view(), _stream, _mr);
+  }
+
+  return {std::move(output), std::move(out_metadata)};
+}
+
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       bool uses_custom_row_bounds,
+                                       std::vector<std::vector<size_type>> const& row_group_list)
+{
+  CUDF_EXPECTS(_chunk_read_limit == 0, "Reading the whole file must not have non-zero byte_limit.");
+  prepare_data(skip_rows, num_rows, uses_custom_row_bounds, row_group_list);
+  return read_chunk_internal(uses_custom_row_bounds);
+}
+
+bool reader::impl::has_next()
+{
+  prepare_data(_skip_rows, _num_rows, _uses_custom_row_bounds, _row_group_list);
+  return _current_read_chunk < _chunk_read_info.size();
+}
+
+table_with_metadata reader::impl::read_chunk()
+{
+  prepare_data(_skip_rows, _num_rows, _uses_custom_row_bounds, _row_group_list);
+
+  // Return an empty table once all the chunks have been read
+  if (_current_read_chunk >= _chunk_read_info.size()) {
+    _output_columns.clear();
+    std::transform(_output_buffers_template.cbegin(),
+                   _output_buffers_template.cend(),
+                   std::back_inserter(_output_columns),
+                   copy_unallocated_buffer);
+    return finalize_output({}, table_metadata{});
+  }
+
+  return read_chunk_internal(_uses_custom_row_bounds);
 }
 
 // Forward to implementation
@@ -1803,6 +2744,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
 {
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
@@ -1817,6 +2760,25 @@ table_with_metadata reader::read(parquet_reader_options const& options)
                      options.get_row_groups());
 }
 
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(chunk_read_limit, std::move(sources), options, stream, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -33,6 +33,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -48,6 +49,27 @@ using namespace cudf::io;
 // Forward declarations
 class aggregate_reader_metadata;
 
+/**
+ * @brief Struct to store the intermediate data that is shared between the chunks of a read.
+ */
+struct file_intermediate_data {
+  std::vector<std::unique_ptr<datasource::buffer>> raw_page_data;
+  rmm::device_buffer decomp_page_data;
+  rmm::device_buffer expanded_page_data;
+  hostdevice_vector<gpu::ColumnChunkDesc> chunks{};
+  hostdevice_vector<gpu::PageInfo> pages_info{};
+  hostdevice_vector<gpu::PageNestingInfo> page_nesting_info{};
+  bool has_lists = false;
+};
+
+/**
+ * @brief Struct describing the range of rows decoded by one chunk of a read.
+ */
+struct chunk_read_info {
+  size_t skip_rows;
+  size_t num_rows;
+};
+
 /**
  * @brief Implementation for Parquet reader
  */
@@ -66,6 +88,27 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from a chunk read limit and an array of dataset sources with reader
+   * options.
+   *
+   * The selected row groups are read and decompressed once. The decoded output is then split into
+   * row ranges at page boundaries such that each range is estimated to fit within
+   * `chunk_read_limit` bytes, and each call to `read_chunk()` decodes the next range.
+   *
+   * @param chunk_read_limit Limit on the total number of bytes returned per chunk, or `0` if
+   * there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                parquet_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -82,7 +125,111 @@ class reader::impl {
                            bool uses_custom_row_bounds,
                            std::vector<std::vector<size_type>> const& row_group_indices);
 
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next();
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return The output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk();
+
  private:
+  /**
+   * @brief Perform the necessary data preprocessing for reading data later on.
+   *
+   * Selects the row groups, reads and decompresses their pages and computes the row ranges of
+   * the chunks to be returned. This is done only once per file; subsequent calls are no-ops.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param uses_custom_row_bounds Whether or not num_rows and skip_rows represents user-specific
+   * bounds
+   * @param row_group_indices Lists of row groups to read, one per source
+   */
+  void prepare_data(size_type skip_rows,
+                    size_type num_rows,
+                    bool uses_custom_row_bounds,
+                    std::vector<std::vector<size_type>> const& row_group_indices);
+
+  /**
+   * @brief Removes the row groups that cannot contain rows satisfying the filter.
+   *
+   * The filter is converted into an expression on the min/max values of the referenced columns
+   * and evaluated on the column chunk statistics of every row group. The remaining row groups are
+   * then evaluated on the per-page statistics of their column indexes, if present, and dropped if
+   * none of their pages may match. The row ranges of the remaining row groups that may match are
+   * recorded in `_row_group_row_ranges`, so that only their pages are read.
+   *
+   * @param row_group_list Lists of row groups to read, one per source; empty if all row groups
+   * are to be read
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::vector<size_type>> const& row_group_list);
+
+  /**
+   * @brief Removes the row groups whose bloom filters show that they cannot contain rows
+   * satisfying the filter.
+   *
+   * Only the equality predicates of the filter on flat numeric and chrono columns are used. A
+   * predicate is satisfiable in a row group if the column chunk has no bloom filter, or if the
+   * bloom filter may contain the value.
+   *
+   * @param row_group_list Lists of row groups to read, one per source; empty if all row groups
+   * are to be read
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> probe_bloom_filters(
+    std::vector<std::vector<size_type>> const& row_group_list);
+
+  /**
+   * @brief Computes the row ranges of the chunks to be returned by `read_chunk()`.
+   *
+   * The estimated output size of every page is accumulated per input column, and the rows are
+   * split at page boundaries such that each chunk stays within `_chunk_read_limit` bytes. A chunk
+   * always contains at least one page boundary worth of rows, so it may exceed the limit if a
+   * single page is larger than the limit.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   */
+  void compute_chunk_read_info(size_t skip_rows, size_t num_rows);
+
+  /**
+   * @brief Decodes the next chunk of rows and creates the output table.
+   *
+   * @param uses_custom_row_bounds Whether or not the chunk row bounds should be applied while
+   * decoding
+   *
+   * @return The output table along with its metadata
+   */
+  table_with_metadata read_chunk_internal(bool uses_custom_row_bounds);
+
+  /**
+   * @brief Creates the output table metadata and assembles the output table.
+   *
+   * @param out_columns Output columns decoded for the current chunk
+   * @param out_metadata Output metadata with the schema info of the decoded columns
+   *
+   * @return The output table along with its metadata
+   */
+  table_with_metadata finalize_output(std::vector<std::unique_ptr<column>>&& out_columns,
+                                      table_metadata&& out_metadata);
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -90,15 +237,28 @@ class reader::impl {
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
-   * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_ranges File ranges to read for each chunk, concatenated in its buffer
+   * @param chunk_source_map Source index of each chunk
    *
    */
-  std::future<void> read_column_chunks(std::vector<std::unique_ptr<datasource::buffer>>& page_data,
-                                       hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                       size_t begin_chunk,
-                                       size_t end_chunk,
-                                       const std::vector<size_t>& column_chunk_offsets,
-                                       std::vector<size_type> const& chunk_source_map);
+  std::future<void> read_column_chunks(
+    std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    size_t begin_chunk,
+    size_t end_chunk,
+    std::vector<std::vector<datasource::range>> const& column_chunk_ranges,
+    std::vector<size_type> const& chunk_source_map);
+
+  /**
+   * @brief Reads the offset indexes of the input columns of a row group.
+   *
+   * @param row_group_index Index of the row group within its source
+   * @param source_index Index of the source
+   *
+   * @return The offset index of every input column, or an empty vector if a column has no valid
+   * offset index
+   */
+  std::vector<OffsetIndex> read_offset_indexes(size_type row_group_index, size_type source_index);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
@@ -199,12 +359,34 @@ class reader::impl {
   std::vector<input_column_info> _input_columns;
   // output columns to be generated
   std::vector<column_buffer> _output_columns;
+  // unallocated output column buffers, used to create `_output_columns` for every chunk
+  std::vector<column_buffer> _output_buffers_template;
   // _output_columns associated schema indices
   std::vector<int> _output_column_schemas;
 
   bool _strings_to_categorical = false;
   std::optional<std::vector<reader_column_schema>> _reader_column_schema;
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // rows [first, last) of the row groups that may match the filter, keyed by (source, row group);
+  // row groups without an entry are read in full
+  std::map<std::pair<size_type, size_type>, std::vector<std::pair<int64_t, int64_t>>>
+    _row_group_row_ranges;
+
+  // data shared between the chunks of a read
+  file_intermediate_data _file_itm_data;
+  bool _file_preprocessed{false};
+
+  // row ranges of the chunks to be returned, and the next one to decode
+  std::vector<chunk_read_info> _chunk_read_info;
+  std::size_t _current_read_chunk{0};
+  std::size_t _chunk_read_limit{0};
+
+  // row bounds requested through the reader options, used by the chunked reader
+  size_type _skip_rows{0};
+  size_type _num_rows{-1};
+  bool _uses_custom_row_bounds{false};
+  std::vector<std::vector<size_type>> _row_group_list;
 };
 
 }  // namespace parquet
@@ -21,16 +21,20 @@
 
 #include "writer_impl.hpp"
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_reader.hpp"
 #include "compact_protocol_writer.hpp"
 
+#include <io/comp/host_codec.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/host_memory.hpp>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/linked_column.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/detail/dremel.hpp>
@@ -54,6 +58,7 @@
 #include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <optional>
 #include <utility>
 
 namespace cudf {
@@ -64,12 +69,6 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to parquet compression
  */
@@ -79,6 +78,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
     case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
+    case compression_type::GZIP: return parquet::Compression::GZIP;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default: CUDF_FAIL("Unsupported compression type");
   }
@@ -189,6 +190,7 @@ struct aggregate_writer_metadata {
     std::vector<KeyValue> key_value_metadata;
     std::vector<OffsetIndex> offset_indexes;
     std::vector<std::vector<uint8_t>> column_indexes;
+    std::vector<std::vector<uint8_t>> bloom_filters;  // Empty for chunks without a bloom filter
   };
   std::vector<per_file_metadata> files;
   std::string created_by         = "";
@@ -209,6 +211,8 @@ struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  column_encoding requested_encoding = column_encoding::USE_DEFAULT;
+  bool bloom_filter                  = false;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -507,6 +511,38 @@ std::vector<schema_tree_node> construct_schema_tree(
         }
       };
 
+      auto set_encoding = [](schema_tree_node& s, column_in_metadata const& col_meta) {
+        auto const encoding = col_meta.get_encoding();
+        auto const is_valid = [&]() {
+          switch (encoding) {
+            case column_encoding::DICTIONARY:
+              return s.type != Type::BOOLEAN and not s.output_as_byte_array;
+            case column_encoding::DELTA_BINARY_PACKED:
+              return s.type == Type::INT32 or s.type == Type::INT64;
+            case column_encoding::DELTA_LENGTH_BYTE_ARRAY:
+            case column_encoding::DELTA_BYTE_ARRAY: return s.type == Type::BYTE_ARRAY;
+            case column_encoding::BYTE_STREAM_SPLIT:
+              return s.type == Type::FLOAT or s.type == Type::DOUBLE;
+            default: return true;
+          }
+        }();
+        CUDF_EXPECTS(is_valid, "Requested encoding is not valid for the type of the column");
+        s.requested_encoding = encoding;
+      };
+
+      auto set_bloom_filter = [parent_idx](schema_tree_node& s,
+                                           column_in_metadata const& col_meta) {
+        if (not col_meta.is_enabled_bloom_filter()) { return; }
+        auto const leaf_type = s.leaf_column->type().id();
+        auto const is_valid  = parent_idx == 0 and not s.output_as_byte_array and
+                              leaf_type != type_id::UINT8 and leaf_type != type_id::UINT16 and
+                              (s.type == Type::INT32 or s.type == Type::INT64 or
+                               s.type == Type::FLOAT or s.type == Type::DOUBLE or
+                               s.type == Type::BYTE_ARRAY);
+        CUDF_EXPECTS(is_valid, "Bloom filters are not supported for the type of the column");
+        s.bloom_filter = true;
+      };
+
       auto is_last_list_child = [](cudf::detail::LinkedColPtr col) {
         if (col->type().id() != type_id::LIST) { return false; }
         auto const child_col_type =
@@ -540,6 +576,8 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
         col_schema.output_as_byte_array = col_meta.is_enabled_output_as_binary();
+        set_encoding(col_schema, col_meta);
+        set_bloom_filter(col_schema, col_meta);
         schema.push_back(col_schema);
       } else if (col->type().id() == type_id::STRUCT) {
         // if struct, add current and recursively call for all children
@@ -668,6 +706,8 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.parent_idx  = parent_idx;
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
+        set_encoding(col_schema, col_meta);
+        set_bloom_filter(col_schema, col_meta);
         schema.push_back(col_schema);
       }
     };
@@ -703,6 +743,7 @@ struct parquet_column_view {
   [[nodiscard]] column_view cudf_column_view() const { return cudf_col; }
   [[nodiscard]] parquet::Type physical_type() const { return schema_node.type; }
   [[nodiscard]] parquet::ConvertedType converted_type() const { return schema_node.converted_type; }
+  [[nodiscard]] bool has_bloom_filter() const { return schema_node.bloom_filter; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -869,6 +910,7 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(
   desc.physical_type        = physical_type();
   desc.converted_type       = converted_type();
   desc.output_as_byte_array = schema_node.output_as_byte_array;
+  desc.requested_encoding   = schema_node.requested_encoding;
 
   desc.level_bits = CompactProtocolReader::NumRequiredBits(max_rep_level()) << 4 |
                     CompactProtocolReader::NumRequiredBits(max_def_level());
@@ -911,6 +953,9 @@ auto to_nvcomp_compression_type(Compression codec)
 {
   if (codec == Compression::SNAPPY) return nvcomp::compression_type::SNAPPY;
   if (codec == Compression::ZSTD) return nvcomp::compression_type::ZSTD;
+  if (codec == Compression::LZ4_RAW) return nvcomp::compression_type::LZ4;
+  // GZIP pages are DEFLATE streams with an added header and trailer
+  if (codec == Compression::GZIP) return nvcomp::compression_type::DEFLATE;
   CUDF_FAIL("Unsupported compression type");
 }
 
@@ -924,9 +969,27 @@ auto page_alignment(Compression codec)
   return 1u << nvcomp::compress_input_alignment_bits(to_nvcomp_compression_type(codec));
 }
 
+/**
+ * @brief Returns the host codec used when nvCOMP cannot compress pages with the given codec
+ */
+std::optional<compression_type> host_compression_fallback(Compression codec)
+{
+  if (codec == Compression::UNCOMPRESSED or
+      nvcomp::is_compression_enabled(to_nvcomp_compression_type(codec))) {
+    return std::nullopt;
+  }
+  if (codec == Compression::LZ4_RAW) return compression_type::LZ4;
+  if (codec == Compression::GZIP) return compression_type::GZIP;
+  return std::nullopt;
+}
+
 size_t max_compression_output_size(Compression codec, uint32_t compression_blocksize)
 {
   if (codec == Compression::UNCOMPRESSED) return 0;
+  if (auto const host_codec = host_compression_fallback(codec); host_codec.has_value()) {
+    return host::compress_max_output_chunk_size(*host_codec, compression_blocksize);
+  }
+  if (codec == Compression::GZIP) return gzip_max_output_chunk_size(compression_blocksize);
 
   return compress_max_output_chunk_size(to_nvcomp_compression_type(codec), compression_blocksize);
 }
@@ -981,13 +1044,16 @@ auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                         stream);
   page_sizes.device_to_host(stream, true);
 
-  // Get per-page max compressed size
+  // Get per-page max compressed size; rounded up so that the compressed pages stay aligned, as
+  // required by some of the nvCOMP compressors
   hostdevice_vector<size_type> comp_page_sizes(num_pages, stream);
   std::transform(page_sizes.begin(),
                  page_sizes.end(),
                  comp_page_sizes.begin(),
                  [compression_codec](auto page_size) {
-                   return max_compression_output_size(compression_codec, page_size);
+                   return cudf::util::round_up_unsafe(
+                     max_compression_output_size(compression_codec, page_size),
+                     static_cast<size_t>(page_alignment(compression_codec)));
                  });
   comp_page_sizes.host_to_device(stream);
 
@@ -1008,6 +1074,20 @@ auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   return comp_page_sizes;
 }
 
+/**
+ * @brief Returns the encoding of the data pages of a chunk that is not dictionary encoded
+ */
+Encoding data_page_encoding(column_encoding requested_encoding)
+{
+  switch (requested_encoding) {
+    case column_encoding::DELTA_BINARY_PACKED: return Encoding::DELTA_BINARY_PACKED;
+    case column_encoding::DELTA_LENGTH_BYTE_ARRAY: return Encoding::DELTA_LENGTH_BYTE_ARRAY;
+    case column_encoding::DELTA_BYTE_ARRAY: return Encoding::DELTA_BYTE_ARRAY;
+    case column_encoding::BYTE_STREAM_SPLIT: return Encoding::BYTE_STREAM_SPLIT;
+    default: return Encoding::PLAIN;
+  }
+}
+
 auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                               host_span<gpu::parquet_column_device_view const> col_desc,
                               device_2dspan<gpu::PageFragment const> frags,
@@ -1027,9 +1107,13 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   std::vector<rmm::device_uvector<gpu::slot_type>> hash_maps_storage;
   hash_maps_storage.reserve(h_chunks.size());
   for (auto& chunk : h_chunks) {
+    auto const requested_encoding = col_desc[chunk.col_desc_id].requested_encoding;
+    chunk.encoding                = data_page_encoding(requested_encoding);
     if (col_desc[chunk.col_desc_id].physical_type == Type::BOOLEAN ||
         (col_desc[chunk.col_desc_id].output_as_byte_array &&
-         col_desc[chunk.col_desc_id].physical_type == Type::BYTE_ARRAY)) {
+         col_desc[chunk.col_desc_id].physical_type == Type::BYTE_ARRAY) ||
+        (requested_encoding != column_encoding::USE_DEFAULT &&
+         requested_encoding != column_encoding::DICTIONARY)) {
       chunk.use_dictionary = false;
     } else {
       chunk.use_dictionary = true;
@@ -1073,7 +1157,8 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
 
       auto dict_enc_size = ck.uniq_data_size + rle_byte_size;
 
-      bool use_dict = (ck.plain_data_size > dict_enc_size);
+      bool use_dict = (ck.plain_data_size > dict_enc_size) or
+                      col_desc[ck.col_desc_id].requested_encoding == column_encoding::DICTIONARY;
       if (not use_dict) { rle_bits = 0; }
       return std::pair(use_dict, rle_bits);
     }();
@@ -1183,6 +1268,21 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
           nvcomp::compression_type::ZSTD, comp_in, comp_out, comp_res, stream);
       }
       break;
+    case parquet::Compression::LZ4_RAW:
+      if (nvcomp::is_compression_enabled(nvcomp::compression_type::LZ4)) {
+        nvcomp::batched_compress(
+          nvcomp::compression_type::LZ4, comp_in, comp_out, comp_res, stream);
+      } else {
+        host::batched_compress(compression_type::LZ4, comp_in, comp_out, comp_res, stream);
+      }
+      break;
+    case parquet::Compression::GZIP:
+      if (nvcomp::is_compression_enabled(nvcomp::compression_type::DEFLATE)) {
+        gpu_gzip(comp_in, comp_out, comp_res, stream);
+      } else {
+        host::batched_compress(compression_type::GZIP, comp_in, comp_out, comp_res, stream);
+      }
+      break;
     case parquet::Compression::UNCOMPRESSED: break;
     default: CUDF_FAIL("invalid compression type");
   }
@@ -1531,14 +1631,37 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
       size_t global_rg = global_rowgroup_base[p] + rg;
       for (int col = 0; col < num_columns; col++) {
-        if (chunks.host_view()[rg][col].use_dictionary) {
-          md->file(p).row_groups[global_rg].columns[col].meta_data.encodings.push_back(
-            Encoding::PLAIN_DICTIONARY);
+        auto const& ck  = chunks.host_view()[rg][col];
+        auto& encodings = md->file(p).row_groups[global_rg].columns[col].meta_data.encodings;
+        if (ck.use_dictionary) {
+          encodings.push_back(Encoding::PLAIN_DICTIONARY);
+        } else if (ck.encoding != Encoding::PLAIN) {
+          encodings = {ck.encoding, Encoding::RLE};
         }
       }
     }
   }
 
+  // Allocate the bloom filters, sized for the number of distinct values of each chunk
+  size_t bloom_filter_bfr_size = 0;
+  for (auto& ck : chunks.host_view().flat_view()) {
+    ck.bloom_filter_size =
+      parquet_columns[ck.col_desc_id].has_bloom_filter()
+        ? bloom_filter_size(ck.use_dictionary ? ck.num_dict_entries : ck.num_values)
+        : 0;
+    bloom_filter_bfr_size += ck.bloom_filter_size;
+  }
+  rmm::device_buffer bloom_filter_bfr(bloom_filter_bfr_size, stream);
+  if (bloom_filter_bfr_size != 0) {
+    CUDF_CUDA_TRY(
+      cudaMemsetAsync(bloom_filter_bfr.data(), 0, bloom_filter_bfr_size, stream.value()));
+  }
+  auto bfr_b = static_cast<uint8_t*>(bloom_filter_bfr.data());
+  for (auto& ck : chunks.host_view().flat_view()) {
+    ck.bloom_filter = (ck.bloom_filter_size != 0) ? reinterpret_cast<uint32_t*>(bfr_b) : nullptr;
+    bfr_b += ck.bloom_filter_size;
+  }
+
   // Build chunk dictionaries and count pages
   hostdevice_vector<size_type> comp_page_sizes = init_page_sizes(
     chunks, col_desc, num_columns, max_page_size_bytes, max_page_size_rows, compression_, stream);
@@ -1651,7 +1774,7 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                        num_stats_bfr);
   }
 
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  cudf::io::detail::pinned_buffer<uint8_t> host_bfr;
 
   // Encode row groups in batches
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
@@ -1706,12 +1829,7 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
           }
         } else {
           if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t* ptr = nullptr;
-                                                CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
+            host_bfr = cudf::io::detail::make_pinned_buffer<uint8_t>(max_chunk_bfr_size);
           }
           // copy the full data
           CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
@@ -1741,6 +1859,28 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     }
   }
 
+  if (bloom_filter_bfr_size != 0) {
+    gpu::EncodeBloomFilters(chunks.device_view().flat_view(), stream);
+    std::vector<uint8_t> h_bloom_filters(bloom_filter_bfr_size);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_bloom_filters.data(),
+                                  bloom_filter_bfr.data(),
+                                  bloom_filter_bfr_size,
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+    stream.synchronize();
+
+    // add the bloom filters to the metadata; they are written to the file on close
+    auto h_bfr = h_bloom_filters.data();
+    for (size_type r = 0; r < num_rowgroups; r++) {
+      int p = rg_to_part[r];
+      for (auto i = 0; i < num_columns; i++) {
+        auto const& ck = chunks[r][i];
+        md->file(p).bloom_filters.emplace_back(h_bfr, h_bfr + ck.bloom_filter_size);
+        h_bfr += ck.bloom_filter_size;
+      }
+    }
+  }
+
   if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
     // need pages on host to create offset_indexes
     thrust::host_vector<gpu::EncPage> h_pages = cudf::detail::make_host_vector_async(pages, stream);
@@ -1806,6 +1946,30 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
     CompactProtocolWriter cpw(&buffer);
     file_ender_s fendr;
 
+    if (not md->file(p).bloom_filters.empty()) {
+      auto& fmd = md->file(p);
+
+      // write bloom filters, updating column metadata along the way
+      BloomFilterHeader header;
+      header.algorithm.isset.BLOCK          = true;
+      header.hash.isset.XXHASH              = true;
+      header.compression.isset.UNCOMPRESSED = true;
+      int chunkidx                          = 0;
+      for (auto& r : fmd.row_groups) {
+        for (auto& c : r.columns) {
+          auto const& bitset = fmd.bloom_filters[chunkidx++];
+          if (bitset.empty()) { continue; }
+          buffer.resize(0);
+          header.num_bytes                = bitset.size();
+          auto const header_len           = cpw.write(header);
+          c.meta_data.bloom_filter_offset = out_sink_[p]->bytes_written();
+          c.meta_data.bloom_filter_length = header_len + bitset.size();
+          out_sink_[p]->host_write(buffer.data(), buffer.size());
+          out_sink_[p]->host_write(bitset.data(), bitset.size());
+        }
+      }
+    }
+
     if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
       auto& fmd = md->file(p);
 
@@ -14,15 +14,32 @@
  * limitations under the License.
  */
 
+#include <io/comp/nvcomp_adapter.hpp>
+#include <io/comp/unbz2.hpp>
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/host_memory.hpp>
+#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/datasource.hpp>
 #include <cudf/io/text/data_chunk_source_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/device_buffer.hpp>
 
-#include <thrust/host_vector.h>
-#include <thrust/system/cuda/experimental/pinned_allocator.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
+#include <future>
+#include <iterator>
+#include <optional>
 
 namespace cudf::io::text {
 
@@ -59,7 +76,7 @@ class device_uvector_data_chunk : public device_data_chunk {
 class istream_data_chunk_reader : public data_chunk_reader {
   struct host_ticket {
     cudaEvent_t event;
-    thrust::host_vector<char, thrust::system::cuda::experimental::pinned_allocator<char>> buffer;
+    cudf::io::detail::pinned_host_vector<char> buffer;
   };
 
  public:
@@ -168,6 +185,792 @@ class host_span_data_chunk_reader : public data_chunk_reader {
   cudf::host_span<const char> _data;
 };
 
+/**
+ * @brief A read-only memory mapping of a whole file.
+ */
+class memory_mapped_file {
+ public:
+  memory_mapped_file(std::string const& filename) : _file(filename, O_RDONLY)
+  {
+    if (_file.size() != 0) {
+      _map = mmap(nullptr, _file.size(), PROT_READ, MAP_PRIVATE, _file.desc(), 0);
+      CUDF_EXPECTS(_map != MAP_FAILED, "Cannot memory-map file " + filename);
+      // Let the kernel read ahead aggressively and drop the pages once they are read
+      madvise(_map, _file.size(), MADV_SEQUENTIAL);
+    }
+  }
+
+  memory_mapped_file(memory_mapped_file const&) = delete;
+  memory_mapped_file& operator=(memory_mapped_file const&) = delete;
+
+  ~memory_mapped_file()
+  {
+    if (_map != nullptr) { munmap(_map, _file.size()); }
+  }
+
+  [[nodiscard]] uint8_t const* data() const { return static_cast<uint8_t const*>(_map); }
+  [[nodiscard]] std::size_t size() const { return _file.size(); }
+
+ private:
+  cudf::io::detail::file_wrapper const _file;
+  void* _map = nullptr;
+};
+
+/**
+ * @brief A reader which produces owning chunks of device memory which contain a copy of the data
+ * from a memory-mapped file.
+ */
+class mmap_data_chunk_reader : public data_chunk_reader {
+ public:
+  mmap_data_chunk_reader(std::string const& filename)
+    : _file(filename),
+      _reader({reinterpret_cast<char const*>(_file.data()), _file.size()})
+  {
+  }
+
+  void skip_bytes(std::size_t size) override { _reader.skip_bytes(size); }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    // Copies from pageable memory return once the data is staged, so the mapping can be released
+    // before the copy completes
+    return _reader.get_next_chunk(read_size, stream);
+  }
+
+ private:
+  memory_mapped_file const _file;
+  host_span_data_chunk_reader _reader;
+};
+
+/**
+ * @brief A reader which produces owning chunks of device memory which contain a copy of the data
+ * from a file, read ahead of the requests with parallel `pread` calls into pinned buffers.
+ *
+ * The file is read in `read_size` blocks, each into its own pinned buffer; up to `read_ahead`
+ * blocks are read concurrently on the I/O thread pool.
+ */
+class pread_data_chunk_reader : public data_chunk_reader {
+  struct ticket {
+    cudaEvent_t event;
+    cudf::io::detail::pinned_buffer<char> buffer;
+    std::size_t offset = 0;
+    std::size_t size   = 0;
+    std::future<void> read;
+  };
+
+ public:
+  pread_data_chunk_reader(std::string const& filename,
+                          std::size_t read_size,
+                          std::size_t read_ahead)
+    : _file(filename, O_RDONLY),
+      _read_size(std::clamp<std::size_t>(read_size, 1, std::max<std::size_t>(_file.size(), 1))),
+      _tickets(std::max<std::size_t>(read_ahead, 1))
+  {
+    for (auto& ticket : _tickets) {
+      CUDF_CUDA_TRY(cudaEventCreate(&(ticket.event)));
+      ticket.buffer = cudf::io::detail::make_pinned_buffer<char>(_read_size);
+    }
+  }
+
+  ~pread_data_chunk_reader() override
+  {
+    for (auto& ticket : _tickets) {
+      // the buffer must outlive the read
+      if (ticket.read.valid()) { ticket.read.wait(); }
+      CUDF_CUDA_TRY(cudaEventDestroy(ticket.event));
+    }
+  }
+
+  void skip_bytes(std::size_t size) override
+  {
+    _position += std::min(size, _file.size() - _position);
+    drop_consumed();
+  }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+
+    read_size = std::min(read_size, _file.size() - _position);
+
+    // get a device buffer containing read data on the device.
+    auto chunk = rmm::device_uvector<char>(read_size, stream);
+
+    std::size_t copied = 0;
+    while (copied < read_size) {
+      queue_reads();
+      auto& ticket = _tickets[_first];
+      if (ticket.read.valid()) { ticket.read.get(); }
+
+      auto const ticket_offset = _position - ticket.offset;
+      auto const copy_size     = std::min(read_size - copied, ticket.size - ticket_offset);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(chunk.data() + copied,
+                                    ticket.buffer.get() + ticket_offset,
+                                    copy_size,
+                                    cudaMemcpyHostToDevice,
+                                    stream.value()));
+      // record the host-to-device copy, so the buffer is not refilled before the copy completes
+      CUDF_CUDA_TRY(cudaEventRecord(ticket.event, stream.value()));
+
+      copied += copy_size;
+      _position += copy_size;
+      drop_consumed();
+    }
+    // keep reading ahead while the chunk is processed
+    queue_reads();
+
+    // return the device buffer so it can be processed.
+    return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  /**
+   * @brief Starts reads into the free buffers, following the last queued block
+   */
+  void queue_reads()
+  {
+    while (_num_queued < _tickets.size() and _next_read < _file.size()) {
+      auto& ticket = _tickets[(_first + _num_queued) % _tickets.size()];
+      // a skipped block can still be in flight
+      if (ticket.read.valid()) { ticket.read.get(); }
+      CUDF_CUDA_TRY(cudaEventSynchronize(ticket.event));
+
+      ticket.offset = _next_read;
+      ticket.size   = std::min(_read_size, _file.size() - _next_read);
+      ticket.read   = cudf::detail::io_thread_pool().submit(
+        [fd = _file.desc(), dst = ticket.buffer.get(), size = ticket.size, offset = ticket.offset] {
+          read_fully(fd, dst, size, offset);
+        });
+      _next_read += ticket.size;
+      ++_num_queued;
+    }
+  }
+
+  /**
+   * @brief Releases the queued blocks that end before the current position
+   */
+  void drop_consumed()
+  {
+    while (_num_queued > 0 and _tickets[_first].offset + _tickets[_first].size <= _position) {
+      _first = (_first + 1) % _tickets.size();
+      --_num_queued;
+    }
+    _next_read = std::max(_next_read, _position);
+  }
+
+  static void read_fully(int fd, char* dst, std::size_t size, std::size_t offset)
+  {
+    while (size > 0) {
+      auto const bytes_read = pread(fd, dst, size, offset);
+      CUDF_EXPECTS(bytes_read > 0, "Cannot read from file");
+      dst += bytes_read;
+      size -= bytes_read;
+      offset += bytes_read;
+    }
+  }
+
+  cudf::io::detail::file_wrapper const _file;
+  std::size_t const _read_size;
+  std::vector<ticket> _tickets;
+  std::size_t _first      = 0;  // index of the oldest queued block
+  std::size_t _num_queued = 0;
+  std::size_t _next_read  = 0;  // file offset of the next block to queue
+  std::size_t _position   = 0;
+};
+
+/**
+ * @brief A reader which produces owning chunks of device memory which are read directly from a
+ * datasource into device memory.
+ */
+class datasource_device_read_chunk_reader : public data_chunk_reader {
+ public:
+  datasource_device_read_chunk_reader(std::unique_ptr<datasource> source)
+    : _source(std::move(source))
+  {
+  }
+
+  void skip_bytes(std::size_t size) override
+  {
+    _position += std::min(size, _source->size() - _position);
+  }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+
+    read_size = std::min(read_size, _source->size() - _position);
+
+    auto chunk = rmm::device_uvector<char>(read_size, stream);
+    if (read_size != 0) {
+      _source->device_read(_position, read_size, reinterpret_cast<uint8_t*>(chunk.data()), stream);
+    }
+    _position += read_size;
+
+    return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  std::unique_ptr<datasource> _source;
+  std::size_t _position = 0;
+};
+
+/**
+ * @brief Reads a little-endian unsigned integer of `num_bytes` bytes.
+ */
+std::size_t read_le(uint8_t const* data, int num_bytes)
+{
+  std::size_t value = 0;
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+/**
+ * @brief Detects the compression of a file from its magic number.
+ */
+compression_type detect_compression(host_span<uint8_t const> data)
+{
+  if (data.size() >= 2 and data[0] == 0x1f and data[1] == 0x8b) { return compression_type::GZIP; }
+  if (data.size() >= 4 and data[0] == 'B' and data[1] == 'Z' and data[2] == 'h' and
+      data[3] >= '1' and data[3] <= '9') {
+    return compression_type::BZIP2;
+  }
+  if (data.size() >= 4 and read_le(data.data(), 4) == 0xfd2f'b528) {
+    return compression_type::ZSTD;
+  }
+  return compression_type::NONE;
+}
+
+/**
+ * @brief Decompresses a file on the host, in pieces of the requested size.
+ */
+class host_decompressor {
+ public:
+  virtual ~host_decompressor() = default;
+
+  /**
+   * @brief Decompresses the next bytes of the file into `dst`.
+   *
+   * @return The number of bytes written, less than `size` only at the end of the file
+   */
+  virtual std::size_t decompress(uint8_t* dst, std::size_t size) = 0;
+
+  /**
+   * @brief Skips the next `size` bytes of the decompressed file.
+   */
+  virtual void skip(std::size_t size)
+  {
+    while (size > 0) {
+      if (discard(size) == 0) { return; }
+    }
+  }
+
+ protected:
+  /**
+   * @brief Decompresses and drops up to `size` bytes, returning the number of bytes dropped.
+   */
+  std::size_t discard(std::size_t& size)
+  {
+    _scratch.resize(std::min<std::size_t>(size, 1 << 20));
+    auto const discarded = decompress(_scratch.data(), _scratch.size());
+    size -= discarded;
+    return discarded;
+  }
+
+ private:
+  std::vector<uint8_t> _scratch;
+};
+
+/**
+ * @brief Inflates the members of a GZIP file.
+ *
+ * Skipping uses the block sizes recorded in BGZF headers to jump over whole blocks.
+ */
+class gzip_decompressor : public host_decompressor {
+  struct bgzf_block {
+    std::size_t size;   // compressed size of the whole member
+    std::size_t isize;  // decompressed size
+  };
+
+  // zlib counts the input and output in 32-bit integers
+  static constexpr std::size_t max_inflate_size = 1 << 30;
+
+ public:
+  gzip_decompressor(host_span<uint8_t const> data) : _data(data)
+  {
+    // accept GZIP headers only
+    CUDF_EXPECTS(inflateInit2(&_strm, 16 + MAX_WBITS) == Z_OK, "Cannot initialize zlib");
+    start_member(0);
+  }
+
+  ~gzip_decompressor() override { inflateEnd(&_strm); }
+
+  std::size_t decompress(uint8_t* dst, std::size_t size) override
+  {
+    std::size_t produced = 0;
+    while (produced < size and not _done) {
+      if (_strm.avail_in == 0) {
+        _strm.next_in  = const_cast<Bytef*>(_data.data() + _in_pos);
+        _strm.avail_in = std::min(_data.size() - _in_pos, max_inflate_size);
+        _in_pos += _strm.avail_in;
+      }
+      _strm.next_out  = dst + produced;
+      _strm.avail_out = std::min(size - produced, max_inflate_size);
+
+      auto const avail_out = _strm.avail_out;
+      auto const zerr      = inflate(&_strm, Z_NO_FLUSH);
+      produced += avail_out - _strm.avail_out;
+      if (zerr == Z_STREAM_END) {
+        start_member(_in_pos - _strm.avail_in);
+      } else {
+        CUDF_EXPECTS(zerr == Z_OK, "Error in GZIP stream");
+      }
+    }
+    return produced;
+  }
+
+  void skip(std::size_t size) override
+  {
+    while (size > 0 and not _done) {
+      auto const block = find_bgzf_block(_member_start);
+      // jump to the next member if the rest of this one is skipped
+      if (block.has_value() and size >= block->isize - _strm.total_out) {
+        size -= block->isize - _strm.total_out;
+        start_member(_member_start + block->size);
+      } else if (discard(size) == 0) {
+        return;
+      }
+    }
+  }
+
+ private:
+  /**
+   * @brief Resets the inflate state to the member starting at `offset`, unless the file ends there.
+   *
+   * Trailing bytes that do not start a GZIP member, such as zero padding, are ignored.
+   */
+  void start_member(std::size_t offset)
+  {
+    auto const is_member =
+      offset + 2 <= _data.size() and
+      detect_compression(_data.subspan(offset, 2)) == compression_type::GZIP;
+    _member_start  = offset;
+    _in_pos        = offset;
+    _strm.avail_in = 0;
+    _done          = not is_member;
+    if (not _done) { CUDF_EXPECTS(inflateReset(&_strm) == Z_OK, "Cannot reset zlib"); }
+  }
+
+  /**
+   * @brief Returns the sizes recorded in the BGZF header of the member at `offset`, if any.
+   */
+  [[nodiscard]] std::optional<bgzf_block> find_bgzf_block(std::size_t offset) const
+  {
+    constexpr std::size_t header_size  = 12;
+    constexpr std::size_t trailer_size = 8;
+    constexpr uint8_t flag_extra       = 4;
+    if (offset + header_size > _data.size()) { return std::nullopt; }
+    auto const header = _data.data() + offset;
+    if (header[2] != 8 or (header[3] & flag_extra) == 0) { return std::nullopt; }
+
+    auto const extra_size = read_le(header + 10, 2);
+    if (offset + header_size + extra_size > _data.size()) { return std::nullopt; }
+    for (std::size_t pos = header_size; pos + 4 <= header_size + extra_size;) {
+      auto const field_size = read_le(header + pos + 2, 2);
+      if (header[pos] == 'B' and header[pos + 1] == 'C' and field_size == 2 and
+          pos + 6 <= header_size + extra_size) {
+        auto const size = read_le(header + pos + 4, 2) + 1;
+        if (size < header_size + extra_size + trailer_size or offset + size > _data.size()) {
+          return std::nullopt;
+        }
+        return bgzf_block{size, read_le(header + size - 4, 4)};
+      }
+      pos += 4 + field_size;
+    }
+    return std::nullopt;
+  }
+
+  host_span<uint8_t const> _data;
+  z_stream _strm{};
+  std::size_t _in_pos       = 0;  // offset of the input following what was passed to zlib
+  std::size_t _member_start = 0;
+  bool _done                = false;
+};
+
+/**
+ * @brief Decompresses the blocks of a BZIP2 file.
+ *
+ * The blocks are decompressed as many at a time as fit in the output buffer, which starts at
+ * `buffer_size` bytes and grows when a single block does not fit.
+ */
+class bzip2_decompressor : public host_decompressor {
+ public:
+  bzip2_decompressor(host_span<uint8_t const> data, std::size_t buffer_size)
+    : _data(data), _buffer(std::max<std::size_t>(buffer_size, 1))
+  {
+  }
+
+  std::size_t decompress(uint8_t* dst, std::size_t size) override
+  {
+    std::size_t produced = 0;
+    while (produced < size) {
+      if (_buffer_pos == _buffer_size and not decompress_blocks()) { break; }
+      auto const copy_size = std::min(size - produced, _buffer_size - _buffer_pos);
+      std::memcpy(dst + produced, _buffer.data() + _buffer_pos, copy_size);
+      produced += copy_size;
+      _buffer_pos += copy_size;
+    }
+    return produced;
+  }
+
+ private:
+  /**
+   * @brief Refills the output buffer, returning false at the end of the file.
+   */
+  bool decompress_blocks()
+  {
+    while (_stream_start + 4 <= _data.size() and
+           detect_compression(_data.subspan(_stream_start, 4)) == compression_type::BZIP2) {
+      auto const stream = _data.subspan(_stream_start, _data.size() - _stream_start);
+      _buffer_pos       = 0;
+      _buffer_size      = _buffer.size();
+      auto const err =
+        cpu_bz2_uncompress(stream.data(), stream.size(), _buffer.data(), &_buffer_size, &_block);
+      if (err == BZ_OK) {
+        // the stream ends with a 32-bit CRC, padded to a byte; another stream can follow
+        _stream_start += (_block + 32 + 7) / 8;
+        _block = 0;
+      } else {
+        CUDF_EXPECTS(err == BZ_OUTBUFF_FULL, "Error in BZIP2 stream");
+        // grow the buffer until it fits a whole block
+        if (_buffer_size == 0) { _buffer.resize(_buffer.size() * 2); }
+      }
+      if (_buffer_size != 0) { return true; }
+    }
+    return false;
+  }
+
+  host_span<uint8_t const> _data;
+  std::vector<uint8_t> _buffer;
+  std::size_t _buffer_pos   = 0;
+  std::size_t _buffer_size  = 0;
+  std::size_t _stream_start = 0;
+  uint64_t _block           = 0;  // bit offset of the next block in the current stream
+};
+
+/**
+ * @brief A reader which produces owning chunks of device memory which contain the data of a
+ * compressed file, decompressed on the host into pinned buffers.
+ */
+class host_decompress_data_chunk_reader : public data_chunk_reader {
+  struct host_ticket {
+    cudaEvent_t event;
+    cudf::io::detail::pinned_host_vector<uint8_t> buffer;
+  };
+
+ public:
+  host_decompress_data_chunk_reader(std::string const& filename,
+                                    compression_type compression,
+                                    std::size_t buffer_size)
+    : _file(filename), _tickets(2)
+  {
+    auto const data = host_span<uint8_t const>{_file.data(), _file.size()};
+    if (compression == compression_type::GZIP) {
+      _decompressor = std::make_unique<gzip_decompressor>(data);
+    } else {
+      _decompressor = std::make_unique<bzip2_decompressor>(data, buffer_size);
+    }
+    for (auto& ticket : _tickets) {
+      CUDF_CUDA_TRY(cudaEventCreate(&(ticket.event)));
+    }
+  }
+
+  ~host_decompress_data_chunk_reader() override
+  {
+    for (auto& ticket : _tickets) {
+      CUDF_CUDA_TRY(cudaEventDestroy(ticket.event));
+    }
+  }
+
+  void skip_bytes(std::size_t size) override { _decompressor->skip(size); }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+
+    auto& h_ticket = _tickets[_next_ticket_idx];
+
+    _next_ticket_idx = (_next_ticket_idx + 1) % _tickets.size();
+
+    // synchronize on the last host-to-device copy, so we don't clobber the host buffer.
+    CUDF_CUDA_TRY(cudaEventSynchronize(h_ticket.event));
+
+    if (h_ticket.buffer.size() < read_size) { h_ticket.buffer.resize(read_size); }
+
+    // the last chunk is shorter than requested
+    read_size = _decompressor->decompress(h_ticket.buffer.data(), read_size);
+
+    auto chunk = rmm::device_uvector<char>(read_size, stream);
+
+    CUDF_CUDA_TRY(cudaMemcpyAsync(  //
+      chunk.data(),
+      h_ticket.buffer.data(),
+      read_size,
+      cudaMemcpyHostToDevice,
+      stream.value()));
+
+    // record the host-to-device copy.
+    CUDF_CUDA_TRY(cudaEventRecord(h_ticket.event, stream.value()));
+
+    return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  memory_mapped_file const _file;
+  std::unique_ptr<host_decompressor> _decompressor;
+  std::size_t _next_ticket_idx = 0;
+  std::vector<host_ticket> _tickets;
+};
+
+/**
+ * @brief Location of a ZSTD frame in the compressed and in the decompressed file
+ */
+struct zstd_frame {
+  std::size_t offset;
+  std::size_t size;
+  std::size_t uncomp_offset;
+  std::size_t uncomp_size;
+};
+
+/**
+ * @brief Reads the frame locations from the seek table of a ZSTD seekable file.
+ *
+ * @return The frames, or an empty vector if the file has no valid seek table
+ */
+std::vector<zstd_frame> read_zstd_seek_table(host_span<uint8_t const> data)
+{
+  constexpr std::size_t footer_size       = 9;
+  constexpr std::size_t frame_header_size = 8;
+  constexpr uint8_t flag_checksum         = 0x80;
+  if (data.size() < footer_size + frame_header_size or
+      read_le(data.end() - 4, 4) != 0x8f92'eab1) {
+    return {};
+  }
+  auto const num_frames = read_le(data.end() - footer_size, 4);
+  auto const entry_size = (data.end()[-5] & flag_checksum) ? 12 : 8;
+  auto const table_size = num_frames * entry_size + footer_size;
+  if (table_size + frame_header_size > data.size()) { return {}; }
+  auto const table_start = data.size() - table_size;
+  if (read_le(data.data() + table_start - frame_header_size, 4) != 0x184d'2a5e or
+      read_le(data.data() + table_start - 4, 4) != table_size) {
+    return {};
+  }
+
+  std::vector<zstd_frame> frames;
+  std::size_t offset        = 0;
+  std::size_t uncomp_offset = 0;
+  for (std::size_t i = 0; i < num_frames; ++i) {
+    auto const entry       = data.data() + table_start + i * entry_size;
+    auto const size        = read_le(entry, 4);
+    auto const uncomp_size = read_le(entry + 4, 4);
+    if (uncomp_size != 0) { frames.push_back({offset, size, uncomp_offset, uncomp_size}); }
+    offset += size;
+    uncomp_offset += uncomp_size;
+  }
+  if (offset != table_start - frame_header_size) { return {}; }
+  return frames;
+}
+
+/**
+ * @brief Locates the frames of a ZSTD file, from its seek table or by walking the frame headers.
+ */
+std::vector<zstd_frame> find_zstd_frames(host_span<uint8_t const> data)
+{
+  auto frames = read_zstd_seek_table(data);
+  if (not frames.empty()) { return frames; }
+
+  std::size_t offset        = 0;
+  std::size_t uncomp_offset = 0;
+  auto const expect_bytes   = [&](std::size_t pos, std::size_t size) {
+    CUDF_EXPECTS(pos + size <= data.size(), "Truncated ZSTD frame");
+  };
+  while (offset < data.size()) {
+    expect_bytes(offset, 4);
+    auto const magic = read_le(data.data() + offset, 4);
+    if ((magic & 0xffff'fff0) == 0x184d'2a50) {
+      // skippable frame
+      expect_bytes(offset, 8);
+      offset += 8 + read_le(data.data() + offset + 4, 4);
+      continue;
+    }
+    CUDF_EXPECTS(magic == 0xfd2f'b528, "Invalid ZSTD frame");
+
+    auto pos = offset + 4;
+    expect_bytes(pos, 1);
+    auto const descriptor     = data[pos++];
+    auto const size_flag      = descriptor >> 6;
+    bool const single_segment = descriptor & 0x20;
+    bool const has_checksum   = descriptor & 0x04;
+    auto const dict_id_flag   = descriptor & 0x03;
+    if (not single_segment) { ++pos; }
+    pos += std::array<std::size_t, 4>{0, 1, 2, 4}[dict_id_flag];
+    auto const size_bytes = size_flag == 0 ? (single_segment ? 1 : 0) : 1 << size_flag;
+    CUDF_EXPECTS(size_bytes != 0, "ZSTD frames must record their decompressed size");
+    expect_bytes(pos, size_bytes);
+    auto const uncomp_size = read_le(data.data() + pos, size_bytes) + (size_bytes == 2 ? 256 : 0);
+    pos += size_bytes;
+
+    bool last_block = false;
+    while (not last_block) {
+      expect_bytes(pos, 3);
+      auto const block_header = read_le(data.data() + pos, 3);
+      auto const block_type   = (block_header >> 1) & 3;
+      CUDF_EXPECTS(block_type != 3, "Invalid ZSTD block");
+      last_block = block_header & 1;
+      // RLE blocks store the repeated byte only
+      pos += 3 + (block_type == 1 ? 1 : block_header >> 3);
+    }
+    if (has_checksum) { pos += 4; }
+    expect_bytes(pos, 0);
+
+    if (uncomp_size != 0) { frames.push_back({offset, pos - offset, uncomp_offset, uncomp_size}); }
+    offset = pos;
+    uncomp_offset += uncomp_size;
+  }
+  return frames;
+}
+
+/**
+ * @brief A reader which produces owning chunks of device memory which contain the data of a ZSTD
+ * file, decompressed on the device with nvCOMP.
+ *
+ * The frames that cover a requested chunk are decompressed in one batch. Skipping bytes does not
+ * decompress the skipped frames.
+ */
+class zstd_data_chunk_reader : public data_chunk_reader {
+ public:
+  zstd_data_chunk_reader(std::string const& filename)
+    : _file(filename),
+      _frames(find_zstd_frames({_file.data(), _file.size()})),
+      _decoded(0, cudf::default_stream_value)
+  {
+  }
+
+  void skip_bytes(std::size_t size) override
+  {
+    _position += std::min(size, total_size() - _position);
+  }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+
+    read_size = std::min(read_size, total_size() - _position);
+
+    auto chunk = rmm::device_uvector<char>(read_size, stream);
+
+    std::size_t copied = 0;
+    while (copied < read_size) {
+      if (_position < _decoded_offset or _position >= _decoded_offset + _decoded.size()) {
+        decompress_frames(read_size - copied, stream);
+      }
+      auto const decoded_pos = _position - _decoded_offset;
+      auto const copy_size   = std::min(read_size - copied, _decoded.size() - decoded_pos);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(chunk.data() + copied,
+                                    _decoded.data() + decoded_pos,
+                                    copy_size,
+                                    cudaMemcpyDeviceToDevice,
+                                    stream.value()));
+      copied += copy_size;
+      _position += copy_size;
+    }
+
+    return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  [[nodiscard]] std::size_t total_size() const
+  {
+    return _frames.empty() ? 0 : _frames.back().uncomp_offset + _frames.back().uncomp_size;
+  }
+
+  /**
+   * @brief Decompresses the frames that contain the next `size` bytes, starting at the current
+   * position.
+   */
+  void decompress_frames(std::size_t size, rmm::cuda_stream_view stream)
+  {
+    auto const starts_after = [](std::size_t position, zstd_frame const& frame) {
+      return position < frame.uncomp_offset;
+    };
+    auto const first =
+      std::prev(std::upper_bound(_frames.begin(), _frames.end(), _position, starts_after));
+    auto last = std::next(first);
+    while (last != _frames.end() and last->uncomp_offset < _position + size) {
+      ++last;
+    }
+    auto const num_frames = static_cast<std::size_t>(std::distance(first, last));
+
+    auto const comp_offset = first->offset;
+    auto const comp_size   = std::prev(last)->offset + std::prev(last)->size - comp_offset;
+    auto const uncomp_size =
+      std::prev(last)->uncomp_offset + std::prev(last)->uncomp_size - first->uncomp_offset;
+
+    auto compressed = rmm::device_uvector<uint8_t>(comp_size, stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(compressed.data(),
+                                  _file.data() + comp_offset,
+                                  comp_size,
+                                  cudaMemcpyHostToDevice,
+                                  stream.value()));
+    _decoded        = rmm::device_uvector<char>(uncomp_size, stream);
+    _decoded_offset = first->uncomp_offset;
+
+    auto inputs       = hostdevice_vector<device_span<uint8_t const>>(num_frames, stream);
+    auto outputs      = hostdevice_vector<device_span<uint8_t>>(num_frames, stream);
+    auto results      = hostdevice_vector<compression_result>(num_frames, stream);
+    auto const output = reinterpret_cast<uint8_t*>(_decoded.data());
+    std::size_t max_uncomp_size = 0;
+    for (std::size_t i = 0; i < num_frames; ++i) {
+      auto const& frame = first[i];
+      inputs[i]         = {compressed.data() + frame.offset - comp_offset, frame.size};
+      outputs[i]        = {output + frame.uncomp_offset - _decoded_offset, frame.uncomp_size};
+      results[i]        = compression_result{0, compression_status::FAILURE};
+      max_uncomp_size   = std::max(max_uncomp_size, frame.uncomp_size);
+    }
+    inputs.host_to_device(stream);
+    outputs.host_to_device(stream);
+    results.host_to_device(stream);
+
+    nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                               inputs,
+                               outputs,
+                               results,
+                               max_uncomp_size,
+                               uncomp_size,
+                               stream);
+
+    // also keeps the compressed data alive until the decompression completes
+    results.device_to_host(stream, true);
+    for (std::size_t i = 0; i < num_frames; ++i) {
+      CUDF_EXPECTS(results[i].status == compression_status::SUCCESS and
+                     results[i].bytes_written == first[i].uncomp_size,
+                   "ZSTD decompression failed");
+    }
+  }
+
+  memory_mapped_file const _file;
+  std::vector<zstd_frame> const _frames;
+  rmm::device_uvector<char> _decoded;
+  std::size_t _decoded_offset = 0;  // position of the decoded frames in the decompressed file
+  std::size_t _position       = 0;
+};
+
 /**
  * @brief A reader which produces view of device memory which represent a subset of the input device
  * span.
@@ -203,19 +1006,60 @@ class device_span_data_chunk_reader : public data_chunk_reader {
 };
 
 /**
- * @brief A file data source which creates an istream_data_chunk_reader.
+ * @brief A file data source which creates a reader according to the file read mode.
  */
 class file_data_chunk_source : public data_chunk_source {
  public:
-  file_data_chunk_source(std::string filename) : _filename(std::move(filename)) {}
+  file_data_chunk_source(std::string filename, file_source_options const& options)
+    : _filename(std::move(filename)), _options(options)
+  {
+  }
   [[nodiscard]] std::unique_ptr<data_chunk_reader> create_reader() const override
   {
-    return std::make_unique<istream_data_chunk_reader>(
-      std::make_unique<std::ifstream>(_filename, std::ifstream::in));
+    if (_options.compression != compression_type::NONE) { return create_decompress_reader(); }
+    switch (_options.mode) {
+      case file_read_mode::MMAP: return std::make_unique<mmap_data_chunk_reader>(_filename);
+      case file_read_mode::DEVICE: {
+        auto source = datasource::create(_filename);
+        if (source->supports_device_read()) {
+          return std::make_unique<datasource_device_read_chunk_reader>(std::move(source));
+        }
+        [[fallthrough]];
+      }
+      case file_read_mode::PREAD:
+        return std::make_unique<pread_data_chunk_reader>(
+          _filename, _options.read_size, _options.read_ahead);
+      default:
+        return std::make_unique<istream_data_chunk_reader>(
+          std::make_unique<std::ifstream>(_filename, std::ifstream::in));
+    }
   }
 
  private:
+  [[nodiscard]] std::unique_ptr<data_chunk_reader> create_decompress_reader() const
+  {
+    auto compression = _options.compression;
+    if (compression == compression_type::AUTO) {
+      memory_mapped_file const file(_filename);
+      compression = detect_compression({file.data(), std::min<std::size_t>(file.size(), 4)});
+    }
+    switch (compression) {
+      case compression_type::NONE: {
+        auto options        = _options;
+        options.compression = compression_type::NONE;
+        return file_data_chunk_source{_filename, options}.create_reader();
+      }
+      case compression_type::GZIP:
+      case compression_type::BZIP2:
+        return std::make_unique<host_decompress_data_chunk_reader>(
+          _filename, compression, _options.read_size);
+      case compression_type::ZSTD: return std::make_unique<zstd_data_chunk_reader>(_filename);
+      default: CUDF_FAIL("Unsupported compression type for a file data chunk source");
+    }
+  }
+
   std::string _filename;
+  file_source_options _options;
 };
 
 /**
@@ -257,7 +1101,13 @@ std::unique_ptr<data_chunk_source> make_source(host_span<const char> data)
 
 std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename)
 {
-  return std::make_unique<file_data_chunk_source>(filename);
+  return make_source_from_file(filename, file_source_options{});
+}
+
+std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename,
+                                                         file_source_options const& options)
+{
+  return std::make_unique<file_data_chunk_source>(filename, options);
 }
 
 std::unique_ptr<data_chunk_source> make_source(cudf::string_scalar& data)
@@ -29,6 +29,12 @@ std::string getenv_or(std::string const& env_var_name, std::string_view default_
   return std::string{(env_val == nullptr) ? default_val : env_val};
 }
 
+size_t host_read_max_gap()
+{
+  static auto const max_gap = getenv_or<size_t>("LIBCUDF_HOST_READ_MAX_GAP", 64 * 1024);
+  return max_gap;
+}
+
 namespace cufile_integration {
 
 namespace {
@@ -36,6 +36,11 @@ T getenv_or(std::string_view env_var_name, T default_val)
   return converted_val;
 }
 
+/**
+ * @brief Returns the maximum gap, in bytes, between two ranges that readers fetch in one host read.
+ */
+size_t host_read_max_gap();
+
 namespace cufile_integration {
 
 /**
@@ -17,6 +17,9 @@
 #include <fstream>
 
 #include "file_io_utilities.hpp"
+#include "host_memory.hpp"
+#include "thread_pool.hpp"
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/config_utils.hpp>
@@ -24,17 +27,163 @@
 #include <kvikio/file_handle.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
 namespace cudf {
 namespace io {
+namespace {
+
+/**
+ * @brief Stages host writes to a file in a ring of pinned buffers and writes the full buffers
+ * in the background.
+ *
+ * Buffers are written with `O_DIRECT` when the file system supports it and the offset, size and
+ * address of the buffer are aligned.
+ */
+class write_behind_buffers {
+  static constexpr size_t direct_io_alignment = 4096;
+
+  struct buffer {
+    detail::pinned_buffer<uint8_t> data;
+    size_t offset = 0;
+    size_t size   = 0;
+    std::future<void> written;
+  };
+
+ public:
+  write_behind_buffers(std::string const& filepath, file_sink_options const& options)
+    : _file(filepath, O_WRONLY | O_CREAT | O_TRUNC, 0664),
+      _direct_fd(open(filepath.c_str(), O_WRONLY | O_DIRECT)),
+      _buffer_size(std::max(cudf::util::round_up_safe(options.buffer_size, direct_io_alignment),
+                            direct_io_alignment)),
+      _buffers(std::max<size_t>(options.num_buffers, 1))
+  {
+    for (auto& buffer : _buffers) {
+      buffer.data = detail::make_pinned_buffer<uint8_t>(_buffer_size);
+    }
+  }
+
+  ~write_behind_buffers()
+  {
+    // Write errors are thrown from `write()` and `flush()`, which writers call when done. A sink
+    // destroyed without flushing, e.g. while an exception unwinds the writer, still writes the
+    // staged data but drops its errors
+    try {
+      submit_current();
+    } catch (...) {
+    }
+    for (auto& buffer : _buffers) {
+      if (buffer.written.valid()) { buffer.written.wait(); }
+    }
+    if (_direct_fd != -1) { close(_direct_fd); }
+  }
+
+  /**
+   * @brief Copies the data into the buffers; blocks while all buffers are being written.
+   *
+   * @throw cudf::logic_error if a previous background write of the reused buffer failed
+   */
+  void write(void const* data, size_t size, size_t offset)
+  {
+    auto src = static_cast<uint8_t const*>(data);
+    while (size > 0) {
+      auto& current = _buffers[_current];
+      if (current.size == 0) {
+        current.offset = offset;
+      } else if (current.offset + current.size != offset) {
+        // Data was written to the file in between, e.g. through a device write
+        submit_current();
+        continue;
+      }
+      auto const copy_size = std::min(size, _buffer_size - current.size);
+      std::memcpy(current.data.get() + current.size, src, copy_size);
+      current.size += copy_size;
+      src += copy_size;
+      offset += copy_size;
+      size -= copy_size;
+      if (current.size == _buffer_size) { submit_current(); }
+    }
+  }
+
+  /**
+   * @brief Writes the partially filled buffer and waits for all writes to complete.
+   *
+   * @throw cudf::logic_error if a background write failed
+   */
+  void flush()
+  {
+    submit_current();
+    for (auto& buffer : _buffers) {
+      if (buffer.written.valid()) { buffer.written.get(); }
+    }
+  }
+
+ private:
+  /**
+   * @brief Starts the write of the current buffer and waits until the next buffer is available.
+   */
+  void submit_current()
+  {
+    auto& current = _buffers[_current];
+    if (current.size == 0) { return; }
+    current.written = cudf::detail::io_thread_pool().submit(
+      [this, data = current.data.get(), size = current.size, offset = current.offset] {
+        write_to_file(data, size, offset);
+      });
+
+    _current   = (_current + 1) % _buffers.size();
+    auto& next = _buffers[_current];
+    if (next.written.valid()) { next.written.get(); }
+    next.size = 0;
+  }
+
+  void write_to_file(uint8_t const* data, size_t size, size_t offset) const
+  {
+    while (size > 0) {
+      auto const is_aligned = offset % direct_io_alignment == 0 and
+                              size % direct_io_alignment == 0 and
+                              reinterpret_cast<uintptr_t>(data) % direct_io_alignment == 0;
+
+      auto const fd      = (_direct_fd != -1 and is_aligned) ? _direct_fd : _file.desc();
+      auto const written = pwrite(fd, data, size, offset);
+      if (written == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(written > 0,
+                   std::string{"Cannot write to output file: "} + std::strerror(errno));
+      data += written;
+      size -= written;
+      offset += written;
+    }
+  }
+
+  detail::file_wrapper const _file;
+  int const _direct_fd;  // -1 if the file system does not support O_DIRECT
+  size_t const _buffer_size;
+  std::vector<buffer> _buffers;
+  size_t _current = 0;
+};
+
+}  // namespace
+
 /**
  * @brief Implementation class for storing data into a local file.
  */
 class file_sink : public data_sink {
  public:
-  explicit file_sink(std::string const& filepath)
+  explicit file_sink(std::string const& filepath, file_sink_options const& options = {})
   {
-    _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
+    if (options.write_behind) {
+      _write_behind = std::make_unique<write_behind_buffers>(filepath, options);
+    } else {
+      _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+      CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
+    }
 
     if (detail::cufile_integration::is_kvikio_enabled()) {
       _kvikio_file = kvikio::FileHandle(filepath, "w");
@@ -43,16 +192,31 @@ class file_sink : public data_sink {
     }
   }
 
-  virtual ~file_sink() { flush(); }
+  // The write-behind buffers complete their pending writes in their destructor
+  virtual ~file_sink()
+  {
+    if (_write_behind == nullptr) { flush(); }
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    _output_stream.seekp(_bytes_written);
-    _output_stream.write(static_cast<char const*>(data), size);
+    if (_write_behind != nullptr) {
+      _write_behind->write(data, size, _bytes_written);
+    } else {
+      _output_stream.seekp(_bytes_written);
+      _output_stream.write(static_cast<char const*>(data), size);
+    }
     _bytes_written += size;
   }
 
-  void flush() override { _output_stream.flush(); }
+  void flush() override
+  {
+    if (_write_behind != nullptr) {
+      _write_behind->flush();
+    } else {
+      _output_stream.flush();
+    }
+  }
 
   size_t bytes_written() override { return _bytes_written; }
 
@@ -93,6 +257,7 @@ class file_sink : public data_sink {
 
  private:
   std::ofstream _output_stream;
+  std::unique_ptr<write_behind_buffers> _write_behind;
   size_t _bytes_written = 0;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
   kvikio::FileHandle _kvikio_file;
@@ -197,6 +362,12 @@ std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
   return std::make_unique<file_sink>(filepath);
 }
 
+std::unique_ptr<data_sink> data_sink::create(const std::string& filepath,
+                                             file_sink_options const& options)
+{
+  return std::make_unique<file_sink>(filepath, options);
+}
+
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
 {
   return std::make_unique<host_buffer_sink>(buffer);
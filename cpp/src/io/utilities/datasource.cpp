@@ -15,6 +15,7 @@
  */
 
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
@@ -27,10 +28,89 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <numeric>
+
 namespace cudf {
 namespace io {
 namespace {
 
+/**
+ * @brief Buffer that exposes a part of a larger buffer, shared with other slices.
+ */
+class buffer_slice : public datasource::buffer {
+ public:
+  buffer_slice(std::shared_ptr<datasource::buffer> parent, size_t offset, size_t size)
+    : _parent(std::move(parent)), _offset(offset), _size(size)
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _parent->data() + _offset; }
+
+ private:
+  std::shared_ptr<datasource::buffer> _parent;
+  size_t _offset;
+  size_t _size;
+};
+
+/**
+ * @brief Single read that covers one or more of the requested ranges.
+ */
+struct coalesced_read {
+  size_t offset;
+  size_t size;
+  std::vector<size_t> range_indices;  ///< Indices of the ranges covered by this read
+};
+
+/**
+ * @brief Merges the ranges that are at most `max_gap` bytes apart into the same read.
+ */
+std::vector<coalesced_read> coalesce_ranges(std::vector<datasource::range> const& ranges,
+                                            size_t max_gap)
+{
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  std::vector<coalesced_read> reads;
+  for (auto const idx : order) {
+    auto const& range = ranges[idx];
+    if (not reads.empty() and range.offset <= reads.back().offset + reads.back().size + max_gap) {
+      auto& read = reads.back();
+      read.size  = std::max(read.size, range.offset + range.size - read.offset);
+      read.range_indices.push_back(idx);
+    } else {
+      reads.push_back({range.offset, range.size, {idx}});
+    }
+  }
+  return reads;
+}
+
+/**
+ * @brief Splits the coalesced reads back into per-range buffers.
+ */
+std::vector<std::unique_ptr<datasource::buffer>> slice_reads(
+  std::vector<coalesced_read> const& reads,
+  std::vector<std::shared_ptr<datasource::buffer>> const& read_buffers,
+  std::vector<datasource::range> const& ranges)
+{
+  std::vector<std::unique_ptr<datasource::buffer>> buffers(ranges.size());
+  for (size_t r = 0; r < reads.size(); ++r) {
+    auto const& buffer = read_buffers[r];
+    for (auto const idx : reads[r].range_indices) {
+      // The read can be shorter than requested at the end of the source
+      auto const offset = std::min(ranges[idx].offset - reads[r].offset, buffer->size());
+      auto const size   = std::min(ranges[idx].size, buffer->size() - offset);
+      buffers[idx]      = std::make_unique<buffer_slice>(buffer, offset, size);
+    }
+  }
+  return buffers;
+}
+
 /**
  * @brief Base class for file input. Only implements direct device reads.
  */
@@ -117,6 +197,8 @@ class memory_mapped_source : public file_source {
     if (_map_addr != nullptr) { munmap(_map_addr, _map_size); }
   }
 
+  [[nodiscard]] bool supports_concurrent_host_reads() const override { return true; }
+
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
     CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
@@ -174,26 +256,25 @@ class direct_read_source : public file_source {
  public:
   explicit direct_read_source(const char* filepath) : file_source(filepath) {}
 
+  // Reads use `pread`, which does not share the file position between threads
+  [[nodiscard]] bool supports_concurrent_host_reads() const override { return true; }
+
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(pread(_file.desc(), v.data(), read_size, offset) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
+    CUDF_EXPECTS(pread(_file.desc(), dst, read_size, offset) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
   }
@@ -220,6 +301,17 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  [[nodiscard]] bool supports_concurrent_host_reads() const override
+  {
+    return source->supports_concurrent_host_reads();
+  }
+
+  std::future<std::vector<std::unique_ptr<buffer>>> host_read_async(
+    std::vector<range> const& ranges, size_t max_gap) override
+  {
+    return source->host_read_async(ranges, max_gap);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
@@ -248,6 +340,45 @@ class user_datasource_wrapper : public datasource {
 
 }  // namespace
 
+std::future<std::vector<std::unique_ptr<datasource::buffer>>> datasource::host_read_async(
+  std::vector<range> const& ranges, size_t max_gap)
+{
+  auto reads = coalesce_ranges(ranges, max_gap);
+
+  if (not supports_concurrent_host_reads()) {
+    return std::async(std::launch::async, [this, ranges, reads = std::move(reads)] {
+      std::vector<std::shared_ptr<buffer>> read_buffers;
+      for (auto const& read : reads) {
+        read_buffers.emplace_back(host_read(read.offset, read.size));
+      }
+      return slice_reads(reads, read_buffers, ranges);
+    });
+  }
+
+  // Small reads are typically metadata that the caller needs before it can issue the bulk reads
+  constexpr size_t max_high_priority_read_size = 64 * 1024;
+  auto& pool                                   = cudf::detail::io_thread_pool();
+  std::vector<std::future<std::shared_ptr<buffer>>> read_tasks;
+  for (auto const& read : reads) {
+    auto const priority = read.size <= max_high_priority_read_size
+                            ? cudf::detail::task_priority::HIGH
+                            : cudf::detail::task_priority::NORMAL;
+    read_tasks.emplace_back(pool.submit(priority, [this, offset = read.offset, size = read.size] {
+      return std::shared_ptr<buffer>{host_read(offset, size)};
+    }));
+  }
+  return std::async(
+    std::launch::deferred,
+    [ranges, reads = std::move(reads)](decltype(read_tasks) read_tasks) {
+      std::vector<std::shared_ptr<buffer>> read_buffers;
+      for (auto& task : read_tasks) {
+        read_buffers.emplace_back(task.get());
+      }
+      return slice_reads(reads, read_buffers, ranges);
+    },
+    std::move(read_tasks));
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
                                                size_t size)
@@ -169,11 +169,8 @@ cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_h
 
 cufile_input_impl::cufile_input_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_RDONLY | O_DIRECT),
-    // The benefit from multithreaded read plateaus around 16 threads
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+    cf_file(shim, filepath, O_RDONLY | O_DIRECT)
 {
-  pool.sleep_duration = 10;
 }
 
 namespace {
@@ -182,11 +179,12 @@ template <typename DataT,
           typename F,
           typename ResultT = std::invoke_result_t<F, DataT*, size_t, size_t>>
 std::vector<std::future<ResultT>> make_sliced_tasks(
-  F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
+  F function, DataT* ptr, size_t offset, size_t size)
 {
   constexpr size_t default_max_slice_size = 4 * 1024 * 1024;
   static auto const max_slice_size = getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", default_max_slice_size);
   auto const slices                = make_file_io_slices(size, max_slice_size);
+  auto& pool                       = cudf::detail::io_thread_pool();
   std::vector<std::future<ResultT>> slice_tasks;
   std::transform(slices.cbegin(), slices.cend(), std::back_inserter(slice_tasks), [&](auto& slice) {
     return pool.submit(function, ptr + slice.offset, slice.size, offset + slice.offset);
@@ -212,7 +210,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
     return read_size;
   };
 
-  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size);
 
   auto waiter = [](auto slice_tasks) -> size_t {
     return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0, [](auto sum, auto& task) {
@@ -226,8 +224,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
 
 cufile_output_impl::cufile_output_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664),
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664)
 {
 }
 
@@ -245,7 +242,7 @@ std::future<void> cufile_output_impl::write_async(void const* data, size_t offse
   };
 
   auto source      = static_cast<uint8_t const*>(data);
-  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size);
 
   auto waiter = [](auto slice_tasks) -> void {
     for (auto const& task : slice_tasks) {
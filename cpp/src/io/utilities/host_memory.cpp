@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config_utils.hpp"
+
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/host/pinned_memory_resource.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace cudf::io {
+
+namespace {
+
+/**
+ * @brief Returns the index of the smallest size class that fits `bytes`
+ */
+std::size_t size_class(std::size_t bytes)
+{
+  std::size_t idx = 0;
+  while ((pinned_pool_memory_resource::min_block_size << idx) < bytes) {
+    ++idx;
+  }
+  return idx;
+}
+
+std::size_t class_block_size(std::size_t idx)
+{
+  return pinned_pool_memory_resource::min_block_size << idx;
+}
+
+/**
+ * @brief Whether an allocation bypasses the cached blocks and is passed through as is
+ */
+bool is_pass_through(std::size_t bytes, std::size_t alignment, std::size_t max_cached_bytes)
+{
+  return bytes > max_cached_bytes or alignment > alignof(std::max_align_t);
+}
+
+}  // namespace
+
+pinned_pool_memory_resource::pinned_pool_memory_resource(rmm::mr::host_memory_resource* upstream,
+                                                         std::size_t max_cached_bytes)
+  : _upstream{upstream}, _max_cached_bytes{max_cached_bytes}
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream host memory resource");
+}
+
+pinned_pool_memory_resource::~pinned_pool_memory_resource() { release(); }
+
+void pinned_pool_memory_resource::release()
+{
+  decltype(_free_blocks) free_blocks;
+  {
+    std::scoped_lock lock(_mutex);
+    std::swap(free_blocks, _free_blocks);
+    _stats.bytes_cached = 0;
+  }
+  for (std::size_t idx = 0; idx < free_blocks.size(); ++idx) {
+    for (auto block : free_blocks[idx]) {
+      _upstream->deallocate(block, class_block_size(idx));
+    }
+  }
+}
+
+host_memory_statistics pinned_pool_memory_resource::get_statistics() const
+{
+  std::scoped_lock lock(_mutex);
+  return _stats;
+}
+
+void* pinned_pool_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  auto const pass_through = is_pass_through(bytes, alignment, _max_cached_bytes);
+  auto const idx          = pass_through ? 0 : size_class(bytes);
+  auto const block_size   = pass_through ? bytes : class_block_size(idx);
+
+  auto const update_stats = [&](bool is_miss) {
+    ++_stats.num_allocations;
+    if (is_miss) { ++_stats.num_misses; }
+    _stats.bytes_in_use += block_size;
+    _stats.peak_bytes_in_use = std::max(_stats.peak_bytes_in_use, _stats.bytes_in_use);
+  };
+
+  if (not pass_through) {
+    std::scoped_lock lock(_mutex);
+    if (idx < _free_blocks.size() and not _free_blocks[idx].empty()) {
+      auto const ptr = _free_blocks[idx].back();
+      _free_blocks[idx].pop_back();
+      _stats.bytes_cached -= block_size;
+      update_stats(false);
+      return ptr;
+    }
+  }
+
+  // Cached blocks are allocated with the default alignment, so any block fits any request
+  auto const block_alignment = pass_through ? alignment : alignof(std::max_align_t);
+  void* ptr                  = nullptr;
+  try {
+    ptr = _upstream->allocate(block_size, block_alignment);
+  } catch (std::bad_alloc const&) {
+    // The upstream may be out of memory because of the cached blocks
+    if (get_statistics().bytes_cached == 0) { throw; }
+    release();
+    ptr = _upstream->allocate(block_size, block_alignment);
+  }
+
+  std::scoped_lock lock(_mutex);
+  update_stats(true);
+  return ptr;
+}
+
+void pinned_pool_memory_resource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+  auto const pass_through = is_pass_through(bytes, alignment, _max_cached_bytes);
+  auto const idx          = pass_through ? 0 : size_class(bytes);
+  auto const block_size   = pass_through ? bytes : class_block_size(idx);
+
+  {
+    std::scoped_lock lock(_mutex);
+    _stats.bytes_in_use -= block_size;
+    if (not pass_through and _stats.bytes_cached + block_size <= _max_cached_bytes) {
+      if (_free_blocks.size() <= idx) { _free_blocks.resize(idx + 1); }
+      _free_blocks[idx].push_back(ptr);
+      _stats.bytes_cached += block_size;
+      return;
+    }
+  }
+  if (pass_through) {
+    _upstream->deallocate(ptr, block_size, alignment);
+  } else {
+    _upstream->deallocate(ptr, block_size);
+  }
+}
+
+namespace {
+
+rmm::mr::host_memory_resource* default_host_memory_resource()
+{
+  // Intentionally leaked; freeing pinned memory during static destruction can fail once the CUDA
+  // context has been torn down
+  static auto* const mr = [] {
+    constexpr std::size_t default_max_cached_bytes = 256 * 1024 * 1024;
+    auto* const upstream                           = new rmm::mr::pinned_memory_resource{};
+    return new pinned_pool_memory_resource{
+      upstream, detail::getenv_or("LIBCUDF_PINNED_POOL_SIZE", default_max_cached_bytes)};
+  }();
+  return mr;
+}
+
+std::atomic<rmm::mr::host_memory_resource*>& current_host_memory_resource()
+{
+  static std::atomic<rmm::mr::host_memory_resource*> mr{nullptr};
+  return mr;
+}
+
+}  // namespace
+
+rmm::mr::host_memory_resource* set_host_memory_resource(rmm::mr::host_memory_resource* mr)
+{
+  auto const previous = current_host_memory_resource().exchange(mr);
+  return previous != nullptr ? previous : default_host_memory_resource();
+}
+
+rmm::mr::host_memory_resource* get_host_memory_resource()
+{
+  auto const mr = current_host_memory_resource().load();
+  return mr != nullptr ? mr : default_host_memory_resource();
+}
+
+}  // namespace cudf::io
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/memory_resource.hpp>
+
+#include <rmm/mr/host/host_memory_resource.hpp>
+
+#include <thrust/host_vector.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Allocator that allocates from the cuIO host memory resource.
+ *
+ * The resource is captured when the allocator is constructed, see `get_host_memory_resource`.
+ *
+ * @tparam T Type of the allocated elements
+ */
+template <typename T>
+class host_staging_allocator {
+ public:
+  using value_type = T;
+
+  host_staging_allocator() : _mr{get_host_memory_resource()} {}
+
+  template <typename U>
+  host_staging_allocator(host_staging_allocator<U> const& other) : _mr{other.resource()}
+  {
+  }
+
+  [[nodiscard]] T* allocate(std::size_t n)
+  {
+    return static_cast<T*>(_mr->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) { _mr->deallocate(ptr, n * sizeof(T), alignof(T)); }
+
+  [[nodiscard]] rmm::mr::host_memory_resource* resource() const noexcept { return _mr; }
+
+  template <typename U>
+  bool operator==(host_staging_allocator<U> const& other) const noexcept
+  {
+    return _mr->is_equal(*other.resource());
+  }
+
+  template <typename U>
+  bool operator!=(host_staging_allocator<U> const& other) const noexcept
+  {
+    return not(*this == other);
+  }
+
+ private:
+  rmm::mr::host_memory_resource* _mr;
+};
+
+/**
+ * @brief Host vector in pinned staging memory.
+ */
+template <typename T>
+using pinned_host_vector = thrust::host_vector<T, host_staging_allocator<T>>;
+
+/**
+ * @brief Deleter that returns a staging buffer to the resource that allocated it.
+ */
+struct host_staging_deleter {
+  rmm::mr::host_memory_resource* mr = nullptr;
+  std::size_t size                  = 0;
+
+  void operator()(void* ptr) const
+  {
+    if (ptr != nullptr) { mr->deallocate(ptr, size); }
+  }
+};
+
+/**
+ * @brief Owning pointer to a buffer in pinned staging memory.
+ */
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, host_staging_deleter>;
+
+/**
+ * @brief Allocates a buffer of `size` elements in pinned staging memory.
+ *
+ * @param size Number of elements
+ * @return The buffer; null if `size` is zero
+ */
+template <typename T>
+pinned_buffer<T> make_pinned_buffer(std::size_t size)
+{
+  if (size == 0) { return pinned_buffer<T>{}; }
+  auto const mr    = get_host_memory_resource();
+  auto const bytes = size * sizeof(T);
+  return pinned_buffer<T>{static_cast<T*>(mr->allocate(bytes)), host_staging_deleter{mr, bytes}};
+}
+
+}  // namespace cudf::io::detail
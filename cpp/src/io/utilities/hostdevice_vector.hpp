@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "host_memory.hpp"
+
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -23,12 +25,10 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 
-#include <thrust/host_vector.h>
-#include <thrust/system/cuda/experimental/pinned_allocator.h>
-
 /**
  * @brief A helper class that wraps fixed-length device memory for the GPU, and
- * a mirror host pinned memory for the CPU.
+ * a mirror host pinned memory for the CPU. The host memory is allocated from the cuIO host memory
+ * resource, see `cudf::io::get_host_memory_resource`.
  *
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
@@ -126,7 +126,7 @@ class hostdevice_vector {
   }
 
  private:
-  thrust::host_vector<T, thrust::system::cuda::experimental::pinned_allocator<T>> h_data;
+  cudf::io::detail::pinned_host_vector<T> h_data;
   rmm::device_uvector<T> d_data;
 };
 
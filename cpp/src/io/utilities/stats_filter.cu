@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats_filter.hpp"
+
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+ast::ast_operator flip(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Copies the value of a literal to host memory
+ */
+std::vector<uint8_t> literal_value(ast::literal const& lit, rmm::cuda_stream_view stream)
+{
+  auto const size = size_of(lit.get_data_type());
+  rmm::device_uvector<uint8_t> bytes(size, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<std::size_t>(0),
+                     size,
+                     [value = lit.get_value(), out = bytes.data()] __device__(std::size_t i) {
+                       out[i] = value.data<uint8_t>()[i];
+                     });
+  return cudf::detail::make_std_vector_sync(bytes, stream);
+}
+
+}  // namespace
+
+stats_expression_converter::stats_expression_converter(
+  ast::expression const& expr,
+  std::vector<std::optional<data_type>> const& stats_types,
+  rmm::cuda_stream_view stream)
+  : _stats_types(stats_types),
+    _always_true_scalar(true, true, stream),
+    _always_true(_always_true_scalar),
+    _stats_expr(convert(expr))
+{
+}
+
+ast::expression const& stats_expression_converter::convert(ast::expression const& expr)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr or op->get_operands().size() != 2) { return _always_true; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND: {
+      auto const& lhs = convert(operands[0]);
+      auto const& rhs = convert(operands[1]);
+      if (&lhs == &_always_true) { return rhs; }
+      if (&rhs == &_always_true) { return lhs; }
+      return _operations.emplace_back(ast::ast_operator::NULL_LOGICAL_AND, lhs, rhs);
+    }
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR: {
+      auto const& lhs = convert(operands[0]);
+      auto const& rhs = convert(operands[1]);
+      if (&lhs == &_always_true or &rhs == &_always_true) { return _always_true; }
+      return _operations.emplace_back(ast::ast_operator::NULL_LOGICAL_OR, lhs, rhs);
+    }
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NOT_EQUAL:
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::GREATER_EQUAL:
+      return convert_comparison(op->get_operator(), operands[0], operands[1]);
+    default: return _always_true;
+  }
+}
+
+ast::expression const& stats_expression_converter::convert_comparison(ast::ast_operator op,
+                                                                       ast::expression const& lhs,
+                                                                       ast::expression const& rhs)
+{
+  auto const* col = dynamic_cast<ast::column_reference const*>(&lhs);
+  auto const* lit = dynamic_cast<ast::literal const*>(&rhs);
+  if (col == nullptr) {
+    // `literal op column` is evaluated as `column flipped_op literal`
+    col = dynamic_cast<ast::column_reference const*>(&rhs);
+    lit = dynamic_cast<ast::literal const*>(&lhs);
+    op  = flip(op);
+  }
+  if (col == nullptr or lit == nullptr or
+      col->get_table_source() != ast::table_reference::LEFT) {
+    return _always_true;
+  }
+
+  auto const col_idx = col->get_column_index();
+  CUDF_EXPECTS(col_idx >= 0 and col_idx < static_cast<size_type>(_stats_types.size()),
+               "Filter references a column that is not in the output table");
+  auto const& type = _stats_types[col_idx];
+  // mismatching types are reported when the filter is evaluated on the output table
+  if (not type.has_value() or *type != lit->get_data_type()) { return _always_true; }
+  _referenced_columns.insert(col_idx);
+
+  auto const& min = _col_refs.emplace_back(2 * col_idx);
+  auto const& max = _col_refs.emplace_back(2 * col_idx + 1);
+  switch (op) {
+    case ast::ast_operator::EQUAL: {
+      auto const& above_min = _operations.emplace_back(ast::ast_operator::LESS_EQUAL, min, *lit);
+      auto const& below_max =
+        _operations.emplace_back(ast::ast_operator::GREATER_EQUAL, max, *lit);
+      return _operations.emplace_back(ast::ast_operator::NULL_LOGICAL_AND, above_min, below_max);
+    }
+    case ast::ast_operator::NOT_EQUAL: {
+      auto const& min_differs = _operations.emplace_back(ast::ast_operator::NOT_EQUAL, min, *lit);
+      auto const& max_differs = _operations.emplace_back(ast::ast_operator::NOT_EQUAL, max, *lit);
+      return _operations.emplace_back(
+        ast::ast_operator::NULL_LOGICAL_OR, min_differs, max_differs);
+    }
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::LESS_EQUAL: return _operations.emplace_back(op, min, *lit);
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::GREATER_EQUAL: return _operations.emplace_back(op, max, *lit);
+    default: return _always_true;
+  }
+}
+
+equality_filter::equality_filter(ast::expression const& expr,
+                                 std::vector<std::optional<data_type>> const& column_types,
+                                 rmm::cuda_stream_view stream)
+  : _column_types(column_types), _root(convert(expr, stream))
+{
+}
+
+int equality_filter::convert(ast::expression const& expr, rmm::cuda_stream_view stream)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr or op->get_operands().size() != 2) { return always_true; }
+
+  auto const operands = op->get_operands();
+  switch (op->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND: {
+      auto const lhs = convert(operands[0], stream);
+      auto const rhs = convert(operands[1], stream);
+      if (lhs == always_true) { return rhs; }
+      if (rhs == always_true) { return lhs; }
+      _nodes.push_back({ast::ast_operator::LOGICAL_AND, lhs, rhs});
+      return _nodes.size() - 1;
+    }
+    case ast::ast_operator::LOGICAL_OR:
+    case ast::ast_operator::NULL_LOGICAL_OR: {
+      auto const lhs = convert(operands[0], stream);
+      auto const rhs = convert(operands[1], stream);
+      if (lhs == always_true or rhs == always_true) { return always_true; }
+      _nodes.push_back({ast::ast_operator::LOGICAL_OR, lhs, rhs});
+      return _nodes.size() - 1;
+    }
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NULL_EQUAL: {
+      auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+      auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+      if (col == nullptr) {
+        col = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+        lit = dynamic_cast<ast::literal const*>(&operands[0].get());
+      }
+      if (col == nullptr or lit == nullptr or
+          col->get_table_source() != ast::table_reference::LEFT or not lit->is_valid(stream)) {
+        return always_true;
+      }
+      auto const col_idx = col->get_column_index();
+      CUDF_EXPECTS(col_idx >= 0 and col_idx < static_cast<size_type>(_column_types.size()),
+                   "Filter references a column that is not in the output table");
+      auto const& type = _column_types[col_idx];
+      if (not type.has_value() or *type != lit->get_data_type()) { return always_true; }
+
+      _predicates.push_back({col_idx, *type, literal_value(*lit, stream)});
+      _nodes.push_back({ast::ast_operator::EQUAL, static_cast<int>(_predicates.size() - 1), 0});
+      return _nodes.size() - 1;
+    }
+    default: return always_true;
+  }
+}
+
+bool equality_filter::evaluate(std::vector<bool> const& may_match) const
+{
+  return evaluate(_root, may_match);
+}
+
+bool equality_filter::evaluate(int node_idx, std::vector<bool> const& may_match) const
+{
+  if (node_idx == always_true) { return true; }
+  auto const& n = _nodes[node_idx];
+  switch (n.op) {
+    case ast::ast_operator::LOGICAL_AND:
+      return evaluate(n.lhs, may_match) and evaluate(n.rhs, may_match);
+    case ast::ast_operator::LOGICAL_OR:
+      return evaluate(n.lhs, may_match) or evaluate(n.rhs, may_match);
+    default: return may_match[n.lhs];
+  }
+}
+
+std::vector<bool> evaluate_stats_filter(stats_expression_converter const& converter,
+                                        table_view const& stats_table,
+                                        rmm::cuda_stream_view stream)
+{
+  auto const num_ranges = stats_table.num_rows();
+  if (num_ranges == 0) { return {}; }
+
+  auto const result = cudf::detail::compute_column(stats_table, converter.get_expression(), stream);
+  auto const values = cudf::detail::make_std_vector_sync(
+    device_span<bool const>(result->view().data<bool>(), num_ranges), stream);
+  auto const validity =
+    result->nullable()
+      ? cudf::detail::make_std_vector_sync(
+          device_span<bitmask_type const>(result->view().null_mask(),
+                                          num_bitmask_words(num_ranges)),
+          stream)
+      : std::vector<bitmask_type>{};
+
+  // a null result means that the statistics are unknown, so the range must be read
+  std::vector<bool> keep(num_ranges);
+  for (size_type i = 0; i < num_ranges; ++i) {
+    keep[i] = values[i] or (not validity.empty() and not bit_is_set(validity.data(), i));
+  }
+  return keep;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
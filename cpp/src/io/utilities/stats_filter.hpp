@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Converts a filter on the output columns into a filter on their min/max statistics.
+ *
+ * The statistics table holds the minimum value of output column `i` at column `2 * i` and its
+ * maximum value at column `2 * i + 1`. The converted expression evaluates to `false` only for the
+ * row ranges in which no row can satisfy the original filter, and to `true` or null otherwise.
+ * Sub-expressions that cannot be bounded by the statistics are replaced by `true`.
+ */
+class stats_expression_converter {
+ public:
+  /**
+   * @brief Constructs the statistics expression of a filter.
+   *
+   * @param expr Filter on the output columns
+   * @param stats_types Type of the statistics of each output column; `nullopt` if the column has
+   * no usable statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  stats_expression_converter(ast::expression const& expr,
+                             std::vector<std::optional<data_type>> const& stats_types,
+                             rmm::cuda_stream_view stream);
+
+  stats_expression_converter(stats_expression_converter const&) = delete;
+  stats_expression_converter& operator=(stats_expression_converter const&) = delete;
+
+  /**
+   * @brief Returns the expression to evaluate on the statistics table.
+   */
+  [[nodiscard]] ast::expression const& get_expression() const { return _stats_expr; }
+
+  /**
+   * @brief Returns true if the statistics cannot exclude any row range.
+   */
+  [[nodiscard]] bool is_always_true() const { return &_stats_expr == &_always_true; }
+
+  /**
+   * @brief Returns the indices of the output columns whose statistics are used.
+   */
+  [[nodiscard]] auto const& get_referenced_columns() const { return _referenced_columns; }
+
+ private:
+  ast::expression const& convert(ast::expression const& expr);
+
+  ast::expression const& convert_comparison(ast::ast_operator op,
+                                            ast::expression const& lhs,
+                                            ast::expression const& rhs);
+
+  std::vector<std::optional<data_type>> const& _stats_types;
+  numeric_scalar<bool> _always_true_scalar;
+  ast::literal _always_true;
+  // expressions are referenced by the operations, so their addresses must remain stable
+  std::list<ast::column_reference> _col_refs;
+  std::list<ast::operation> _operations;
+  std::set<size_type> _referenced_columns;
+  ast::expression const& _stats_expr;
+};
+
+/**
+ * @brief Host representation of the equality predicates of a filter, used to probe bloom filters.
+ *
+ * The filter is reduced to a tree of AND and OR nodes over `column == literal` predicates on the
+ * output columns. Sub-expressions that are not equality predicates on a probed column are
+ * replaced by `true`.
+ */
+class equality_filter {
+ public:
+  /**
+   * @brief Equality predicate `column == value`
+   */
+  struct predicate {
+    size_type column;            ///< Index of the output column
+    data_type type;              ///< Type of the column and of the value
+    std::vector<uint8_t> value;  ///< Value, in the device representation of `type`
+  };
+
+  /**
+   * @brief Extracts the equality predicates of a filter.
+   *
+   * @param expr Filter on the output columns
+   * @param column_types Type of each output column; `nullopt` if the column cannot be probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  equality_filter(ast::expression const& expr,
+                  std::vector<std::optional<data_type>> const& column_types,
+                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the predicates of the filter.
+   */
+  [[nodiscard]] std::vector<predicate> const& get_predicates() const { return _predicates; }
+
+  /**
+   * @brief Evaluates the filter on a row range.
+   *
+   * @param may_match Whether each predicate may be satisfied by a row of the range
+   *
+   * @return False if no row of the range can satisfy the filter
+   */
+  [[nodiscard]] bool evaluate(std::vector<bool> const& may_match) const;
+
+ private:
+  static constexpr int always_true = -1;
+
+  struct node {
+    ast::ast_operator op;  // LOGICAL_AND, LOGICAL_OR, or EQUAL for the predicates
+    int lhs;               // left operand node, or predicate index for EQUAL
+    int rhs;               // right operand node
+  };
+
+  int convert(ast::expression const& expr, rmm::cuda_stream_view stream);
+
+  [[nodiscard]] bool evaluate(int node_idx, std::vector<bool> const& may_match) const;
+
+  std::vector<std::optional<data_type>> const& _column_types;
+  std::vector<predicate> _predicates;
+  std::vector<node> _nodes;
+  int _root;
+};
+
+/**
+ * @brief Type of the host values that make up the device data of a numeric or chrono column.
+ */
+template <typename T, typename = void>
+struct stats_rep {
+  using type = T;
+};
+
+template <typename T>
+struct stats_rep<T, std::enable_if_t<cudf::is_chrono<T>()>> {
+  using type = typename T::rep;
+};
+
+/**
+ * @brief Creates a statistics column from host min or max values.
+ *
+ * @tparam T Host type with the same representation as the device elements of `type`
+ *
+ * @param type Type of the column
+ * @param values Value of each row range; missing values result in null entries
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The statistics column
+ */
+template <typename T>
+std::unique_ptr<column> make_stats_column(data_type type,
+                                          std::vector<std::optional<T>> const& values,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const size = static_cast<size_type>(values.size());
+  std::vector<T> data(size);
+  std::vector<bitmask_type> null_mask(num_bitmask_words(size), 0);
+  size_type null_count = 0;
+  for (size_type i = 0; i < size; ++i) {
+    if (values[i].has_value()) {
+      data[i] = *values[i];
+      set_bit_unsafe(null_mask.data(), i);
+    } else {
+      ++null_count;
+    }
+  }
+
+  auto result = std::make_unique<column>(
+    type,
+    size,
+    rmm::device_buffer(data.data(), data.size() * sizeof(T), stream),
+    rmm::device_buffer(null_mask.data(), null_mask.size() * sizeof(bitmask_type), stream),
+    null_count);
+  // the host buffers are released on return
+  stream.synchronize();
+  return result;
+}
+
+/**
+ * @brief Evaluates the statistics expression of a filter on the min/max values of row ranges.
+ *
+ * @param converter Statistics expression of the filter
+ * @param stats_table Statistics table, with one row per row range and the layout described in
+ * `stats_expression_converter`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Whether each row range may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_stats_filter(stats_expression_converter const& converter,
+                                        table_view const& stats_table,
+                                        rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,31 +17,49 @@
 #pragma once
 
 /**
- * Modified from https://github.com/bshoshany/thread-pool
+ * Interface modified from https://github.com/bshoshany/thread-pool
  * @copyright Copyright (c) 2021 Barak Shoshany. Licensed under the MIT license.
  *            See file LICENSE for detail or copy at https://opensource.org/licenses/MIT
  */
 
-#include <atomic>       // std::atomic
-#include <chrono>       // std::chrono
-#include <cstdint>      // std::int_fast64_t, std::uint_fast32_t
-#include <functional>   // std::function
-#include <future>       // std::future, std::promise
-#include <memory>       // std::shared_ptr, std::unique_ptr
-#include <mutex>        // std::mutex, std::scoped_lock
-#include <queue>        // std::queue
-#include <thread>       // std::this_thread, std::thread
-#include <type_traits>  // std::decay_t, std::enable_if_t, std::is_void_v, std::invoke_result_t
-#include <utility>      // std::move, std::swap
+#include "config_utils.hpp"
+
+#include <algorithm>           // std::max
+#include <atomic>              // std::atomic
+#include <condition_variable>  // std::condition_variable
+#include <cstdint>             // std::uint8_t
+#include <deque>               // std::deque
+#include <functional>          // std::function
+#include <future>              // std::future, std::promise
+#include <memory>              // std::shared_ptr, std::unique_ptr
+#include <mutex>               // std::mutex, std::scoped_lock, std::unique_lock
+#include <thread>              // std::thread
+#include <type_traits>         // std::decay_t, std::is_void_v, std::invoke_result_t
+#include <utility>             // std::move, std::swap
+#include <vector>              // std::vector
 
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief Priority of the tasks submitted to a `thread_pool`.
+ *
+ * Queued high priority tasks, e.g. small metadata reads, start ahead of all normal priority tasks.
+ */
+enum class task_priority : uint8_t { HIGH, NORMAL };
+
 /**
  * @brief A C++17 thread pool class. The user submits tasks to be executed into a queue. Whenever a
  * thread becomes available, it pops a task from the queue and executes it. Each task is
  * automatically assigned a future, which can be used to wait for the task to finish executing
  * and/or obtain its eventual return value.
+ *
+ * Each worker thread owns a task deque per priority. Tasks submitted from a worker are queued in
+ * its own deques, other tasks are distributed round-robin. Workers run their own tasks in
+ * submission order and steal the most recently queued tasks of the other workers when they run
+ * out. Idle workers block on a condition variable until new tasks are submitted.
+ *
+ * Tasks must not wait for other tasks of the same pool, since all workers could end up waiting.
  */
 class thread_pool {
   using ui32 = int;
@@ -57,32 +75,34 @@ class thread_pool {
    */
   thread_pool(const ui32& _thread_count = std::thread::hardware_concurrency())
     : thread_count(_thread_count ? _thread_count : std::thread::hardware_concurrency()),
-      threads(new std::thread[_thread_count ? _thread_count : std::thread::hardware_concurrency()])
+      queues(new worker_queues[thread_count]),
+      threads(new std::thread[thread_count])
   {
     create_threads();
   }
 
   /**
    * @brief Destruct the thread pool. Waits for all tasks to complete, then destroys all threads.
-   * Note that if the variable paused is set to true, then any tasks still in the queue will never
-   * be executed.
    */
   ~thread_pool()
   {
     wait_for_tasks();
-    running = false;
+    {
+      const std::scoped_lock lock(park_mutex);
+      running = false;
+    }
+    park_cv.notify_all();
     destroy_threads();
   }
 
   /**
-   * @brief Get the number of tasks currently waiting in the queue to be executed by the threads.
+   * @brief Get the number of tasks currently waiting in the queues to be executed by the threads.
    *
    * @return The number of queued tasks.
    */
   [[nodiscard]] size_t get_tasks_queued() const
   {
-    const std::scoped_lock lock(queue_mutex);
-    return tasks.size();
+    return std::max(0, tasks_queued[0] + tasks_queued[1]);
   }
 
   /**
@@ -131,19 +151,17 @@ class thread_pool {
       block_size = 1;
       num_tasks  = (ui32)total_size > 1 ? (ui32)total_size : 1;
     }
-    std::atomic<ui32> blocks_running = 0;
+    std::vector<std::future<void>> blocks;
     for (ui32 t = 0; t < num_tasks; t++) {
       T start = (T)(t * block_size + first_index);
       T end   = (t == num_tasks - 1) ? last_index : (T)((t + 1) * block_size + first_index - 1);
-      blocks_running++;
-      push_task([start, end, &loop, &blocks_running] {
+      blocks.push_back(submit([start, end, &loop] {
         for (T i = start; i <= end; i++)
           loop(i);
-        blocks_running--;
-      });
+      }));
     }
-    while (blocks_running != 0) {
-      sleep_or_yield();
+    for (auto& block : blocks) {
+      block.get();
     }
   }
 
@@ -156,64 +174,63 @@ class thread_pool {
   template <typename F>
   void push_task(const F& task)
   {
-    tasks_total++;
-    {
-      const std::scoped_lock lock(queue_mutex);
-      tasks.push(std::function<void()>(task));
-    }
+    push_task(task_priority::NORMAL, task);
   }
 
   /**
-   * @brief Push a function with arguments, but no return value, into the task queue.
-   * @details The function is wrapped inside a lambda in order to hide the arguments, as the tasks
-   * in the queue must be of type std::function<void()>, so they cannot have any arguments or return
-   * value. If no arguments are provided, the other overload will be used, in order to avoid the
-   * (slight) overhead of using a lambda.
+   * @brief Push a function with no arguments or return value into the task queue of the given
+   * priority.
    *
    * @tparam F The type of the function.
-   * @tparam A The types of the arguments.
+   * @param priority The priority of the task.
    * @param task The function to push.
-   * @param args The arguments to pass to the function.
    */
-  template <typename F, typename... A>
-  void push_task(const F& task, const A&... args)
+  template <typename F>
+  void push_task(task_priority priority, const F& task)
   {
-    push_task([task, args...] { task(args...); });
+    auto const p = static_cast<int>(priority);
+    tasks_total++;
+    // Workers keep the tasks they submit, the other tasks are spread over all workers
+    auto const index = (current_pool == this) ? current_index : next_queue++ % thread_count;
+    {
+      const std::scoped_lock lock(queues[index].mutex);
+      queues[index].tasks[p].push_back(std::function<void()>(task));
+    }
+    {
+      const std::scoped_lock lock(park_mutex);
+      tasks_queued[p]++;
+    }
+    park_cv.notify_one();
   }
 
   /**
-   * @brief Reset the number of threads in the pool. Waits for all currently running tasks to be
-   * completed, then destroys all threads in the pool and creates a new thread pool with the new
-   * number of threads. Any tasks that were waiting in the queue before the pool was reset will then
-   * be executed by the new threads. If the pool was paused before resetting it, the new pool will
-   * be paused as well.
+   * @brief Submit a function with zero or more arguments and a return value into the task queue,
+   * and get a future for its eventual returned value.
    *
-   * @param _thread_count The number of threads to use. The default value is the total number of
-   * hardware threads available, as reported by the implementation. With a hyperthreaded CPU, this
-   * will be twice the number of CPU cores. If the argument is zero, the default value will be used
-   * instead.
+   * @tparam F The type of the function.
+   * @tparam A The types of the zero or more arguments to pass to the function.
+   * @tparam R The return type of the function.
+   * @param task The function to submit.
+   * @param args The zero or more arguments to pass to the function.
+   * @return A future to be used later to obtain the function's returned value, waiting for it to
+   * finish its execution if needed.
    */
-  void reset(const ui32& _thread_count = std::thread::hardware_concurrency())
+  template <typename F,
+            typename... A,
+            typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
+  std::future<R> submit(const F& task, const A&... args)
   {
-    bool was_paused = paused;
-    paused          = true;
-    wait_for_tasks();
-    running = false;
-    destroy_threads();
-    thread_count = _thread_count ? _thread_count : std::thread::hardware_concurrency();
-    threads.reset(new std::thread[thread_count]);
-    paused = was_paused;
-    create_threads();
-    running = true;
+    return submit(task_priority::NORMAL, task, args...);
   }
 
   /**
-   * @brief Submit a function with zero or more arguments and a return value into the task queue,
-   * and get a future for its eventual returned value.
+   * @brief Submit a function with zero or more arguments and a return value into the task queue of
+   * the given priority, and get a future for its eventual returned value.
    *
    * @tparam F The type of the function.
    * @tparam A The types of the zero or more arguments to pass to the function.
    * @tparam R The return type of the function.
+   * @param priority The priority of the task.
    * @param task The function to submit.
    * @param args The zero or more arguments to pass to the function.
    * @return A future to be used later to obtain the function's returned value, waiting for it to
@@ -222,11 +239,11 @@ class thread_pool {
   template <typename F,
             typename... A,
             typename R = std::invoke_result_t<std::decay_t<F>, std::decay_t<A>...>>
-  std::future<R> submit(const F& task, const A&... args)
+  std::future<R> submit(task_priority priority, const F& task, const A&... args)
   {
     std::shared_ptr<std::promise<R>> promise(new std::promise<R>);
     std::future<R> future = promise->get_future();
-    push_task([task, args..., promise] {
+    push_task(priority, [task, args..., promise] {
       try {
         if constexpr (std::is_void_v<R>) {
           task(args...);
@@ -242,47 +259,34 @@ class thread_pool {
   }
 
   /**
-   * @brief Wait for tasks to be completed. Normally, this function waits for all tasks, both those
-   * that are currently running in the threads and those that are still waiting in the queue.
-   * However, if the variable paused is set to true, this function only waits for the currently
-   * running tasks (otherwise it would wait forever). To wait for a specific task, use submit()
-   * instead, and call the wait() member function of the generated future.
+   * @brief Wait for all tasks to be completed, both those that are currently running in the
+   * threads and those that are still waiting in the queues. To wait for a specific task, use
+   * submit() instead, and call the wait() member function of the generated future.
+   *
+   * Must not be called from a task of this pool.
    */
   void wait_for_tasks()
   {
-    while (true) {
-      if (!paused) {
-        if (tasks_total == 0) break;
-      } else {
-        if (get_tasks_running() == 0) break;
-      }
-      sleep_or_yield();
-    }
+    std::unique_lock lock(park_mutex);
+    done_cv.wait(lock, [this] { return tasks_total == 0; });
   }
 
+ private:
   /**
-   * @brief An atomic variable indicating to the workers to pause. When set to true, the workers
-   * temporarily stop popping new tasks out of the queue, although any tasks already executed will
-   * keep running until they are done. Set to false again to resume popping tasks.
-   */
-  std::atomic<bool> paused = false;
-
-  /**
-   * @brief The duration, in microseconds, that the worker function should sleep for when it cannot
-   * find any tasks in the queue. If set to 0, then instead of sleeping, the worker function will
-   * execute std::this_thread::yield() if there are no tasks in the queue. The default value is
-   * 1000.
+   * @brief Task deques of a single worker, one per priority.
    */
-  ui32 sleep_duration = 1000;
+  struct worker_queues {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks[2];
+  };
 
- private:
   /**
    * @brief Create the threads in the pool and assign a worker to each thread.
    */
   void create_threads()
   {
     for (ui32 i = 0; i < thread_count; i++) {
-      threads[i] = std::thread(&thread_pool::worker, this);
+      threads[i] = std::thread(&thread_pool::worker, this, i);
     }
   }
 
@@ -297,78 +301,118 @@ class thread_pool {
   }
 
   /**
-   * @brief Try to pop a new task out of the queue.
+   * @brief Try to pop a new task out of the queues, highest priority first.
    *
-   * @param task A reference to the task. Will be populated with a function if the queue is not
-   * empty.
-   * @return true if a task was found, false if the queue is empty.
+   * Takes the oldest task of the worker's own deque, or else steals the newest task of another
+   * worker's deque.
+   *
+   * @param index The index of the worker.
+   * @param task A reference to the task. Will be populated with a function if a task was found.
+   * @return true if a task was found, false if the queues are empty.
    */
-  bool pop_task(std::function<void()>& task)
+  bool pop_task(ui32 index, std::function<void()>& task)
   {
-    const std::scoped_lock lock(queue_mutex);
-    if (tasks.empty())
-      return false;
-    else {
-      task = std::move(tasks.front());
-      tasks.pop();
-      return true;
+    for (int p = 0; p < 2; p++) {
+      if (tasks_queued[p] <= 0) continue;
+      for (ui32 i = 0; i < thread_count; i++) {
+        auto& queue = queues[(index + i) % thread_count];
+        const std::scoped_lock lock(queue.mutex);
+        auto& tasks = queue.tasks[p];
+        if (tasks.empty()) continue;
+        if (i == 0) {
+          task = std::move(tasks.front());
+          tasks.pop_front();
+        } else {
+          task = std::move(tasks.back());
+          tasks.pop_back();
+        }
+        tasks_queued[p]--;
+        return true;
+      }
     }
+    return false;
   }
 
   /**
-   * @brief Sleep for sleep_duration microseconds. If that variable is set to zero, yield instead.
+   * @brief A worker function to be assigned to each thread in the pool. Pops tasks out of the
+   * queues and executes them, and blocks while there are none, until the pool is destroyed.
    *
+   * @param index The index of the worker.
    */
-  void sleep_or_yield()
-  {
-    if (sleep_duration)
-      std::this_thread::sleep_for(std::chrono::microseconds(sleep_duration));
-    else
-      std::this_thread::yield();
-  }
-
-  /**
-   * @brief A worker function to be assigned to each thread in the pool. Continuously pops tasks out
-   * of the queue and executes them, as long as the atomic variable running is set to true.
-   */
-  void worker()
+  void worker(ui32 index)
   {
-    while (running) {
-      std::function<void()> task;
-      if (!paused && pop_task(task)) {
+    current_pool  = this;
+    current_index = index;
+    std::function<void()> task;
+    while (true) {
+      if (pop_task(index, task)) {
         task();
-        tasks_total--;
-      } else {
-        sleep_or_yield();
+        // Release the captured state before the task is counted as complete
+        task = nullptr;
+        if (--tasks_total == 0) {
+          const std::scoped_lock lock(park_mutex);
+          done_cv.notify_all();
+        }
+        continue;
       }
+      std::unique_lock lock(park_mutex);
+      park_cv.wait(lock, [this] { return tasks_queued[0] + tasks_queued[1] > 0 || !running; });
+      if (!running && tasks_queued[0] + tasks_queued[1] <= 0) return;
     }
   }
 
   /**
-   * @brief A mutex to synchronize access to the task queue by different threads.
+   * @brief The pool whose worker runs on the current thread, if any, and the index of the worker.
    */
-  mutable std::mutex queue_mutex;
+  inline static thread_local thread_pool const* current_pool = nullptr;
+  inline static thread_local ui32 current_index              = 0;
 
   /**
-   * @brief An atomic variable indicating to the workers to keep running. When set to false, the
-   * workers permanently stop working.
+   * @brief The number of threads in the pool.
    */
-  std::atomic<bool> running = true;
+  ui32 thread_count;
 
   /**
-   * @brief A queue of tasks to be executed by the threads.
+   * @brief The task queues, one set per worker.
    */
-  std::queue<std::function<void()>> tasks;
+  std::unique_ptr<worker_queues[]> queues;
 
   /**
-   * @brief The number of threads in the pool.
+   * @brief A smart pointer to manage the memory allocated for the threads.
    */
-  ui32 thread_count;
+  std::unique_ptr<std::thread[]> threads;
 
   /**
-   * @brief A smart pointer to manage the memory allocated for the threads.
+   * @brief A mutex to park idle workers and to wait for all tasks to complete.
    */
-  std::unique_ptr<std::thread[]> threads;
+  std::mutex park_mutex;
+
+  /**
+   * @brief Notified when tasks are submitted, or when the pool is destroyed.
+   */
+  std::condition_variable park_cv;
+
+  /**
+   * @brief Notified when the last unfinished task completes.
+   */
+  std::condition_variable done_cv;
+
+  /**
+   * @brief An atomic variable indicating to the workers to keep running. When set to false, the
+   * workers permanently stop working.
+   */
+  std::atomic<bool> running = true;
+
+  /**
+   * @brief Round-robin counter to distribute the tasks submitted from outside the pool.
+   */
+  std::atomic<unsigned> next_queue = 0;
+
+  /**
+   * @brief The number of queued tasks of each priority. Can be transiently negative, when a task
+   * is popped before it is counted.
+   */
+  std::atomic<ui32> tasks_queued[2] = {0, 0};
 
   /**
    * @brief An atomic variable to keep track of the total number of unfinished tasks - either still
@@ -377,5 +421,21 @@ class thread_pool {
   std::atomic<ui32> tasks_total = 0;
 };
 
+/**
+ * @brief Returns the thread pool shared by the host side of cuIO: cuFile reads and writes,
+ * vectored datasource reads and host compression.
+ *
+ * The number of threads is set with the `LIBCUDF_IO_THREAD_COUNT` environment variable; the
+ * default is the number of hardware threads, and at least 16.
+ */
+inline thread_pool& io_thread_pool()
+{
+  static auto const default_thread_count =
+    std::max(16, static_cast<int>(std::thread::hardware_concurrency()));
+  static thread_pool pool(
+    cudf::io::detail::getenv_or("LIBCUDF_IO_THREAD_COUNT", default_thread_count));
+  return pool;
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -16,11 +16,22 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <jit/cache.hpp>
+#include <jit/file_cache.hpp>
+
 #include <cuda.h>
 #include <jitify2.hpp>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string_view>
 
 namespace cudf {
 namespace jit {
@@ -46,43 +57,60 @@ std::filesystem::path get_user_home_cache_dir()
 #endif
 
 /**
- * @brief Get the string path to the JITIFY kernel cache directory.
+ * @brief Get the path to the root of the JITIFY kernel cache.
  *
  * This path can be overridden at runtime by defining an environment variable
  * named `LIBCUDF_KERNEL_CACHE_PATH`. The value of this variable must be a path
  * under which the process' user has read/write privileges.
  *
+ * The default cache root is `$HOME/.cudf`. If no overrides are used and if
+ * $HOME is not defined, returns an empty path and file caching is not used.
+ */
+std::filesystem::path get_cache_root()
+{
+  // The environment variable always overrides the
+  // default/compile-time value of `LIBCUDF_KERNEL_CACHE_PATH`
+  auto kernel_cache_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_PATH");
+  return std::filesystem::path(kernel_cache_path_env != nullptr ? kernel_cache_path_env
+                                                                : LIBCUDF_KERNEL_CACHE_PATH);
+}
+
+/**
+ * @brief Get the path of the cache directory of the current device, relative to the cache root.
+ *
+ * The path is `$CUDF_VERSION/<compute capability>`.
+ */
+std::filesystem::path get_cache_key()
+{
+  // Make per device cache based on compute capability. This is to avoid multiple devices of
+  // different compute capability to access the same kernel cache.
+  int device;
+  int cc_major;
+  int cc_minor;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  int cc = cc_major * 10 + cc_minor;
+
+  return std::filesystem::path{std::string{CUDF_STRINGIFY(CUDF_VERSION)}} / std::to_string(cc);
+}
+
+/**
+ * @brief Get the string path to the JITIFY kernel cache directory.
+ *
  * This function returns a path to the cache directory, creating it if it
  * doesn't exist.
  *
- * The default cache directory is `$HOME/.cudf/$CUDF_VERSION`. If no overrides
- * are used and if $HOME is not defined, returns an empty path and file
- * caching is not used.
+ * The default cache directory is `$HOME/.cudf/$CUDF_VERSION/<compute capability>`.
  */
 std::filesystem::path get_cache_dir()
 {
-  // The environment variable always overrides the
-  // default/compile-time value of `LIBCUDF_KERNEL_CACHE_PATH`
-  auto kernel_cache_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_PATH");
-  auto kernel_cache_path     = std::filesystem::path(
-    kernel_cache_path_env != nullptr ? kernel_cache_path_env : LIBCUDF_KERNEL_CACHE_PATH);
+  auto kernel_cache_path = get_cache_root();
 
   // Cache path could be empty when env HOME is unset or LIBCUDF_KERNEL_CACHE_PATH is defined to be
   // empty, to disallow use of file cache at runtime.
   if (not kernel_cache_path.empty()) {
-    kernel_cache_path /= std::string{CUDF_STRINGIFY(CUDF_VERSION)};
-
-    // Make per device cache based on compute capability. This is to avoid multiple devices of
-    // different compute capability to access the same kernel cache.
-    int device;
-    int cc_major;
-    int cc_minor;
-    CUDF_CUDA_TRY(cudaGetDevice(&device));
-    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
-    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
-    int cc = cc_major * 10 + cc_minor;
-
-    kernel_cache_path /= std::to_string(cc);
+    kernel_cache_path /= get_cache_key();
 
     try {
       // `mkdir -p` the kernel cache path if it doesn't exist
@@ -95,10 +123,191 @@ std::filesystem::path get_cache_dir()
   return kernel_cache_path;
 }
 
+namespace {
+
+// Identifies the archives written by `write_cache_archive`
+constexpr std::string_view archive_magic{"CUDFJIT1"};
+
+std::string read_file(std::filesystem::path const& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  CUDF_EXPECTS(file.is_open(), "Cannot open " + path.string());
+  return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/**
+ * @brief Write a file under a unique temporary name in the same directory, then rename it into
+ * place, so that readers see either no file or the complete file.
+ */
+void write_file_atomic(std::filesystem::path const& path, std::string_view contents)
+{
+  // `mkstemp` creates the file, so that concurrent writers, in other processes or containers
+  // sharing the directory, never pick the same name
+  auto tmp_name = path.string() + ".tmp.XXXXXX";
+  auto const fd = mkstemp(tmp_name.data());
+  CUDF_EXPECTS(fd != -1, "Cannot create a temporary file for " + path.string());
+  std::filesystem::path const tmp_path{tmp_name};
+
+  // the kernel files are read by all the users of a shared cache
+  auto is_written = fchmod(fd, 0644) == 0;
+  for (auto remaining = contents; is_written and not remaining.empty();) {
+    auto const size = write(fd, remaining.data(), remaining.size());
+    is_written      = size > 0;
+    if (is_written) { remaining.remove_prefix(size); }
+  }
+  is_written = (close(fd) == 0) and is_written;
+  if (not is_written) {
+    std::filesystem::remove(tmp_path);
+    CUDF_FAIL("Cannot write " + path.string());
+  }
+  std::filesystem::rename(tmp_path, path);
+}
+
+template <typename T>
+void append_value(std::string& out, T value)
+{
+  out.append(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::string_view& in)
+{
+  CUDF_EXPECTS(in.size() >= sizeof(T), "Truncated kernel cache archive");
+  T value;
+  std::memcpy(&value, in.data(), sizeof(T));
+  in.remove_prefix(sizeof(T));
+  return value;
+}
+
+/**
+ * @brief Calls `f(relative_path, contents)` for each file of an archive written by
+ * `write_cache_archive`.
+ */
+template <typename Function>
+void for_each_archived_file(std::string_view archive, Function f)
+{
+  CUDF_EXPECTS(archive.substr(0, archive_magic.size()) == archive_magic,
+               "Invalid kernel cache archive");
+  archive.remove_prefix(archive_magic.size());
+  while (not archive.empty()) {
+    auto const path_size = read_value<uint32_t>(archive);
+    auto const file_size = read_value<uint64_t>(archive);
+    CUDF_EXPECTS(archive.size() >= path_size + file_size, "Truncated kernel cache archive");
+    f(std::filesystem::path{archive.substr(0, path_size)}, archive.substr(path_size, file_size));
+    archive.remove_prefix(path_size + file_size);
+  }
+}
+
+bool is_temporary_file(std::filesystem::path const& path)
+{
+  return path.filename().string().find(".tmp.") != std::string::npos;
+}
+
+}  // namespace
+
+std::size_t import_shared_cache(std::filesystem::path const& shared,
+                                std::filesystem::path const& cache_dir)
+{
+  std::size_t num_imported = 0;
+  auto const import_file   = [&](std::filesystem::path const& name, auto const& get_contents) {
+    auto const path = cache_dir / name;
+    if (not std::filesystem::exists(path)) {
+      write_file_atomic(path, get_contents());
+      ++num_imported;
+    }
+  };
+
+  auto const key = get_cache_key();
+  if (std::filesystem::is_directory(shared)) {
+    auto const shared_dir = shared / key;
+    if (not std::filesystem::is_directory(shared_dir)) { return 0; }
+    for (auto const& entry : std::filesystem::directory_iterator(shared_dir)) {
+      if (not entry.is_regular_file() or is_temporary_file(entry.path())) { continue; }
+      import_file(entry.path().filename(), [&] { return read_file(entry.path()); });
+    }
+  } else {
+    auto const archive = read_file(shared);
+    for_each_archived_file(archive, [&](auto const& path, std::string_view contents) {
+      if (path.parent_path() == key) {
+        import_file(path.filename(), [&] { return contents; });
+      }
+    });
+  }
+  return num_imported;
+}
+
+std::size_t write_cache_archive(std::filesystem::path const& archive)
+{
+  auto const cache_root = get_cache_root();
+  CUDF_EXPECTS(not cache_root.empty(), "The kernel file cache is disabled");
+  auto const version_dir = cache_root / std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+
+  std::string contents{archive_magic};
+  std::size_t num_archived = 0;
+  if (std::filesystem::is_directory(version_dir)) {
+    for (auto const& entry : std::filesystem::recursive_directory_iterator(version_dir)) {
+      if (not entry.is_regular_file() or is_temporary_file(entry.path())) { continue; }
+      auto const path = std::filesystem::relative(entry.path(), cache_root).generic_string();
+      auto const file = read_file(entry.path());
+      append_value<uint32_t>(contents, path.size());
+      append_value<uint64_t>(contents, file.size());
+      contents += path;
+      contents += file;
+      ++num_archived;
+    }
+  }
+  write_file_atomic(archive, contents);
+  return num_archived;
+}
+
+/**
+ * @brief Import the kernels of the shared cache named by `LIBCUDF_KERNEL_CACHE_SHARED_PATH`, once
+ * per process.
+ *
+ * The shared cache is typically prepopulated by `cudf_jit_warmup` at image build time.
+ */
+void import_shared_cache_once(std::filesystem::path const& cache_dir)
+{
+  static std::once_flag imported;
+  std::call_once(imported, [&] {
+    auto const shared = std::getenv("LIBCUDF_KERNEL_CACHE_SHARED_PATH");
+    if (shared == nullptr) { return; }
+    try {
+      import_shared_cache(shared, cache_dir);
+    } catch (const std::exception&) {
+      // the kernels are compiled on first use instead
+    }
+  });
+}
+
+/**
+ * @brief Get the kernel directory of the current device in the shared cache named by
+ * `LIBCUDF_KERNEL_CACHE_SHARED_PATH`, if the shared cache is a directory.
+ *
+ * @return The directory, or an empty path if there is no such directory
+ */
+std::filesystem::path get_shared_cache_dir()
+{
+  auto const shared = std::getenv("LIBCUDF_KERNEL_CACHE_SHARED_PATH");
+  if (shared == nullptr or not std::filesystem::is_directory(shared)) { return {}; }
+  auto const shared_dir = std::filesystem::path{shared} / get_cache_key();
+  return std::filesystem::is_directory(shared_dir) ? shared_dir : std::filesystem::path{};
+}
+
+/**
+ * @brief Get the kernel cache directory used by jitify.
+ *
+ * The kernels of the shared cache are imported into the kernel cache directory. Without a kernel
+ * cache directory, e.g. when `HOME` is unset, the kernels are read directly from the shared cache
+ * directory; jitify ignores the kernels it cannot write there.
+ */
 std::string get_program_cache_dir()
 {
 #if defined(JITIFY_USE_CACHE)
-  return get_cache_dir().string();
+  auto const cache_dir = get_cache_dir();
+  if (cache_dir.empty()) { return get_shared_cache_dir().string(); }
+  import_shared_cache_once(cache_dir);
+  return cache_dir.string();
 #else
   return {};
 #endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// This header must not include jitify, so that it can be used by the sources that are not compiled
+// with `_FILE_OFFSET_BITS=64`
+
+#include <cstddef>
+#include <filesystem>
+
+namespace cudf {
+namespace jit {
+
+/**
+ * @brief Get the kernel cache directory of the current cudf version and device architecture,
+ * creating it if it doesn't exist.
+ *
+ * @return The directory, or an empty path if the file cache is disabled
+ */
+std::filesystem::path get_cache_dir();
+
+/**
+ * @brief Import the kernels of a shared cache into the kernel cache directory.
+ *
+ * The shared cache is either a directory with the layout of the kernel cache, which only needs to
+ * be readable, or an archive written by `write_cache_archive`. Only the kernels of the current cudf
+ * version and device architecture that are missing from `cache_dir` are imported. Each kernel file
+ * is written under a temporary name and renamed into place, so that concurrent processes never
+ * read a partial file.
+ *
+ * @param shared Path of the shared cache directory or archive
+ * @param cache_dir Kernel cache directory, as returned by `get_cache_dir`
+ * @return The number of imported kernel files
+ */
+std::size_t import_shared_cache(std::filesystem::path const& shared,
+                                std::filesystem::path const& cache_dir);
+
+/**
+ * @brief Write the kernels cached for the current cudf version, for all device architectures, into
+ * a single archive file.
+ *
+ * The archive is written under a temporary name and renamed into place.
+ *
+ * @throw cudf::logic_error if the file cache is disabled or the archive cannot be written
+ *
+ * @param archive Path of the archive to write
+ * @return The number of archived kernel files
+ */
+std::size_t write_cache_archive(std::filesystem::path const& archive);
+
+}  // namespace jit
+}  // namespace cudf
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file warmup.cpp
+ * @brief `cudf_jit_warmup` compiles a declared list of JIT kernels into the kernel file cache, so
+ * that the kernels are not compiled on first use, e.g. in every new container.
+ *
+ * Usage: `cudf_jit_warmup <manifest> [<archive>]`
+ *
+ * The kernels are compiled for the current device into the cache root named by
+ * `LIBCUDF_KERNEL_CACHE_PATH`. If an archive path is given, the kernels cached for this cudf
+ * version are then written into that single file. Either the cache root or the archive can be
+ * shared with other processes through `LIBCUDF_KERNEL_CACHE_SHARED_PATH`.
+ *
+ * Each line of the manifest declares one kernel; `#` starts a comment:
+ *
+ *     # operation  UDF type  UDF file  output type  input types
+ *     binaryop     ptx       add.ptx   FLOAT64      INT32 FLOAT64
+ *     transform    cuda      scale.cu  FLOAT32      FLOAT32
+ *     rolling      ptx       sum.ptx   INT64        INT32
+ *
+ * `binaryop` is a binary operation, which only accepts PTX UDFs; `transform` a unary transform;
+ * and `rolling` a fixed-size rolling window. Types are fixed-width `cudf::type_id` names.
+ */
+
+#include <jit/file_cache.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+cudf::data_type parse_type(std::string const& name)
+{
+  static std::map<std::string, cudf::type_id> const type_ids{
+    {"INT8", cudf::type_id::INT8},
+    {"INT16", cudf::type_id::INT16},
+    {"INT32", cudf::type_id::INT32},
+    {"INT64", cudf::type_id::INT64},
+    {"UINT8", cudf::type_id::UINT8},
+    {"UINT16", cudf::type_id::UINT16},
+    {"UINT32", cudf::type_id::UINT32},
+    {"UINT64", cudf::type_id::UINT64},
+    {"FLOAT32", cudf::type_id::FLOAT32},
+    {"FLOAT64", cudf::type_id::FLOAT64},
+    {"BOOL8", cudf::type_id::BOOL8},
+    {"TIMESTAMP_DAYS", cudf::type_id::TIMESTAMP_DAYS},
+    {"TIMESTAMP_SECONDS", cudf::type_id::TIMESTAMP_SECONDS},
+    {"TIMESTAMP_MILLISECONDS", cudf::type_id::TIMESTAMP_MILLISECONDS},
+    {"TIMESTAMP_MICROSECONDS", cudf::type_id::TIMESTAMP_MICROSECONDS},
+    {"TIMESTAMP_NANOSECONDS", cudf::type_id::TIMESTAMP_NANOSECONDS},
+    {"DURATION_DAYS", cudf::type_id::DURATION_DAYS},
+    {"DURATION_SECONDS", cudf::type_id::DURATION_SECONDS},
+    {"DURATION_MILLISECONDS", cudf::type_id::DURATION_MILLISECONDS},
+    {"DURATION_MICROSECONDS", cudf::type_id::DURATION_MICROSECONDS},
+    {"DURATION_NANOSECONDS", cudf::type_id::DURATION_NANOSECONDS}};
+  auto const type_id = type_ids.find(name);
+  CUDF_EXPECTS(type_id != type_ids.end(), "Unsupported type " + name);
+  return cudf::data_type{type_id->second};
+}
+
+/**
+ * @brief Creates a one-row column of zeros, enough to launch the kernel of an operation.
+ */
+std::unique_ptr<cudf::column> make_input(cudf::data_type type)
+{
+  auto column = cudf::make_fixed_width_column(type, 1);
+  CUDF_CUDA_TRY(cudaMemset(column->mutable_view().data<char>(), 0, cudf::size_of(type)));
+  return column;
+}
+
+std::string read_udf(std::string const& filename)
+{
+  std::ifstream file(filename);
+  CUDF_EXPECTS(file.is_open(), "Cannot open " + filename);
+  return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/**
+ * @brief Runs the operation declared by a manifest line, compiling its kernel.
+ */
+void compile_kernel(std::string const& line)
+{
+  std::istringstream fields(line);
+  std::string operation, udf_type, udf_file, output_type;
+  fields >> operation >> udf_type >> udf_file >> output_type;
+  std::vector<std::unique_ptr<cudf::column>> inputs;
+  for (std::string input_type; fields >> input_type;) {
+    inputs.push_back(make_input(parse_type(input_type)));
+  }
+
+  CUDF_EXPECTS(udf_type == "ptx" or udf_type == "cuda", "UDF type must be ptx or cuda");
+  bool const is_ptx = udf_type == "ptx";
+  auto const udf    = read_udf(udf_file);
+  auto const type   = parse_type(output_type);
+
+  if (operation == "binaryop") {
+    CUDF_EXPECTS(is_ptx, "Binary operations only accept PTX UDFs");
+    CUDF_EXPECTS(inputs.size() == 2, "Binary operations take two input types");
+    cudf::binary_operation(*inputs[0], *inputs[1], udf, type);
+  } else if (operation == "transform") {
+    CUDF_EXPECTS(inputs.size() == 1, "Transforms take one input type");
+    cudf::transform(*inputs[0], udf, type, is_ptx);
+  } else if (operation == "rolling") {
+    CUDF_EXPECTS(inputs.size() == 1, "Rolling windows take one input type");
+    auto const aggregation = cudf::make_udf_aggregation<cudf::rolling_aggregation>(
+      is_ptx ? cudf::udf_type::PTX : cudf::udf_type::CUDA, udf, type);
+    cudf::rolling_window(*inputs[0], 1, 0, 1, *aggregation);
+  } else {
+    CUDF_FAIL("Unknown operation " + operation);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 2 or argc > 3) {
+    std::cerr << "Usage: " << argv[0] << " <manifest> [<archive>]\n";
+    return 2;
+  }
+
+  auto const cache_dir = cudf::jit::get_cache_dir();
+  if (cache_dir.empty()) {
+    std::cerr << "The kernel file cache is disabled; set LIBCUDF_KERNEL_CACHE_PATH\n";
+    return 1;
+  }
+
+  std::ifstream manifest(argv[1]);
+  if (not manifest.is_open()) {
+    std::cerr << "Cannot open " << argv[1] << "\n";
+    return 1;
+  }
+
+  int num_failed = 0;
+  int line_num   = 0;
+  for (std::string line; std::getline(manifest, line);) {
+    ++line_num;
+    line = line.substr(0, line.find('#'));
+    if (line.find_first_not_of(" \t\r") == std::string::npos) { continue; }
+    try {
+      compile_kernel(line);
+    } catch (std::exception const& e) {
+      std::cerr << argv[1] << ":" << line_num << ": " << e.what() << "\n";
+      ++num_failed;
+    }
+  }
+  std::cout << "Kernel cache: " << cache_dir.string() << "\n";
+
+  if (argc == 3) {
+    auto const num_archived = cudf::jit::write_cache_archive(argv[2]);
+    std::cout << "Archived " << num_archived << " kernel files into " << argv[2] << "\n";
+  }
+  return num_failed == 0 ? 0 : 1;
+}
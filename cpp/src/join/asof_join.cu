@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The type of the tolerance of `on` values: the duration type of timestamps, the type
+ * itself otherwise.
+ */
+template <typename T, typename Enable = void>
+struct asof_tolerance {
+  using type = T;
+};
+
+template <typename T>
+struct asof_tolerance<T, std::enable_if_t<is_timestamp<T>()>> {
+  using type = typename T::duration;
+};
+
+template <typename T>
+using asof_tolerance_t = typename asof_tolerance<T>::type;
+
+/**
+ * @brief The type of the distance between two `on` values.
+ *
+ * The distance between integral or chrono values is computed in the unsigned type of their
+ * representation, in which it cannot overflow however far apart the values are.
+ */
+template <typename T, typename Enable = void>
+struct asof_distance {
+  using type = T;
+};
+
+template <typename T>
+struct asof_distance<T, std::enable_if_t<std::is_integral_v<T>>> {
+  using type = std::make_unsigned_t<T>;
+};
+
+template <typename T>
+struct asof_distance<T, std::enable_if_t<is_chrono<T>()>> {
+  using type = std::make_unsigned_t<typename T::rep>;
+};
+
+template <typename T>
+using asof_distance_t = typename asof_distance<T>::type;
+
+/**
+ * @brief Returns the arithmetic representation of an `on` or tolerance value.
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline auto to_rep(T value)
+{
+  if constexpr (is_timestamp<T>()) {
+    return value.time_since_epoch().count();
+  } else if constexpr (is_duration<T>()) {
+    return value.count();
+  } else {
+    return value;
+  }
+}
+
+/**
+ * @brief Returns the distance from `lesser` to `greater`, which must not be less than `lesser`.
+ */
+template <typename T>
+__device__ inline asof_distance_t<T> asof_difference(T greater, T lesser)
+{
+  using distance_type = asof_distance_t<T>;
+  if constexpr (std::is_floating_point_v<T>) {
+    return greater - lesser;
+  } else {
+    // Wraps around to the exact distance, since it fits the unsigned type
+    return static_cast<distance_type>(static_cast<distance_type>(to_rep(greater)) -
+                                      static_cast<distance_type>(to_rep(lesser)));
+  }
+}
+
+template <typename T>
+constexpr bool is_supported_on_type()
+{
+  return is_index_type<T>() or std::is_floating_point_v<T> or is_chrono<T>();
+}
+
+/**
+ * @brief The positions in the sorted right table found by binary search for every left row.
+ *
+ * The candidates are the last right row less than or equal to the left row, i.e. `upper - 1`, and
+ * the first one greater than or equal to it, i.e. `lower`, when comparing keys then `on` values.
+ * They only match if they lie within the range `[keys_lower, keys_upper)` of right rows with the
+ * same keys. Any of the pointers is null when its search was not needed.
+ */
+struct search_results {
+  size_type const* lower{nullptr};
+  size_type const* upper{nullptr};
+  size_type const* keys_lower{nullptr};
+  size_type const* keys_upper{nullptr};
+};
+
+/**
+ * @brief Selects the matching right row of a left row among the candidates of the binary searches.
+ */
+template <typename T>
+struct asof_match_fn {
+  column_device_view left_on;
+  column_device_view sorted_right_on;
+  size_type const* right_order;
+  search_results searches;
+  bitmask_type const* row_bitmask;
+  bool has_tolerance;
+  asof_distance_t<T> tolerance;  ///< Greatest distance of a match, if `has_tolerance`
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (left_on.is_null(row) or (row_bitmask != nullptr and not bit_is_set(row_bitmask, row))) {
+      return JoinNoneValue;
+    }
+    auto const value = left_on.element<T>(row);
+
+    size_type match = JoinNoneValue;
+    asof_distance_t<T> match_distance{};
+    if (searches.upper != nullptr) {
+      auto const candidate   = searches.upper[row] - 1;
+      auto const keys_begin  = searches.keys_lower != nullptr ? searches.keys_lower[row] : 0;
+      auto const is_in_range = candidate >= keys_begin and sorted_right_on.is_valid(candidate);
+      if (is_in_range) {
+        auto const distance = asof_difference(value, sorted_right_on.element<T>(candidate));
+        if (not has_tolerance or distance <= tolerance) {
+          match          = candidate;
+          match_distance = distance;
+        }
+      }
+    }
+    if (searches.lower != nullptr) {
+      auto const candidate   = searches.lower[row];
+      auto const keys_end    = searches.keys_upper != nullptr ? searches.keys_upper[row]
+                                                              : sorted_right_on.size();
+      auto const is_in_range = candidate < keys_end and sorted_right_on.is_valid(candidate);
+      if (is_in_range) {
+        auto const distance = asof_difference(sorted_right_on.element<T>(candidate), value);
+        // The preceding row is kept on ties, except for exact matches where the first of the equal
+        // rows is matched as when looking forward
+        if ((not has_tolerance or distance <= tolerance) and
+            (match == JoinNoneValue or distance < match_distance or
+             distance == asof_distance_t<T>{0})) {
+          match = candidate;
+        }
+      }
+    }
+    return match == JoinNoneValue ? JoinNoneValue : right_order[match];
+  }
+};
+
+struct asof_join_fn {
+  template <typename T, CUDF_ENABLE_IF(is_supported_on_type<T>())>
+  std::unique_ptr<rmm::device_uvector<size_type>> operator()(
+    column_view const& left_on,
+    column_view const& sorted_right_on,
+    column_view const& right_order,
+    search_results const& searches,
+    bitmask_type const* row_bitmask,
+    std::optional<std::reference_wrapper<scalar const>> tolerance,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    using tolerance_type = asof_tolerance_t<T>;
+
+    auto tolerance_value = asof_distance_t<T>{};
+    if (tolerance.has_value()) {
+      auto const& tolerance_scalar = tolerance->get();
+      CUDF_EXPECTS(tolerance_scalar.type() == data_type{type_to_id<tolerance_type>()},
+                   "Tolerance type must match the type of differences of the on columns");
+      CUDF_EXPECTS(tolerance_scalar.is_valid(stream), "Tolerance must not be null");
+      auto const value =
+        to_rep(static_cast<scalar_type_t<tolerance_type> const&>(tolerance_scalar).value(stream));
+      if constexpr (std::is_signed_v<decltype(value)>) {
+        CUDF_EXPECTS(value >= 0, "Tolerance must not be negative");
+      }
+      tolerance_value = static_cast<asof_distance_t<T>>(value);
+    }
+
+    auto const d_left_on         = column_device_view::create(left_on, stream);
+    auto const d_sorted_right_on = column_device_view::create(sorted_right_on, stream);
+
+    auto gather_map =
+      std::make_unique<rmm::device_uvector<size_type>>(left_on.size(), stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(left_on.size()),
+                      gather_map->begin(),
+                      asof_match_fn<T>{*d_left_on,
+                                       *d_sorted_right_on,
+                                       right_order.data<size_type>(),
+                                       searches,
+                                       row_bitmask,
+                                       tolerance.has_value(),
+                                       tolerance_value});
+    return gather_map;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported_on_type<T>(), std::unique_ptr<rmm::device_uvector<size_type>>>
+  operator()(Args&&...) const
+  {
+    CUDF_FAIL("As-of joins only support integral, floating-point and chrono on columns");
+  }
+};
+
+/**
+ * @brief Appends the `on` column to the key columns of a table.
+ */
+table_view append_on_column(table_view const& keys, column_view const& on)
+{
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(on);
+  return table_view{columns};
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction,
+  std::optional<std::reference_wrapper<scalar const>> tolerance,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  auto const num_keys = left_keys.num_columns();
+  CUDF_EXPECTS(num_keys == 0 or left_keys.num_rows() == left_on.size(),
+               "Left keys and on column must have the same size");
+  CUDF_EXPECTS(num_keys == 0 or right_keys.num_rows() == right_on.size(),
+               "Right keys and on column must have the same size");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in types of the on columns");
+
+  auto const left  = append_on_column(left_keys, left_on);
+  auto const right = append_on_column(right_keys, right_on);
+
+  // Nulls sort last in the on column, so that no right row with a null on value precedes a value
+  std::vector<order> const column_order(num_keys + 1, order::ASCENDING);
+  std::vector<null_order> null_precedence(num_keys, null_order::BEFORE);
+  null_precedence.push_back(null_order::AFTER);
+
+  auto const right_order =
+    detail::stable_sorted_order(right, column_order, null_precedence, stream);
+  auto const sorted_right = detail::gather(right,
+                                           right_order->view(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           detail::negative_index_policy::NOT_ALLOWED,
+                                           stream);
+
+  // The right rows with the same keys as a left row are found by searching the keys alone
+  auto const sorted_right_view = sorted_right->view();
+  auto const sorted_right_keys =
+    table_view{std::vector<column_view>(sorted_right_view.begin(), sorted_right_view.end() - 1)};
+  std::vector<order> const keys_order(column_order.begin(), column_order.end() - 1);
+  std::vector<null_order> const keys_null_precedence(null_precedence.begin(),
+                                                     null_precedence.end() - 1);
+
+  // Only the searches for the candidates in the given direction are run
+  auto const search_mr = rmm::mr::get_current_device_resource();
+  std::unique_ptr<column> lower, upper, keys_lower, keys_upper;
+  if (direction != asof_direction::FORWARD) {
+    upper = detail::upper_bound(
+      sorted_right_view, left, column_order, null_precedence, stream, search_mr);
+    if (num_keys > 0) {
+      keys_lower = detail::lower_bound(
+        sorted_right_keys, left_keys, keys_order, keys_null_precedence, stream, search_mr);
+    }
+  }
+  if (direction != asof_direction::BACKWARD) {
+    lower = detail::lower_bound(
+      sorted_right_view, left, column_order, null_precedence, stream, search_mr);
+    if (num_keys > 0) {
+      keys_upper = detail::upper_bound(
+        sorted_right_keys, left_keys, keys_order, keys_null_precedence, stream, search_mr);
+    }
+  }
+  auto const data = [](std::unique_ptr<column> const& result) {
+    return result != nullptr ? result->view().data<size_type>() : nullptr;
+  };
+  auto const searches =
+    search_results{data(lower), data(upper), data(keys_lower), data(keys_upper)};
+
+  // The sort order compares nulls as equal, so a left row with a null key is dropped here when
+  // nulls are unequal
+  auto const skip_nulls = compare_nulls == null_equality::UNEQUAL and has_nulls(left_keys);
+  auto const row_bitmask =
+    skip_nulls ? cudf::detail::bitmask_and(left_keys, stream).first : rmm::device_buffer{0, stream};
+
+  return type_dispatcher(
+    left_on.type(),
+    asof_join_fn{},
+    left_on,
+    sorted_right->get_column(num_keys).view(),
+    right_order->view(),
+    searches,
+    skip_nulls ? static_cast<bitmask_type const*>(row_bitmask.data()) : nullptr,
+    tolerance,
+    stream,
+    mr);
+}
+
+}  // namespace
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  column_view const& left_on,
+  column_view const& right_on,
+  asof_direction direction,
+  std::optional<std::reference_wrapper<scalar const>> tolerance,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_keys,
+                           right_keys,
+                           left_on,
+                           right_on,
+                           direction,
+                           tolerance,
+                           compare_nulls,
+                           cudf::default_stream_value,
+                           mr);
+}
+
+}  // namespace cudf
@@ -16,6 +16,9 @@
 
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
@@ -23,17 +26,291 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 #include <join/conditional_join.hpp>
 #include <join/conditional_join_kernels.cuh>
 #include <join/join_common_utils.cuh>
 #include <join/join_common_utils.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <optional>
+#include <vector>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief A comparison `table.column op other_table.other_column` that a join predicate requires to
+ * be true, where `op` is one of `<`, `<=`, `>` or `>=`.
+ */
+struct range_term {
+  ast::table_reference table;
+  size_type column;
+  size_type other_column;
+  ast::ast_operator op;
+};
+
+/**
+ * @brief Returns the operator `op'` for which `b op' a` is equivalent to `a op b`.
+ */
+ast::ast_operator flip_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    default: return ast::ast_operator::LESS_EQUAL;
+  }
+}
+
+/**
+ * @brief Collects the comparisons between a left and a right column that are joined to the root
+ * of the predicate by logical ands only, so that a pair of rows can only match if they are true.
+ */
+void collect_range_terms(ast::expression const& expr, std::vector<range_term>& terms)
+{
+  auto const operation = dynamic_cast<ast::operation const*>(&expr);
+  if (operation == nullptr) { return; }
+  auto const op       = operation->get_operator();
+  auto const operands = operation->get_operands();
+  switch (op) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::NULL_LOGICAL_AND:
+      for (auto const& operand : operands) {
+        collect_range_terms(operand.get(), terms);
+      }
+      return;
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER_EQUAL: break;
+    default: return;
+  }
+
+  auto const lhs = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const rhs = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+  if (lhs == nullptr or rhs == nullptr) { return; }
+  auto const lhs_table = lhs->get_table_source();
+  auto const rhs_table = rhs->get_table_source();
+  if (lhs_table == rhs_table or lhs_table == ast::table_reference::OUTPUT or
+      rhs_table == ast::table_reference::OUTPUT) {
+    return;
+  }
+  // Each column is bounded by the other one
+  terms.push_back({lhs_table, lhs->get_column_index(), rhs->get_column_index(), op});
+  terms.push_back(
+    {rhs_table, rhs->get_column_index(), lhs->get_column_index(), flip_comparison(op)});
+}
+
+/**
+ * @brief A bound of the sorted column by a column of the other table.
+ */
+struct column_bound {
+  size_type column{-1};    ///< Index of the bounding column, or -1 if unbounded
+  bool inclusive{false};  ///< Whether rows equal to the bound match
+};
+
+/**
+ * @brief Range predicates bounding a column of one table by columns of the other table.
+ */
+struct range_predicate {
+  ast::table_reference table;  ///< Table of the bounded column
+  size_type column;            ///< Index of the bounded column
+  column_bound lower;          ///< Bound that the column is greater than
+  column_bound upper;          ///< Bound that the column is less than
+};
+
+/**
+ * @brief Finds range predicates on a column of the table whose rows each thread loops over.
+ *
+ * Inner joins can loop over either table, the other joins only over the right table. The
+ * predicates bounding a column from both sides are preferred. Only integral and chrono columns
+ * are considered, which compare in the same order as they sort.
+ */
+std::optional<range_predicate> find_range_predicate(ast::expression const& binary_predicate,
+                                                    table_view const& left,
+                                                    table_view const& right,
+                                                    join_kind join_type)
+{
+  std::vector<range_term> terms;
+  collect_range_terms(binary_predicate, terms);
+
+  auto const is_usable = [&](range_term const& term) {
+    auto const is_left = term.table == ast::table_reference::LEFT;
+    if (is_left and join_type != join_kind::INNER_JOIN) { return false; }
+    auto const type = (is_left ? left : right).column(term.column).type();
+    return (is_index_type(type) or is_chrono(type)) and
+           (is_left ? right : left).column(term.other_column).type() == type;
+  };
+  auto const num_bounds = [](range_predicate const& predicate) {
+    return (predicate.lower.column >= 0 ? 1 : 0) + (predicate.upper.column >= 0 ? 1 : 0);
+  };
+
+  std::optional<range_predicate> best;
+  for (auto const& term : terms) {
+    if (not is_usable(term)) { continue; }
+    range_predicate predicate{term.table, term.column};
+    for (auto const& bound : terms) {
+      if (bound.table != term.table or bound.column != term.column) { continue; }
+      auto const is_lower = bound.op == ast::ast_operator::GREATER or
+                            bound.op == ast::ast_operator::GREATER_EQUAL;
+      auto& target = is_lower ? predicate.lower : predicate.upper;
+      if (target.column < 0) {
+        target = column_bound{bound.other_column,
+                              bound.op == ast::ast_operator::GREATER_EQUAL or
+                                bound.op == ast::ast_operator::LESS_EQUAL};
+      }
+    }
+    if (not best.has_value() or num_bounds(predicate) > num_bounds(*best)) { best = predicate; }
+  }
+  return best;
+}
+
+/**
+ * @brief Finds the range of each outer row in the sorted non-null values of the bounded column.
+ */
+template <typename T>
+struct candidate_range_fn {
+  T const* sorted_begin;
+  T const* sorted_end;
+  table_device_view outer;
+  column_bound lower;
+  column_bound upper;
+  size_type* begins;
+  size_type* ends;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto begin = sorted_begin;
+    auto end   = sorted_end;
+    // Comparing to a null bound is null, which never matches
+    if (lower.column >= 0) {
+      auto const& bound = outer.column(lower.column);
+      if (bound.is_null(row)) {
+        end = begin;
+      } else if (lower.inclusive) {
+        begin = thrust::lower_bound(thrust::seq, begin, end, bound.element<T>(row));
+      } else {
+        begin = thrust::upper_bound(thrust::seq, begin, end, bound.element<T>(row));
+      }
+    }
+    if (upper.column >= 0) {
+      auto const& bound = outer.column(upper.column);
+      if (bound.is_null(row)) {
+        end = begin;
+      } else if (upper.inclusive) {
+        end = thrust::upper_bound(thrust::seq, begin, end, bound.element<T>(row));
+      } else {
+        end = thrust::lower_bound(thrust::seq, begin, end, bound.element<T>(row));
+      }
+    }
+    begins[row] = static_cast<size_type>(begin - sorted_begin);
+    ends[row]   = static_cast<size_type>(end - sorted_begin);
+  }
+};
+
+struct compute_candidate_ranges_fn {
+  template <typename T, CUDF_ENABLE_IF(is_index_type<T>() or is_chrono<T>())>
+  void operator()(column_view const& sorted,
+                  size_type num_sorted,
+                  table_device_view const& outer,
+                  range_predicate const& predicate,
+                  size_type* begins,
+                  size_type* ends,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const sorted_begin = sorted.begin<T>();
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       outer.num_rows(),
+                       candidate_range_fn<T>{sorted_begin,
+                                             sorted_begin + num_sorted,
+                                             outer,
+                                             predicate.lower,
+                                             predicate.upper,
+                                             begins,
+                                             ends});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not(is_index_type<T>() or is_chrono<T>()), void> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Range predicates are only supported on integral and chrono columns");
+  }
+};
+
+/**
+ * @brief The inner table sorted on a bounded column and the range of candidate rows of each outer
+ * row in that order.
+ */
+struct candidate_ranges {
+  bool swap_tables;  ///< Whether the left table is the inner table
+  std::unique_ptr<column> inner_order;
+  rmm::device_uvector<size_type> begins;
+  rmm::device_uvector<size_type> ends;
+
+  [[nodiscard]] candidate_rows view() const
+  {
+    return candidate_rows{inner_order->view().data<size_type>(), begins.data(), ends.data()};
+  }
+};
+
+/**
+ * @brief Sorts the inner table on the column bounded by range predicates, if any, and finds the
+ * candidate rows of every outer row by binary search, so that the predicate is only evaluated for
+ * these rather than for all pairs of rows.
+ */
+std::optional<candidate_ranges> find_candidate_ranges(ast::expression const& binary_predicate,
+                                                      table_view const& left,
+                                                      table_view const& right,
+                                                      join_kind join_type,
+                                                      rmm::cuda_stream_view stream)
+{
+  auto const predicate = find_range_predicate(binary_predicate, left, right, join_type);
+  if (not predicate.has_value()) { return std::nullopt; }
+
+  auto const swap_tables = predicate->table == ast::table_reference::LEFT;
+  auto const& inner      = swap_tables ? left : right;
+  auto const& outer      = swap_tables ? right : left;
+  auto const mr          = rmm::mr::get_current_device_resource();
+
+  // Nulls never satisfy a comparison, so they are sorted last and left out of all ranges
+  auto const bounded = table_view{{inner.column(predicate->column)}};
+  auto inner_order =
+    cudf::detail::stable_sorted_order(bounded, {order::ASCENDING}, {null_order::AFTER}, stream, mr);
+  auto const sorted = cudf::detail::gather(bounded,
+                                           inner_order->view(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           mr);
+  auto const num_valid = bounded.num_rows() - bounded.column(0).null_count();
+
+  auto const outer_table = table_device_view::create(outer, stream);
+  rmm::device_uvector<size_type> begins(outer.num_rows(), stream);
+  rmm::device_uvector<size_type> ends(outer.num_rows(), stream);
+  type_dispatcher(bounded.column(0).type(),
+                  compute_candidate_ranges_fn{},
+                  sorted->get_column(0).view(),
+                  num_valid,
+                  *outer_table,
+                  *predicate,
+                  begins.data(),
+                  ends.data(),
+                  stream);
+  return candidate_ranges{swap_tables, std::move(inner_order), std::move(begins), std::move(ends)};
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -95,9 +372,15 @@ conditional_join(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
+  // Range predicates on a column of the table that each thread loops over restrict the rows that
+  // it compares to.
+  auto const ranges     = find_candidate_ranges(binary_predicate, left, right, join_type, stream);
+  auto const candidates = ranges.has_value() ? ranges->view() : candidate_rows{};
+
   // For inner joins we support optimizing the join by launching one thread for
   // whichever table is larger rather than always using the left table.
   auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
+  if (ranges.has_value()) { swap_tables = ranges->swap_tables; }
   detail::grid_1d const config(swap_tables ? right_num_rows : left_num_rows,
                                DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
@@ -119,6 +402,7 @@ conditional_join(table_view const& left,
           kernel_join_type,
           parser.device_expression_data,
           swap_tables,
+          candidates,
           size.data());
     } else {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
@@ -128,6 +412,7 @@ conditional_join(table_view const& left,
           kernel_join_type,
           parser.device_expression_data,
           swap_tables,
+          candidates,
           size.data());
     }
     join_size = size.value(stream);
@@ -162,7 +447,8 @@ conditional_join(table_view const& left,
         write_index.data(),
         parser.device_expression_data,
         join_size,
-        swap_tables);
+        swap_tables,
+        candidates);
   } else {
     conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
@@ -174,7 +460,8 @@ conditional_join(table_view const& left,
         write_index.data(),
         parser.device_expression_data,
         join_size,
-        swap_tables);
+        swap_tables,
+        candidates);
   }
 
   auto join_indices = std::pair(std::move(left_indices), std::move(right_indices));
@@ -248,9 +535,15 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
+  // Range predicates on a column of the table that each thread loops over restrict the rows that
+  // it compares to.
+  auto const ranges     = find_candidate_ranges(binary_predicate, left, right, join_type, stream);
+  auto const candidates = ranges.has_value() ? ranges->view() : candidate_rows{};
+
   // For inner joins we support optimizing the join by launching one thread for
   // whichever table is larger rather than always using the left table.
   auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
+  if (ranges.has_value()) { swap_tables = ranges->swap_tables; }
   detail::grid_1d const config(swap_tables ? right_num_rows : left_num_rows,
                                DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
@@ -268,6 +561,7 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
         join_type,
         parser.device_expression_data,
         swap_tables,
+        candidates,
         size.data());
   } else {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
@@ -277,6 +571,7 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
         join_type,
         parser.device_expression_data,
         swap_tables,
+        candidates,
         size.data());
   }
   return size.value(stream);
@@ -29,6 +29,36 @@
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief The candidate inner rows that each outer row of a conditional join is compared to.
+ *
+ * When the predicate bounds a column of the inner table by columns of the outer table, the inner
+ * rows are sorted on that column and outer row `i` is only compared to the rows
+ * `inner_order[begins[i]]` to `inner_order[ends[i] - 1]`. Otherwise, with a null `inner_order`,
+ * every outer row is compared to all inner rows.
+ */
+struct candidate_rows {
+  cudf::size_type const* inner_order{nullptr};  ///< Inner row indices sorted on the bounded column
+  cudf::size_type const* begins{nullptr};       ///< First candidate of each outer row
+  cudf::size_type const* ends{nullptr};         ///< End of the candidates of each outer row
+
+  __device__ cudf::size_type begin(cudf::size_type outer_row_index) const
+  {
+    return inner_order == nullptr ? 0 : begins[outer_row_index];
+  }
+
+  __device__ cudf::size_type end(cudf::size_type outer_row_index,
+                                 cudf::size_type inner_num_rows) const
+  {
+    return inner_order == nullptr ? inner_num_rows : ends[outer_row_index];
+  }
+
+  __device__ cudf::size_type inner_row_index(cudf::size_type candidate) const
+  {
+    return inner_order == nullptr ? candidate : inner_order[candidate];
+  }
+};
+
 /**
  * @brief Computes the output size of joining the left table to the right table.
  *
@@ -45,6 +75,7 @@ namespace detail {
  * expression.
  * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
  * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
+ * @param[in] candidates The inner rows that each outer row is compared to
  * @param[out] output_size The resulting output size
  */
 template <int block_size, bool has_nulls>
@@ -54,6 +85,7 @@ __global__ void compute_conditional_join_output_size(
   join_kind join_type,
   ast::detail::expression_device_view device_expression_data,
   bool const swap_tables,
+  candidate_rows const candidates,
   std::size_t* output_size)
 {
   // The (required) extern storage of the shared memory array leads to
@@ -79,8 +111,11 @@ __global__ void compute_conditional_join_output_size(
 
   for (cudf::size_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
        outer_row_index += stride) {
-    bool found_match = false;
-    for (cudf::size_type inner_row_index = 0; inner_row_index < inner_num_rows; inner_row_index++) {
+    bool found_match          = false;
+    auto const candidates_end = candidates.end(outer_row_index, inner_num_rows);
+    for (auto candidate = candidates.begin(outer_row_index); candidate < candidates_end;
+         candidate++) {
+      auto const inner_row_index = candidates.inner_row_index(candidate);
       auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
       auto const right_row_index = swap_tables ? outer_row_index : inner_row_index;
@@ -131,6 +166,7 @@ __global__ void compute_conditional_join_output_size(
  * @param[in] max_size The maximum size of the output
  * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
  * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
+ * @param[in] candidates The inner rows that each outer row is compared to
  */
 template <cudf::size_type block_size, cudf::size_type output_cache_size, bool has_nulls>
 __global__ void conditional_join(table_device_view left_table,
@@ -141,7 +177,8 @@ __global__ void conditional_join(table_device_view left_table,
                                  cudf::size_type* current_idx,
                                  cudf::ast::detail::expression_device_view device_expression_data,
                                  cudf::size_type const max_size,
-                                 bool const swap_tables)
+                                 bool const swap_tables,
+                                 candidate_rows const candidates)
 {
   constexpr int num_warps = block_size / detail::warp_size;
   __shared__ cudf::size_type current_idx_shared[num_warps];
@@ -176,33 +213,50 @@ __global__ void conditional_join(table_device_view left_table,
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
 
+  // The output cache is flushed by the whole warp, so every lane iterates as often as the lane
+  // with the most candidates
+  cudf::size_type candidates_begin = 0;
+  cudf::size_type num_candidates   = 0;
+  if (outer_row_index < outer_num_rows) {
+    candidates_begin = candidates.begin(outer_row_index);
+    num_candidates   = candidates.end(outer_row_index, inner_num_rows) - candidates_begin;
+  }
+  auto max_num_candidates = num_candidates;
+  for (int offset = detail::warp_size / 2; offset > 0; offset /= 2) {
+    max_num_candidates =
+      max(max_num_candidates, __shfl_xor_sync(0xffff'ffffu, max_num_candidates, offset));
+  }
+
   if (outer_row_index < outer_num_rows) {
     bool found_match = false;
-    for (size_type inner_row_index(0); inner_row_index < inner_num_rows; ++inner_row_index) {
-      auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
-      auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
-      auto const right_row_index = swap_tables ? outer_row_index : inner_row_index;
-      evaluator.evaluate(
-        output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
+    for (size_type candidate(0); candidate < max_num_candidates; ++candidate) {
+      if (candidate < num_candidates) {
+        auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+        auto const inner_row_index = candidates.inner_row_index(candidates_begin + candidate);
+        auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
+        auto const right_row_index = swap_tables ? outer_row_index : inner_row_index;
+        evaluator.evaluate(
+          output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
 
-      if (output_dest.is_valid() && output_dest.value()) {
-        // If the rows are equal, then we have found a true match
-        // In the case of left anti joins we only add indices from left after
-        // the loop if we have found _no_ matches from the right.
-        // In the case of left semi joins we only add the first match (note
-        // that the current logic relies on the fact that we process all right
-        // table rows for a single left table row on a single thread so that no
-        // synchronization of found_match is required).
-        if ((join_type != join_kind::LEFT_ANTI_JOIN) &&
-            !(join_type == join_kind::LEFT_SEMI_JOIN && found_match)) {
-          add_pair_to_cache(left_row_index,
-                            right_row_index,
-                            current_idx_shared,
-                            warp_id,
-                            join_shared_l[warp_id],
-                            join_shared_r[warp_id]);
+        if (output_dest.is_valid() && output_dest.value()) {
+          // If the rows are equal, then we have found a true match
+          // In the case of left anti joins we only add indices from left after
+          // the loop if we have found _no_ matches from the right.
+          // In the case of left semi joins we only add the first match (note
+          // that the current logic relies on the fact that we process all right
+          // table rows for a single left table row on a single thread so that no
+          // synchronization of found_match is required).
+          if ((join_type != join_kind::LEFT_ANTI_JOIN) &&
+              !(join_type == join_kind::LEFT_SEMI_JOIN && found_match)) {
+            add_pair_to_cache(left_row_index,
+                              right_row_index,
+                              current_idx_shared,
+                              warp_id,
+                              join_shared_l[warp_id],
+                              join_shared_r[warp_id]);
+          }
+          found_match = true;
         }
-        found_match = true;
       }
 
       __syncwarp(activemask);
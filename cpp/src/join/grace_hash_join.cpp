@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Host copies of packed tables, held in pinned host memory or in a scratch file.
+ */
+class spill_store {
+ public:
+  /**
+   * @brief Constructor that creates a scratch file in `directory`, unless it is empty.
+   *
+   * The scratch file is unlinked at once, so it is removed when the store is destroyed.
+   */
+  explicit spill_store(std::string const& directory)
+  {
+    if (directory.empty()) { return; }
+    auto path = directory + "/cudf_grace_hash_join.XXXXXX";
+    _fd       = mkstemp(path.data());
+    CUDF_EXPECTS(_fd != -1, "Cannot create a scratch file in " + directory);
+    unlink(path.c_str());
+  }
+
+  spill_store(spill_store const&) = delete;
+  spill_store& operator=(spill_store const&) = delete;
+
+  ~spill_store()
+  {
+    for (std::size_t id = 0; id < _chunks.size(); ++id) {
+      release(id);
+    }
+    if (_fd != -1) { close(_fd); }
+  }
+
+  /**
+   * @brief Copies a packed table to the host.
+   *
+   * @return The id of the spilled chunk
+   */
+  std::size_t spill(packed_columns&& packed, rmm::cuda_stream_view stream)
+  {
+    chunk spilled;
+    spilled.metadata = std::move(packed.metadata_);
+    spilled.size     = packed.gpu_data->size();
+    if (spilled.size != 0) {
+      auto host_data = allocate(spilled.size);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        host_data, packed.gpu_data->data(), spilled.size, cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+      packed.gpu_data.reset();
+
+      if (_fd == -1) {
+        spilled.host_data = host_data;
+      } else {
+        spilled.file_offset = _file_size;
+        write_file(host_data, spilled.size, spilled.file_offset);
+        _file_size += spilled.size;
+        deallocate(host_data, spilled.size);
+      }
+    }
+    _chunks.push_back(std::move(spilled));
+    return _chunks.size() - 1;
+  }
+
+  /**
+   * @brief Copies a spilled chunk back to the device and releases its host copy.
+   */
+  packed_columns load(std::size_t id, rmm::cuda_stream_view stream)
+  {
+    auto& spilled = _chunks[id];
+    CUDF_EXPECTS(spilled.metadata != nullptr, "Spilled chunk was already loaded");
+    auto gpu_data = std::make_unique<rmm::device_buffer>(spilled.size, stream);
+    if (spilled.size != 0) {
+      auto const is_in_file = spilled.host_data == nullptr;
+      auto host_data        = is_in_file ? allocate(spilled.size) : spilled.host_data;
+      if (is_in_file) { read_file(host_data, spilled.size, spilled.file_offset); }
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        gpu_data->data(), host_data, spilled.size, cudaMemcpyHostToDevice, stream.value()));
+      stream.synchronize();
+      deallocate(host_data, spilled.size);
+      spilled.host_data = nullptr;
+    }
+    return packed_columns(std::move(spilled.metadata), std::move(gpu_data));
+  }
+
+  /**
+   * @brief Releases the host copy of a spilled chunk that is not loaded.
+   */
+  void release(std::size_t id)
+  {
+    auto& spilled = _chunks[id];
+    if (spilled.host_data != nullptr) { deallocate(spilled.host_data, spilled.size); }
+    spilled.host_data = nullptr;
+    spilled.metadata.reset();
+  }
+
+  /**
+   * @brief Returns the size in bytes of the device data of a spilled chunk.
+   */
+  [[nodiscard]] std::size_t size(std::size_t id) const { return _chunks[id].size; }
+
+ private:
+  struct chunk {
+    std::unique_ptr<packed_columns::metadata> metadata;
+    std::size_t size        = 0;
+    void* host_data         = nullptr;  // null if the chunk is in the scratch file
+    std::size_t file_offset = 0;
+  };
+
+  static void* allocate(std::size_t size)
+  {
+    return cudf::io::get_host_memory_resource()->allocate(size);
+  }
+
+  static void deallocate(void* host_data, std::size_t size)
+  {
+    cudf::io::get_host_memory_resource()->deallocate(host_data, size);
+  }
+
+  void write_file(void const* host_data, std::size_t size, std::size_t offset) const
+  {
+    auto const data = static_cast<char const*>(host_data);
+    for (std::size_t written = 0; written < size;) {
+      auto const result = pwrite(_fd, data + written, size - written, offset + written);
+      if (result == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(result > 0,
+                   std::string{"Cannot write to the scratch file: "} + std::strerror(errno));
+      written += result;
+    }
+  }
+
+  void read_file(void* host_data, std::size_t size, std::size_t offset) const
+  {
+    auto const data = static_cast<char*>(host_data);
+    for (std::size_t read = 0; read < size;) {
+      auto const result = pread(_fd, data + read, size - read, offset + read);
+      if (result == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(result > 0,
+                   std::string{"Cannot read from the scratch file: "} + std::strerror(errno));
+      read += result;
+    }
+  }
+
+  int _fd                = -1;
+  std::size_t _file_size = 0;
+  std::vector<chunk> _chunks;
+};
+
+/**
+ * @brief The spilled chunks of a partition of one table.
+ */
+struct spilled_partition {
+  std::vector<std::size_t> chunks;  ///< ids of the spilled chunks
+  std::size_t num_rows = 0;         ///< number of rows of all the chunks
+  std::size_t bytes    = 0;         ///< size of the device data of all the chunks
+};
+
+/**
+ * @brief A partition of the left table and the partition of the right table with the same keys.
+ */
+struct partition_pair {
+  spilled_partition left;
+  spilled_partition right;
+  int depth = 0;  ///< number of times the partition pair was partitioned again
+};
+
+/**
+ * @brief A partition copied back to the device.
+ */
+struct loaded_partition {
+  std::vector<packed_columns> packed;   ///< device data of the chunks
+  std::unique_ptr<table> concatenated;  ///< concatenation of the chunks, if more than one
+  table_view view;                      ///< the rows of the partition
+};
+
+}  // namespace
+
+/**
+ * @brief Implementation of `cudf::grace_hash_join`.
+ */
+class grace_hash_join_impl {
+ public:
+  grace_hash_join_impl(std::vector<size_type> left_on,
+                       std::vector<size_type> right_on,
+                       grace_hash_join::join_kind kind,
+                       grace_hash_join_options const& options)
+    : _left_on{std::move(left_on)},
+      _right_on{std::move(right_on)},
+      _kind{kind},
+      _options{options},
+      _store{options.spill_directory}
+  {
+    CUDF_EXPECTS(not _left_on.empty(), "Grace hash join requires join keys");
+    CUDF_EXPECTS(_left_on.size() == _right_on.size(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(_options.num_partitions > 1, "Grace hash join requires at least 2 partitions");
+    _pending.resize(_options.num_partitions);
+  }
+
+  void append(cudf::table_view const& input, bool is_left, rmm::cuda_stream_view stream)
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(not _is_joining, "Tables cannot be appended once the join started");
+    auto& schema = is_left ? _left_schema : _right_schema;
+    if (schema == nullptr) {
+      schema = cudf::empty_like(input);
+    } else {
+      CUDF_EXPECTS(std::equal(schema->view().begin(),
+                              schema->view().end(),
+                              input.begin(),
+                              input.end(),
+                              [](auto const& lhs, auto const& rhs) {
+                                return lhs.type() == rhs.type();
+                              }),
+                   "Mismatch in the column types of the appended tables");
+    }
+
+    auto sides = std::vector<spilled_partition*>{};
+    for (auto& pair : _pending) {
+      sides.push_back(is_left ? &pair.left : &pair.right);
+    }
+    spill_partitions(input, is_left, 0, sides, stream);
+  }
+
+  std::unique_ptr<cudf::table> next(rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(_left_schema != nullptr and _right_schema != nullptr,
+                 "Both tables must be appended before joining");
+    _is_joining = true;
+
+    while (not _pending.empty()) {
+      auto pair = std::move(_pending.back());
+      _pending.pop_back();
+
+      auto const has_output = [&] {
+        switch (_kind) {
+          case grace_hash_join::join_kind::INNER:
+            return pair.left.num_rows != 0 and pair.right.num_rows != 0;
+          case grace_hash_join::join_kind::LEFT: return pair.left.num_rows != 0;
+          default: return pair.left.num_rows != 0 or pair.right.num_rows != 0;
+        }
+      }();
+      if (not has_output) {
+        release(pair.left);
+        release(pair.right);
+        continue;
+      }
+
+      if (std::max(pair.left.bytes, pair.right.bytes) > _options.max_partition_bytes and
+          pair.depth < _options.max_depth) {
+        repartition(std::move(pair), stream);
+        continue;
+      }
+      return join(pair, stream, mr);
+    }
+    return nullptr;
+  }
+
+ private:
+  /**
+   * @brief Hash partitions `input` and spills each non-empty partition into `sides`.
+   */
+  void spill_partitions(cudf::table_view const& input,
+                        bool is_left,
+                        int depth,
+                        std::vector<spilled_partition*> const& sides,
+                        rmm::cuda_stream_view stream)
+  {
+    if (input.num_rows() == 0) { return; }
+    // Every level uses another seed, so that partitioning again splits a partition
+    auto const seed = static_cast<uint32_t>(DEFAULT_HASH_SEED + depth + 1);
+
+    auto [partitioned, offsets] = cudf::hash_partition(input,
+                                                       is_left ? _left_on : _right_on,
+                                                       static_cast<int>(sides.size()),
+                                                       hash_id::HASH_MURMUR3,
+                                                       seed,
+                                                       stream);
+    auto splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+    auto packed = cudf::detail::contiguous_split(partitioned->view(), splits, stream);
+    partitioned.reset();
+
+    for (std::size_t i = 0; i < packed.size(); ++i) {
+      auto const num_rows = packed[i].table.num_rows();
+      if (num_rows == 0) { continue; }
+      auto& side    = *sides[i];
+      auto const id = _store.spill(std::move(packed[i].data), stream);
+      side.chunks.push_back(id);
+      side.num_rows += num_rows;
+      side.bytes += _store.size(id);
+    }
+  }
+
+  /**
+   * @brief Partitions both partitions of a pair again, one chunk at a time.
+   */
+  void repartition(partition_pair pair, rmm::cuda_stream_view stream)
+  {
+    CUDF_FUNC_RANGE();
+    auto sub_pairs = std::vector<partition_pair>(_options.num_partitions);
+    for (auto& sub_pair : sub_pairs) {
+      sub_pair.depth = pair.depth + 1;
+    }
+    for (bool const is_left : {true, false}) {
+      auto sides = std::vector<spilled_partition*>{};
+      for (auto& sub_pair : sub_pairs) {
+        sides.push_back(is_left ? &sub_pair.left : &sub_pair.right);
+      }
+      for (auto const id : (is_left ? pair.left : pair.right).chunks) {
+        auto const packed = _store.load(id, stream);
+        spill_partitions(cudf::unpack(packed), is_left, pair.depth + 1, sides, stream);
+      }
+    }
+
+    for (auto& sub_pair : sub_pairs) {
+      // The rows of a single key stay together, and cannot be split by partitioning again
+      if (sub_pair.left.num_rows == pair.left.num_rows and
+          sub_pair.right.num_rows == pair.right.num_rows) {
+        sub_pair.depth = _options.max_depth;
+      }
+      _pending.push_back(std::move(sub_pair));
+    }
+  }
+
+  /**
+   * @brief Copies the chunks of a partition back to the device.
+   */
+  loaded_partition load(spilled_partition const& part,
+                        table const& schema,
+                        rmm::cuda_stream_view stream)
+  {
+    loaded_partition loaded;
+    std::vector<table_view> views;
+    for (auto const id : part.chunks) {
+      loaded.packed.push_back(_store.load(id, stream));
+      views.push_back(cudf::unpack(loaded.packed.back()));
+    }
+    if (views.empty()) {
+      loaded.view = schema.view();
+    } else if (views.size() == 1) {
+      loaded.view = views.front();
+    } else {
+      loaded.concatenated = cudf::detail::concatenate(views, stream);
+      loaded.view         = loaded.concatenated->view();
+      loaded.packed.clear();
+    }
+    return loaded;
+  }
+
+  void release(spilled_partition const& part)
+  {
+    for (auto const id : part.chunks) {
+      _store.release(id);
+    }
+  }
+
+  /**
+   * @brief Joins a pair of partitions.
+   */
+  std::unique_ptr<cudf::table> join(partition_pair const& pair,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_FUNC_RANGE();
+    auto const left  = load(pair.left, *_left_schema, stream);
+    auto const right = load(pair.right, *_right_schema, stream);
+
+    cudf::hash_join hj_obj(right.view.select(_right_on), _options.compare_nulls, stream);
+    auto const probe = left.view.select(_left_on);
+
+    auto const [left_map, right_map] = [&] {
+      switch (_kind) {
+        case grace_hash_join::join_kind::INNER: return hj_obj.inner_join(probe, {}, stream);
+        case grace_hash_join::join_kind::LEFT: return hj_obj.left_join(probe, {}, stream);
+        default: return hj_obj.full_join(probe, {}, stream);
+      }
+    }();
+
+    // Rows without a match are gathered as nulls
+    auto const bounds_policy = _kind == grace_hash_join::join_kind::INNER
+                                 ? out_of_bounds_policy::DONT_CHECK
+                                 : out_of_bounds_policy::NULLIFY;
+    auto left_result  = cudf::detail::gather(left.view,
+                                             device_span<size_type const>(*left_map),
+                                             bounds_policy,
+                                             negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             mr);
+    auto right_result = cudf::detail::gather(right.view,
+                                             device_span<size_type const>(*right_map),
+                                             bounds_policy,
+                                             negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             mr);
+
+    auto columns       = left_result->release();
+    auto right_columns = right_result->release();
+    std::move(right_columns.begin(), right_columns.end(), std::back_inserter(columns));
+    return std::make_unique<cudf::table>(std::move(columns));
+  }
+
+  std::vector<size_type> const _left_on;
+  std::vector<size_type> const _right_on;
+  grace_hash_join::join_kind const _kind;
+  grace_hash_join_options const _options;
+  spill_store _store;
+  std::unique_ptr<table> _left_schema;   ///< empty table with the columns of the left table
+  std::unique_ptr<table> _right_schema;  ///< empty table with the columns of the right table
+  std::vector<partition_pair> _pending;  ///< partition pairs left to join
+  bool _is_joining = false;
+};
+
+}  // namespace detail
+
+grace_hash_join::~grace_hash_join() = default;
+
+grace_hash_join::grace_hash_join(std::vector<size_type> left_on,
+                                 std::vector<size_type> right_on,
+                                 join_kind kind,
+                                 grace_hash_join_options const& options)
+  : _impl{std::make_unique<detail::grace_hash_join_impl>(
+      std::move(left_on), std::move(right_on), kind, options)}
+{
+}
+
+void grace_hash_join::append_left(cudf::table_view const& left, rmm::cuda_stream_view stream)
+{
+  _impl->append(left, true, stream);
+}
+
+void grace_hash_join::append_right(cudf::table_view const& right, rmm::cuda_stream_view stream)
+{
+  _impl->append(right, false, stream);
+}
+
+std::unique_ptr<cudf::table> grace_hash_join::next(rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  return _impl->next(stream, mr);
+}
+
+}  // namespace cudf
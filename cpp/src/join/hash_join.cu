@@ -27,22 +27,33 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cooperative_groups.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/tuple.h>
 #include <thrust/uninitialized_fill.h>
 
 #include <cstddef>
 #include <iostream>
+#include <limits>
 #include <numeric>
 
 namespace cudf {
 namespace detail {
 namespace {
+namespace cg = cooperative_groups;
+
 /**
  * @brief Calculates the exact size of the join output produced when
  * joining two tables together.
@@ -277,8 +288,125 @@ std::size_t get_full_join_size(cudf::table_device_view build_table,
   }
   return join_size + left_join_complement_size;
 }
+
+/**
+ * @brief Counts the output pairs of each row of a probe table, one cooperative group per row.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam is_outer Whether a probe row without a match yields one pair, as in a left join
+ *
+ * @param hash_table_view Device view of the hash table built from the build table
+ * @param probe_pairs The {hash value, row index} pair of each probe row
+ * @param num_rows The number of probe rows
+ * @param equality The comparator of a probe pair and a build pair
+ * @param matches_per_row The zero-initialized number of pairs of each probe row
+ */
+template <int block_size, bool is_outer, typename ProbeIterator, typename Equality>
+__launch_bounds__(block_size) __global__
+  void compute_matches_per_row(cudf::detail::multimap_type::device_view hash_table_view,
+                               ProbeIterator probe_pairs,
+                               cudf::size_type num_rows,
+                               Equality equality,
+                               cudf::size_type* matches_per_row)
+{
+  auto const tile   = cg::tiled_partition<DEFAULT_JOIN_CG_SIZE>(cg::this_thread_block());
+  auto const stride = block_size * gridDim.x / DEFAULT_JOIN_CG_SIZE;
+
+  for (cudf::size_type row = (threadIdx.x + blockIdx.x * block_size) / DEFAULT_JOIN_CG_SIZE;
+       row < num_rows;
+       row += stride) {
+    // every thread of the group counts the pairs found in its slots
+    std::size_t count;
+    if constexpr (is_outer) {
+      count = hash_table_view.pair_count_outer(tile, *(probe_pairs + row), equality);
+    } else {
+      count = hash_table_view.pair_count(tile, *(probe_pairs + row), equality);
+    }
+    if (count > 0) { atomicAdd(matches_per_row + row, static_cast<cudf::size_type>(count)); }
+  }
+}
+
+/**
+ * @brief Probes the `hash_table` built from `build_table` for the rows `[row_begin, row_end)` of
+ * `probe_table`, and returns their `output_size` output indices.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param probe_table Table of probe side columns to join.
+ * @param hash_table Hash table built from `build_table`.
+ * @param has_nulls Whether either table has nulls.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param is_outer Whether a probe row without a match yields one pair, as in a left join.
+ * @param row_begin First probe row to retrieve the pairs of.
+ * @param row_end Probe row following the last row to retrieve the pairs of.
+ * @param output_size The exact number of pairs of the probe rows.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned vectors.
+ *
+ * @return Join output indices vector pair.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+probe_join_hash_table_rows(cudf::table_device_view build_table,
+                           cudf::table_device_view probe_table,
+                           cudf::detail::multimap_type const& hash_table,
+                           bool has_nulls,
+                           null_equality compare_nulls,
+                           bool is_outer,
+                           size_type row_begin,
+                           size_type row_end,
+                           std::size_t output_size,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  if (output_size == 0) { return std::pair(std::move(left_indices), std::move(right_indices)); }
+
+  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
+  pair_equality equality{probe_table, build_table, probe_nulls, compare_nulls};
+
+  row_hash hash_probe{probe_nulls, probe_table};
+  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
+  make_pair_function pair_func{hash_probe, empty_key_sentinel};
+
+  auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
+
+  auto out1_zip_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
+  auto out2_zip_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
+
+  if (is_outer) {
+    hash_table.pair_retrieve_outer(
+      iter + row_begin, iter + row_end, out1_zip_begin, out2_zip_begin, equality, stream.value());
+  } else {
+    hash_table.pair_retrieve(
+      iter + row_begin, iter + row_end, out1_zip_begin, out2_zip_begin, equality, stream.value());
+  }
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
 }  // namespace
 
+join_cursor_state::join_cursor_state(join_kind kind,
+                                     cudf::table_view const& probe_table,
+                                     rmm::cuda_stream_view stream)
+  : kind{kind},
+    flattened_probe{structs::detail::flatten_nested_columns(
+      probe_table, {}, {}, structs::detail::column_nullability::FORCE)},
+    probe{flattened_probe.flattened_columns()},
+    match_offsets{static_cast<std::size_t>(probe_table.num_rows()), stream},
+    build_matched{0, stream},
+    pending_left{0, stream},
+    pending_right{0, stream}
+{
+}
+
+bool join_cursor_state::done() const
+{
+  return probe_row == probe.num_rows() and pending_position == pending_left.size() and
+         (kind != join_kind::FULL_JOIN or is_complement_queued);
+}
+
 template <typename Hasher>
 hash_join<Hasher>::hash_join(cudf::table_view const& build,
                              cudf::null_equality compare_nulls,
@@ -424,6 +552,224 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
     mr);
 }
 
+template <typename Hasher>
+std::unique_ptr<join_cursor_state> hash_join<Hasher>::make_cursor(
+  join_kind kind, cudf::table_view const& probe, rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(kind == join_kind::INNER_JOIN or kind == join_kind::LEFT_JOIN or
+                 kind == join_kind::FULL_JOIN,
+               "Unsupported join type");
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Probe column size is too big for hash join");
+
+  auto cursor                       = std::make_unique<join_cursor_state>(kind, probe, stream);
+  auto const& flattened_probe_table = cursor->probe;
+  auto const num_rows               = flattened_probe_table.num_rows();
+
+  CUDF_EXPECTS(_build.num_columns() == flattened_probe_table.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  if (is_trivial_join(flattened_probe_table, _build, kind)) {
+    cursor->probe_row            = num_rows;
+    cursor->is_complement_queued = true;
+    return cursor;
+  }
+
+  CUDF_EXPECTS(std::equal(std::cbegin(_build),
+                          std::cend(_build),
+                          std::cbegin(flattened_probe_table),
+                          std::cend(flattened_probe_table),
+                          [](const auto& b, const auto& p) { return b.type() == p.type(); }),
+               "Mismatch in joining column data types");
+
+  if (kind == join_kind::FULL_JOIN) {
+    cursor->build_matched.resize(_build.num_rows(), stream);
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               cursor->build_matched.begin(),
+                               cursor->build_matched.end(),
+                               false);
+  }
+
+  // Trivial left join case - every probe row yields one pair
+  if (_is_empty) {
+    thrust::sequence(rmm::exec_policy(stream),
+                     cursor->match_offsets.begin(),
+                     cursor->match_offsets.end(),
+                     std::size_t{1});
+    return cursor;
+  }
+
+  rmm::device_uvector<size_type> matches_per_row(num_rows, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), matches_per_row.begin(), matches_per_row.end(), 0);
+
+  if (num_rows > 0) {
+    auto build_table_ptr = cudf::table_device_view::create(_build, stream);
+    auto probe_table_ptr = cudf::table_device_view::create(flattened_probe_table, stream);
+
+    auto const probe_nulls =
+      cudf::nullate::DYNAMIC{cudf::has_nulls(flattened_probe_table) | cudf::has_nulls(_build)};
+    pair_equality equality{*probe_table_ptr, *build_table_ptr, probe_nulls, _nulls_equal};
+
+    row_hash hash_probe{probe_nulls, *probe_table_ptr};
+    auto const empty_key_sentinel = _hash_table.get_empty_key_sentinel();
+    make_pair_function pair_func{hash_probe, empty_key_sentinel};
+
+    auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
+
+    detail::grid_1d const config(num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+    if (kind == join_kind::INNER_JOIN) {
+      compute_matches_per_row<DEFAULT_JOIN_BLOCK_SIZE, false>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+          _hash_table.get_device_view(), iter, num_rows, equality, matches_per_row.data());
+    } else {
+      compute_matches_per_row<DEFAULT_JOIN_BLOCK_SIZE, true>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+          _hash_table.get_device_view(), iter, num_rows, equality, matches_per_row.data());
+    }
+  }
+
+  auto const count_begin = thrust::make_transform_iterator(
+    matches_per_row.begin(), [] __device__(size_type count) { return std::size_t(count); });
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         count_begin,
+                         count_begin + num_rows,
+                         cursor->match_offsets.begin());
+  return cursor;
+}
+
+template <typename Hasher>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join<Hasher>::probe_page(join_cursor_state& cursor,
+                              std::size_t max_pairs,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(max_pairs > 0, "A join page must hold at least one pair");
+
+  auto const num_rows = cursor.probe.num_rows();
+  auto const is_outer = cursor.kind != join_kind::INNER_JOIN;
+
+  // Pairs of a probe row too large for one page, or the unmatched build rows of a full join
+  if (cursor.pending_position < cursor.pending_left.size()) {
+    auto const begin   = cursor.pending_position;
+    auto const size    = std::min(max_pairs, cursor.pending_left.size() - begin);
+    auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(size, stream, mr);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(size, stream, mr);
+    thrust::copy(rmm::exec_policy(stream),
+                 cursor.pending_left.begin() + begin,
+                 cursor.pending_left.begin() + begin + size,
+                 left_indices->begin());
+    thrust::copy(rmm::exec_policy(stream),
+                 cursor.pending_right.begin() + begin,
+                 cursor.pending_right.begin() + begin + size,
+                 right_indices->begin());
+
+    cursor.pending_position += size;
+    if (cursor.pending_position == cursor.pending_left.size()) {
+      // Release the pending pairs
+      cursor.pending_left     = rmm::device_uvector<size_type>(0, stream);
+      cursor.pending_right    = rmm::device_uvector<size_type>(0, stream);
+      cursor.pending_position = 0;
+    }
+    return std::pair(std::move(left_indices), std::move(right_indices));
+  }
+
+  if (cursor.probe_row == num_rows) {
+    if (cursor.kind == join_kind::FULL_JOIN and not cursor.is_complement_queued) {
+      // The build rows matched by no page are returned last
+      auto& build_matched  = cursor.build_matched;
+      cursor.pending_right = rmm::device_uvector<size_type>(build_matched.size(), stream);
+      auto const complement_end =
+        thrust::copy_if(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(build_matched.size()),
+                        build_matched.begin(),
+                        cursor.pending_right.begin(),
+                        thrust::logical_not<bool>());
+      cursor.pending_right.resize(complement_end - cursor.pending_right.begin(), stream);
+      cursor.pending_left = rmm::device_uvector<size_type>(cursor.pending_right.size(), stream);
+      thrust::uninitialized_fill(rmm::exec_policy(stream),
+                                 cursor.pending_left.begin(),
+                                 cursor.pending_left.end(),
+                                 JoinNoneValue);
+      build_matched               = rmm::device_uvector<bool>(0, stream);
+      cursor.is_complement_queued = true;
+      return probe_page(cursor, max_pairs, stream, mr);
+    }
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // The page holds all the pairs of the probe rows [row_begin, row_end)
+  auto const& match_offsets = cursor.match_offsets;
+  auto const row_begin      = cursor.probe_row;
+  auto const page_begin     = row_begin == 0 ? 0 : match_offsets.element(row_begin - 1, stream);
+  auto const page_limit     = std::numeric_limits<std::size_t>::max() - page_begin < max_pairs
+                                ? std::numeric_limits<std::size_t>::max()
+                                : page_begin + max_pairs;
+
+  auto const offsets_end = thrust::upper_bound(
+    rmm::exec_policy(stream), match_offsets.begin() + row_begin, match_offsets.end(), page_limit);
+  auto const row_end     = static_cast<size_type>(offsets_end - match_offsets.begin());
+
+  // A probe row with more pairs than fit in a page is retrieved once and returned over several
+  auto const is_split  = row_end == row_begin;
+  auto const rows_end  = is_split ? row_begin + 1 : row_end;
+  auto const page_size = match_offsets.element(rows_end - 1, stream) - page_begin;
+  auto const page_mr   = is_split ? rmm::mr::get_current_device_resource() : mr;
+
+  auto join_indices = [&] {
+    if (_is_empty) {
+      auto left_indices =
+        std::make_unique<rmm::device_uvector<size_type>>(page_size, stream, page_mr);
+      thrust::sequence(
+        rmm::exec_policy(stream), left_indices->begin(), left_indices->end(), row_begin);
+      auto right_indices =
+        std::make_unique<rmm::device_uvector<size_type>>(page_size, stream, page_mr);
+      thrust::uninitialized_fill(
+        rmm::exec_policy(stream), right_indices->begin(), right_indices->end(), JoinNoneValue);
+      return std::pair(std::move(left_indices), std::move(right_indices));
+    }
+    auto build_table_ptr = cudf::table_device_view::create(_build, stream);
+    auto probe_table_ptr = cudf::table_device_view::create(cursor.probe, stream);
+    return probe_join_hash_table_rows(*build_table_ptr,
+                                      *probe_table_ptr,
+                                      _hash_table,
+                                      cudf::has_nulls(cursor.probe) | cudf::has_nulls(_build),
+                                      _nulls_equal,
+                                      is_outer,
+                                      row_begin,
+                                      rows_end,
+                                      page_size,
+                                      stream,
+                                      page_mr);
+  }();
+  cursor.probe_row = rows_end;
+
+  if (cursor.kind == join_kind::FULL_JOIN) {
+    auto const& right_indices = join_indices.second;
+    thrust::scatter_if(rmm::exec_policy(stream),
+                       thrust::make_constant_iterator(true),
+                       thrust::make_constant_iterator(true) + right_indices->size(),
+                       right_indices->begin(),  // Index locations
+                       right_indices->begin(),  // Stencil - Check if index location is valid
+                       cursor.build_matched.begin(),
+                       valid_range<size_type>{0, _build.num_rows()});
+  }
+
+  if (is_split) {
+    cursor.pending_left  = std::move(*join_indices.first);
+    cursor.pending_right = std::move(*join_indices.second);
+    return probe_page(cursor, max_pairs, stream, mr);
+  }
+  return join_indices;
+}
+
 template <typename Hasher>
 template <cudf::detail::join_kind JoinKind>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -555,4 +901,44 @@ std::size_t hash_join::full_join_size(cudf::table_view const& probe,
   return _impl->full_join_size(probe, stream, mr);
 }
 
+std::unique_ptr<join_cursor> hash_join::inner_join_cursor(cudf::table_view const& probe,
+                                                          rmm::cuda_stream_view stream) const
+{
+  return std::unique_ptr<join_cursor>(new join_cursor(
+    *_impl, _impl->make_cursor(cudf::detail::join_kind::INNER_JOIN, probe, stream)));
+}
+
+std::unique_ptr<join_cursor> hash_join::left_join_cursor(cudf::table_view const& probe,
+                                                         rmm::cuda_stream_view stream) const
+{
+  return std::unique_ptr<join_cursor>(new join_cursor(
+    *_impl, _impl->make_cursor(cudf::detail::join_kind::LEFT_JOIN, probe, stream)));
+}
+
+std::unique_ptr<join_cursor> hash_join::full_join_cursor(cudf::table_view const& probe,
+                                                         rmm::cuda_stream_view stream) const
+{
+  return std::unique_ptr<join_cursor>(new join_cursor(
+    *_impl, _impl->make_cursor(cudf::detail::join_kind::FULL_JOIN, probe, stream)));
+}
+
+join_cursor::join_cursor(hash_join::impl_type const& join,
+                         std::unique_ptr<detail::join_cursor_state> state)
+  : _join{join}, _state{std::move(state)}
+{
+}
+
+join_cursor::~join_cursor() = default;
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+join_cursor::next(std::size_t max_pairs,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+{
+  return _join.probe_page(*_state, max_pairs, stream, mr);
+}
+
+bool join_cursor::done() const { return _state->done(); }
+
 }  // namespace cudf
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The ranges of right rows matching the left rows of a sorted join.
+ */
+struct match_ranges {
+  std::unique_ptr<column> first;          ///< First matching right row of each left row
+  rmm::device_uvector<size_type> counts;  ///< Number of matching right rows of each left row
+};
+
+/**
+ * @brief Finds the range of matching rows in the sorted right keys of every sorted left row.
+ *
+ * The lower and upper bounds of a left row in the right keys delimit the right rows comparing
+ * equal to it, so no hash table is built.
+ */
+match_ranges find_match_ranges(table_view const& left_keys,
+                               table_view const& right_keys,
+                               std::vector<order> const& column_order,
+                               std::vector<null_order> const& null_precedence,
+                               null_equality compare_nulls,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  auto const mr = rmm::mr::get_current_device_resource();
+
+  auto lower =
+    detail::lower_bound(right_keys, left_keys, column_order, null_precedence, stream, mr);
+  auto upper =
+    detail::upper_bound(right_keys, left_keys, column_order, null_precedence, stream, mr);
+
+  // The sort order compares nulls as equal, so a left row with a null key is dropped here when
+  // nulls are unequal
+  auto const skip_nulls = compare_nulls == null_equality::UNEQUAL and has_nulls(left_keys);
+  auto const row_bitmask =
+    skip_nulls ? cudf::detail::bitmask_and(left_keys, stream).first : rmm::device_buffer{0, stream};
+
+  rmm::device_uvector<size_type> counts(left_keys.num_rows(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(left_keys.num_rows()),
+    counts.begin(),
+    [lower       = lower->view().data<size_type>(),
+     upper       = upper->view().data<size_type>(),
+     row_bitmask = skip_nulls ? static_cast<bitmask_type const*>(row_bitmask.data())
+                              : nullptr] __device__(size_type row) -> size_type {
+      if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return 0; }
+      return upper[row] - lower[row];
+    });
+  return match_ranges{std::move(lower), std::move(counts)};
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_join(join_kind kind,
+            table_view const& left_keys,
+            table_view const& right_keys,
+            std::vector<order> const& column_order,
+            std::vector<null_order> const& null_precedence,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream,
+            rmm::mr::device_memory_resource* mr)
+{
+  auto const ranges = find_match_ranges(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, stream);
+
+  // Inclusive offsets of the output pairs of each left row; an unmatched row of a left join
+  // still has one pair
+  auto const is_left_join = kind == join_kind::LEFT_JOIN;
+  auto const pair_counts  = thrust::make_transform_iterator(
+    ranges.counts.begin(), [is_left_join] __device__(size_type count) -> std::size_t {
+      return (is_left_join and count == 0) ? 1 : count;
+    });
+  rmm::device_uvector<std::size_t> offsets(left_keys.num_rows(), stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), pair_counts, pair_counts + left_keys.num_rows(), offsets.begin());
+  auto const join_size = offsets.is_empty() ? std::size_t{0} : offsets.back_element(stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  // The left row of every output pair is the first row whose offsets end past it, and its pairs
+  // are written in the order of the right rows
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      offsets.begin(),
+                      offsets.end(),
+                      thrust::counting_iterator<std::size_t>(0),
+                      thrust::counting_iterator<std::size_t>(join_size),
+                      left_indices->begin());
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<std::size_t>(0),
+    thrust::counting_iterator<std::size_t>(join_size),
+    left_indices->begin(),
+    right_indices->begin(),
+    [offsets = offsets.data(),
+     first   = ranges.first->view().data<size_type>(),
+     counts  = ranges.counts.data()] __device__(std::size_t pair, size_type row) -> size_type {
+      if (counts[row] == 0) { return JoinNoneValue; }
+      auto const row_offset = row == 0 ? std::size_t{0} : offsets[row - 1];
+      return first[row] + static_cast<size_type>(pair - row_offset);
+    });
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> sorted_left_semi_anti_join(
+  join_kind kind,
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const ranges = find_match_ranges(
+    left_keys, right_keys, column_order, null_precedence, compare_nulls, stream);
+
+  auto const left_num_rows = left_keys.num_rows();
+  auto gather_map =
+    std::make_unique<rmm::device_uvector<size_type>>(left_num_rows, stream, mr);
+
+  // gather_map_end will be the end of valid data in gather_map
+  auto gather_map_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(left_num_rows),
+                    gather_map->begin(),
+                    [kind, counts = ranges.counts.data()] __device__(size_type row) {
+                      return (counts[row] > 0) == (kind == join_kind::LEFT_SEMI_JOIN);
+                    });
+
+  gather_map->resize(thrust::distance(gather_map->begin(), gather_map_end), stream);
+  return gather_map;
+}
+
+}  // namespace
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_inner_join(table_view const& left_keys,
+                  table_view const& right_keys,
+                  std::vector<order> const& column_order,
+                  std::vector<null_order> const& null_precedence,
+                  null_equality compare_nulls,
+                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join(detail::join_kind::INNER_JOIN,
+                             left_keys,
+                             right_keys,
+                             column_order,
+                             null_precedence,
+                             compare_nulls,
+                             cudf::default_stream_value,
+                             mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_left_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 std::vector<order> const& column_order,
+                 std::vector<null_order> const& null_precedence,
+                 null_equality compare_nulls,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_join(detail::join_kind::LEFT_JOIN,
+                             left_keys,
+                             right_keys,
+                             column_order,
+                             null_precedence,
+                             compare_nulls,
+                             cudf::default_stream_value,
+                             mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> sorted_left_semi_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_left_semi_anti_join(detail::join_kind::LEFT_SEMI_JOIN,
+                                            left_keys,
+                                            right_keys,
+                                            column_order,
+                                            null_precedence,
+                                            compare_nulls,
+                                            cudf::default_stream_value,
+                                            mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> sorted_left_anti_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_left_semi_anti_join(detail::join_kind::LEFT_ANTI_JOIN,
+                                            left_keys,
+                                            right_keys,
+                                            column_order,
+                                            null_precedence,
+                                            compare_nulls,
+                                            cudf::default_stream_value,
+                                            mr);
+}
+
+}  // namespace cudf
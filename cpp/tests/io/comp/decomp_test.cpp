@@ -15,6 +15,7 @@
  */
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/host_codec.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/utilities/default_stream.hpp>
@@ -24,6 +25,8 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <numeric>
+#include <random>
 #include <vector>
 
 using cudf::device_span;
@@ -118,6 +121,22 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for LZ4 decompression on the host
+ */
+struct Lz4HostDecompressTest : public DecompressTest<Lz4HostDecompressTest> {
+  void dispatch(device_span<device_span<uint8_t const>> d_inf_in,
+                device_span<device_span<uint8_t>> d_inf_out,
+                device_span<cudf::io::compression_result> d_inf_stat)
+  {
+    cudf::io::host::batched_decompress(cudf::io::compression_type::LZ4,
+                                       d_inf_in,
+                                       d_inf_out,
+                                       d_inf_stat,
+                                       cudf::default_stream_value);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -166,4 +185,159 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(Lz4HostDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4HostDecompressTest, OverlappingMatch)
+{
+  constexpr char uncompressed[]  = "Aaaaaaaaaaaah!";
+  constexpr uint8_t compressed[] = {0x26, 'A', 'a', 0x1, 0x0, 0x20, 'h', '!'};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4HostDecompressTest, LongLiteral)
+{
+  constexpr char uncompressed[]  = "abcdefghijklmnopqrst";
+  constexpr uint8_t compressed[] = {0xf0, 5,   'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
+                                    'j',  'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't'};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+/**
+ * @brief Fixture for round trips through the batched host codecs
+ */
+struct HostCodecTest : public cudf::test::BaseFixture,
+                       public ::testing::WithParamInterface<cudf::io::compression_type> {
+  // Runs `codec` on a batch of device buffers; the outputs are sized by `output_sizes`
+  template <typename Codec>
+  std::vector<std::vector<uint8_t>> run(Codec codec,
+                                        std::vector<std::vector<uint8_t>> const& inputs,
+                                        std::vector<size_t> const& output_sizes)
+  {
+    auto stream           = cudf::default_stream_value;
+    auto const num_chunks = inputs.size();
+
+    std::vector<size_t> input_offsets(num_chunks + 1, 0);
+    std::vector<size_t> output_offsets(num_chunks + 1, 0);
+    for (size_t i = 0; i < num_chunks; ++i) {
+      input_offsets[i + 1]  = input_offsets[i] + inputs[i].size();
+      output_offsets[i + 1] = output_offsets[i] + output_sizes[i];
+    }
+    rmm::device_uvector<uint8_t> d_inputs(input_offsets.back(), stream);
+    rmm::device_uvector<uint8_t> d_outputs(output_offsets.back(), stream);
+
+    hostdevice_vector<device_span<uint8_t const>> in(num_chunks, stream);
+    hostdevice_vector<device_span<uint8_t>> out(num_chunks, stream);
+    hostdevice_vector<cudf::io::compression_result> res(num_chunks, stream);
+    for (size_t i = 0; i < num_chunks; ++i) {
+      cudaMemcpyAsync(d_inputs.data() + input_offsets[i],
+                      inputs[i].data(),
+                      inputs[i].size(),
+                      cudaMemcpyHostToDevice,
+                      stream.value());
+      in[i]  = {d_inputs.data() + input_offsets[i], inputs[i].size()};
+      out[i] = {d_outputs.data() + output_offsets[i], output_sizes[i]};
+    }
+    in.host_to_device(stream);
+    out.host_to_device(stream);
+
+    codec(GetParam(), in, out, res, stream);
+    res.device_to_host(stream, true);
+
+    std::vector<std::vector<uint8_t>> outputs(num_chunks);
+    for (size_t i = 0; i < num_chunks; ++i) {
+      EXPECT_EQ(res[i].status, cudf::io::compression_status::SUCCESS);
+      outputs[i].resize(res[i].bytes_written);
+      cudaMemcpyAsync(outputs[i].data(),
+                      d_outputs.data() + output_offsets[i],
+                      outputs[i].size(),
+                      cudaMemcpyDeviceToHost,
+                      stream.value());
+    }
+    stream.synchronize();
+    return outputs;
+  }
+};
+
+TEST_P(HostCodecTest, RoundTrip)
+{
+  // Runs of repeated bytes, mixed with random literals, in buffers of varied sizes
+  std::mt19937 engine{42};
+  std::vector<std::vector<uint8_t>> inputs;
+  for (size_t size : {0, 1, 12, 13, 100, 4096, 70000, 300000}) {
+    std::vector<uint8_t> input(size);
+    for (size_t i = 0; i < size; ++i) {
+      input[i] = (i / 7) % 3 == 0 ? engine() % 256 : 'a' + i % 11;
+    }
+    inputs.push_back(std::move(input));
+  }
+
+  auto const compression = GetParam();
+  std::vector<size_t> max_comp_sizes;
+  std::transform(inputs.begin(),
+                 inputs.end(),
+                 std::back_inserter(max_comp_sizes),
+                 [&](auto const& input) {
+                   return cudf::io::host::compress_max_output_chunk_size(compression,
+                                                                         input.size());
+                 });
+  auto const compressed = run(cudf::io::host::batched_compress, inputs, max_comp_sizes);
+
+  std::vector<size_t> sizes;
+  std::transform(inputs.begin(), inputs.end(), std::back_inserter(sizes), [](auto const& input) {
+    return input.size();
+  });
+  EXPECT_GT(std::accumulate(sizes.begin(), sizes.end(), size_t{0}),
+            std::accumulate(compressed.begin(),
+                            compressed.end(),
+                            size_t{0},
+                            [](size_t sum, auto const& output) { return sum + output.size(); }));
+
+  auto const decompressed = run(cudf::io::host::batched_decompress, compressed, sizes);
+  EXPECT_EQ(decompressed, inputs);
+}
+
+TEST_P(HostCodecTest, OutputOverflow)
+{
+  auto stream = cudf::default_stream_value;
+  rmm::device_uvector<uint8_t> d_input(1000, stream);
+  rmm::device_uvector<uint8_t> d_output(1, stream);
+  cudaMemsetAsync(d_input.data(), 0, d_input.size(), stream.value());
+
+  hostdevice_vector<device_span<uint8_t const>> in(1, stream);
+  hostdevice_vector<device_span<uint8_t>> out(1, stream);
+  hostdevice_vector<cudf::io::compression_result> res(1, stream);
+  in[0]  = d_input;
+  out[0] = d_output;
+  in.host_to_device(stream);
+  out.host_to_device(stream);
+
+  cudf::io::host::batched_compress(GetParam(), in, out, res, stream);
+  res.device_to_host(stream, true);
+  EXPECT_EQ(res[0].status, cudf::io::compression_status::OUTPUT_OVERFLOW);
+}
+
+INSTANTIATE_TEST_CASE_P(HostCodecs,
+                        HostCodecTest,
+                        ::testing::Values(cudf::io::compression_type::GZIP,
+                                          cudf::io::compression_type::ZLIB,
+                                          cudf::io::compression_type::LZ4));
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -16,10 +16,28 @@
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/file_utilities.hpp>
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/memory_resource.hpp>
 
 #include <src/io/utilities/file_io_utilities.hpp>
+#include <src/io/utilities/host_memory.hpp>
+#include <src/io/utilities/thread_pool.hpp>
+
+#include <rmm/mr/host/new_delete_resource.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 // Base test fixture for tests
 struct CuFileIOTest : public cudf::test::BaseFixture {
@@ -43,4 +61,273 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+struct DatasourceTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Datasource over a string that counts the host reads it serves; not thread-safe
+class counting_source : public cudf::io::datasource {
+ public:
+  explicit counting_source(std::string data) : _data(std::move(data)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    auto const begin = _data.begin() + offset;
+    return buffer::create(std::vector<char>(begin, begin + std::min(size, _data.size() - offset)));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    auto const read_size = std::min(size, _data.size() - offset);
+    std::copy_n(_data.begin() + offset, read_size, dst);
+    return read_size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+  int num_reads = 0;
+
+ private:
+  std::string _data;
+};
+
+std::string make_test_data(size_t size)
+{
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>('a' + i % 23);
+  }
+  return data;
+}
+
+void expect_ranges_read(std::string const& data,
+                        std::vector<cudf::io::datasource::range> const& ranges,
+                        std::vector<std::unique_ptr<cudf::io::datasource::buffer>> const& buffers)
+{
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffers[i]->data()), buffers[i]->size()),
+              data.substr(ranges[i].offset, ranges[i].size));
+  }
+}
+}  // namespace
+
+TEST_F(DatasourceTest, HostReadAsyncCoalescesRanges)
+{
+  auto const data = make_test_data(1000);
+  counting_source source(data);
+
+  // The last range extends past the end of the source
+  std::vector<cudf::io::datasource::range> const ranges{
+    {500, 10}, {0, 100}, {105, 5}, {990, 100}, {50, 20}};
+  auto const buffers = source.host_read_async(ranges, 10).get();
+  expect_ranges_read(data, ranges, buffers);
+  // [0, 100), [50, 70) and [105, 110) are read together, the other ranges separately
+  EXPECT_EQ(source.num_reads, 3);
+}
+
+TEST_F(DatasourceTest, HostReadAsyncParallel)
+{
+  auto const data   = make_test_data(1 << 20);
+  auto const source = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  ASSERT_TRUE(source->supports_concurrent_host_reads());
+
+  std::vector<cudf::io::datasource::range> ranges;
+  for (size_t offset = 0; offset < data.size(); offset += 10000) {
+    ranges.push_back({offset, 3000});
+  }
+  expect_ranges_read(data, ranges, source->host_read_async(ranges, 0).get());
+}
+
+struct ThreadPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ThreadPoolTest, HighPriorityFirst)
+{
+  cudf::detail::thread_pool pool(1);
+  std::promise<void> release;
+  // Keep the only worker busy until all tasks are queued
+  pool.push_task([started = release.get_future().share()] { started.wait(); });
+
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&](int id) {
+    std::scoped_lock lock(mutex);
+    order.push_back(id);
+  };
+  for (int i = 0; i < 3; ++i) {
+    pool.push_task(cudf::detail::task_priority::NORMAL, [&record, i] { record(i); });
+  }
+  pool.push_task(cudf::detail::task_priority::HIGH, [&record] { record(-1); });
+  release.set_value();
+  pool.wait_for_tasks();
+
+  EXPECT_EQ(order, (std::vector<int>{-1, 0, 1, 2}));
+}
+
+TEST_F(ThreadPoolTest, NestedSubmit)
+{
+  cudf::detail::thread_pool pool(4);
+  std::atomic<int> count = 0;
+  auto outer             = pool.submit([&] {
+    for (int i = 0; i < 1000; ++i) {
+      pool.push_task([&count] { ++count; });
+    }
+    return 1;
+  });
+  EXPECT_EQ(outer.get(), 1);
+  pool.wait_for_tasks();
+  EXPECT_EQ(count, 1000);
+
+  pool.parallelize_loop(0, 999, [&count](int) { ++count; });
+  EXPECT_EQ(count, 2000);
+}
+
+namespace {
+
+/**
+ * @brief Host resource that counts the allocations that reach it
+ */
+class counting_host_resource : public rmm::mr::host_memory_resource {
+ public:
+  int num_allocations   = 0;
+  int num_deallocations = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++num_allocations;
+    return upstream.allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+  {
+    ++num_deallocations;
+    upstream.deallocate(ptr, bytes, alignment);
+  }
+
+  rmm::mr::new_delete_resource upstream;
+};
+
+}  // namespace
+
+struct PinnedPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PinnedPoolTest, ReusesSizeClasses)
+{
+  counting_host_resource upstream;
+  cudf::io::pinned_pool_memory_resource pool(&upstream, 1 << 20);
+
+  auto ptr = pool.allocate(5000);
+  pool.deallocate(ptr, 5000);
+  // Same size class as the freed block
+  ptr = pool.allocate(7000);
+  EXPECT_EQ(upstream.num_allocations, 1);
+
+  auto stats = pool.get_statistics();
+  EXPECT_EQ(stats.bytes_in_use, 8192);
+  EXPECT_EQ(stats.bytes_cached, 0);
+  EXPECT_EQ(stats.num_allocations, 2);
+  EXPECT_EQ(stats.num_misses, 1);
+
+  // Larger size class
+  auto large = pool.allocate(10000);
+  EXPECT_EQ(upstream.num_allocations, 2);
+  pool.deallocate(large, 10000);
+  pool.deallocate(ptr, 7000);
+
+  stats = pool.get_statistics();
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_EQ(stats.peak_bytes_in_use, 8192 + 16384);
+  EXPECT_EQ(stats.bytes_cached, 8192 + 16384);
+  EXPECT_EQ(upstream.num_deallocations, 0);
+
+  pool.release();
+  EXPECT_EQ(pool.get_statistics().bytes_cached, 0);
+  EXPECT_EQ(upstream.num_deallocations, 2);
+}
+
+TEST_F(PinnedPoolTest, CacheLimit)
+{
+  counting_host_resource upstream;
+  cudf::io::pinned_pool_memory_resource pool(&upstream, 16384);
+
+  // Larger than the cache, passed through
+  auto huge = pool.allocate(100000);
+  EXPECT_EQ(pool.get_statistics().bytes_in_use, 100000);
+  pool.deallocate(huge, 100000);
+  EXPECT_EQ(upstream.num_deallocations, 1);
+
+  auto first  = pool.allocate(16384);
+  auto second = pool.allocate(4096);
+  pool.deallocate(first, 16384);
+  // The cache is full
+  pool.deallocate(second, 4096);
+  EXPECT_EQ(upstream.num_deallocations, 2);
+  EXPECT_EQ(pool.get_statistics().bytes_cached, 16384);
+}
+
+TEST_F(PinnedPoolTest, SetHostMemoryResource)
+{
+  counting_host_resource upstream;
+  cudf::io::pinned_pool_memory_resource pool(&upstream, 1 << 20);
+  auto const previous = cudf::io::set_host_memory_resource(&pool);
+  EXPECT_EQ(cudf::io::get_host_memory_resource(), &pool);
+
+  for (int i = 0; i < 10; ++i) {
+    auto buffer = cudf::io::detail::make_pinned_buffer<int>(1000);
+    cudf::io::detail::pinned_host_vector<char> vector(3000);
+  }
+  auto const stats = pool.get_statistics();
+  EXPECT_EQ(stats.num_allocations, 20);
+  // Both buffers are in the smallest size class
+  EXPECT_EQ(stats.num_misses, 2);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+
+  cudf::io::set_host_memory_resource(previous);
+  EXPECT_EQ(cudf::io::get_host_memory_resource(), previous);
+}
+
+struct FileSinkTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FileSinkTest, WriteBehind)
+{
+  cudf::test::temp_directory const tmpdir("cudf_file_sink_test");
+  auto const filepath = tmpdir.path() + "write_behind.bin";
+
+  std::vector<char> expected;
+  {
+    cudf::io::file_sink_options options;
+    options.write_behind = true;
+    options.buffer_size  = 4096;
+    options.num_buffers  = 2;
+    auto sink            = cudf::io::data_sink::create(filepath, options);
+
+    // Writes smaller than, equal to, and larger than the buffers
+    for (size_t size : {1, 100, 4096, 5000, 20000, 3}) {
+      std::vector<char> data(size);
+      std::iota(data.begin(), data.end(), static_cast<char>(expected.size()));
+      sink->host_write(data.data(), data.size());
+      expected.insert(expected.end(), data.begin(), data.end());
+    }
+    EXPECT_EQ(sink->bytes_written(), expected.size());
+    sink->flush();
+
+    std::ifstream file(filepath, std::ios::binary);
+    std::vector<char> const written{std::istreambuf_iterator<char>(file), {}};
+    EXPECT_EQ(written, expected);
+
+    // Data written after the last flush is written when the sink is destroyed
+    sink->host_write(expected.data(), 10);
+    expected.insert(expected.end(), expected.begin(), expected.begin() + 10);
+  }
+  std::ifstream file(filepath, std::ios::binary);
+  std::vector<char> const written{std::istreambuf_iterator<char>(file), {}};
+  EXPECT_EQ(written, expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
@@ -30,7 +31,9 @@
 
 #include <arrow/io/api.h>
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -1006,4 +1009,85 @@ TEST_F(JsonReaderTest, ExperimentalLinesNoOmissions)
   }
 }
 
+TEST_F(JsonReaderTest, ExperimentalLinesByteRange)
+{
+  std::string json_string;
+  for (int i = 0; i < 50; ++i) {
+    json_string += R"({"a":")" + std::to_string(i) + R"(", "b":")" + std::string(i % 7, 'x') +
+                   "\"}\n";
+  }
+
+  auto const options_builder = [&]() {
+    return cudf::io::json_reader_options::builder(
+             cudf::io::source_info{json_string.c_str(), json_string.size()})
+      .lines(true)
+      .experimental(true);
+  };
+  auto const expected = cudf::io::read_json(options_builder().build());
+  EXPECT_EQ(expected.tbl->num_rows(), 50);
+
+  // Every record is read exactly once, regardless of where the byte ranges split the input
+  for (cudf::size_type range_size : {1, 13, 64, 100, 1000}) {
+    std::vector<std::unique_ptr<cudf::table>> parts;
+    for (size_t offset = 0; offset < json_string.size(); offset += range_size) {
+      auto result = cudf::io::read_json(
+        options_builder().byte_range_offset(offset).byte_range_size(range_size).build());
+      if (result.tbl->num_columns() != 0) { parts.push_back(std::move(result.tbl)); }
+    }
+    std::vector<cudf::table_view> part_views;
+    std::transform(parts.cbegin(), parts.cend(), std::back_inserter(part_views), [](auto& tbl) {
+      return tbl->view();
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(part_views)->view(), expected.tbl->view());
+  }
+}
+
+TEST_F(JsonReaderTest, ExperimentalLinesMultipleSources)
+{
+  std::vector<std::string> const json_strings{R"({"a":"a0", "b":"b0"})",
+                                              R"({"a":"a1", "b":"b1"})"
+                                              "\n"
+                                              R"({"a":"a2", "b":"b2"})",
+                                              R"({"a":"a3", "b":"b3"})"};
+  std::vector<cudf::io::host_buffer> buffers;
+  std::transform(json_strings.cbegin(),
+                 json_strings.cend(),
+                 std::back_inserter(buffers),
+                 [](auto& str) { return cudf::io::host_buffer{str.c_str(), str.size()}; });
+  auto const joined_string = std::accumulate(
+    std::next(json_strings.cbegin()),
+    json_strings.cend(),
+    json_strings.front(),
+    [](std::string const& joined, std::string const& str) { return joined + "\n" + str; });
+
+  auto const expected = cudf::io::read_json(
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{joined_string.c_str(), joined_string.size()})
+      .lines(true)
+      .experimental(true));
+
+  // Sources are parsed as if they were joined with newlines
+  auto const result = cudf::io::read_json(
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffers}).lines(true).experimental(
+      true));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected.tbl->view());
+
+  // The byte range applies to the joined input; here it starts within the first source and ends
+  // within the second one, so it includes the first record of the second source
+  auto const range_result = cudf::io::read_json(
+    cudf::io::json_reader_options::builder(cudf::io::source_info{buffers})
+      .lines(true)
+      .experimental(true)
+      .byte_range_offset(1)
+      .byte_range_size(json_strings[0].size() + 2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(range_result.tbl->get_column(0),
+                                 cudf::test::strings_column_wrapper({"a1"}));
+
+  // Multiple sources require JSON lines
+  EXPECT_THROW(cudf::io::read_json(
+                 cudf::io::json_reader_options::builder(cudf::io::source_info{buffers})
+                   .experimental(true)),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/io/json.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+using bool_wrapper  = cudf::test::fixed_width_column_wrapper<bool>;
+using str_wrapper   = cudf::test::strings_column_wrapper;
+using lists_wrapper = cudf::test::lists_column_wrapper<int32_t>;
+
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Writes the table to a host buffer and returns the output as a string
+std::string write_json(cudf::table_view const& table,
+                       cudf_io::table_metadata const* metadata = nullptr,
+                       bool lines                              = false,
+                       bool include_nulls                      = false,
+                       cudf::size_type rows_per_chunk          = -1)
+{
+  std::vector<char> out_buffer;
+  auto options = cudf_io::json_writer_options::builder(cudf_io::sink_info{&out_buffer}, table)
+                   .metadata(metadata)
+                   .lines(lines)
+                   .include_nulls(include_nulls)
+                   .build();
+  if (rows_per_chunk > 0) { options.set_rows_per_chunk(rows_per_chunk); }
+  cudf_io::write_json(options);
+  return std::string(out_buffer.data(), out_buffer.size());
+}
+}  // namespace
+
+TEST_F(JsonWriterTest, Records)
+{
+  int32_wrapper col0{1, 2, 3};
+  str_wrapper col1{"a", "bc", "def"};
+  bool_wrapper col2{true, false, true};
+  auto const table = cudf::table_view{{col0, col1, col2}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"int", "str", "bool"};
+
+  EXPECT_EQ(write_json(table, &metadata),
+            R"([{"int":1,"str":"a","bool":true},)"
+            R"({"int":2,"str":"bc","bool":false},)"
+            R"({"int":3,"str":"def","bool":true}])");
+}
+
+TEST_F(JsonWriterTest, Lines)
+{
+  int32_wrapper col0{1, 2, 3};
+  str_wrapper col1{"a", "bc", "def"};
+  auto const table = cudf::table_view{{col0, col1}};
+
+  // columns without names are named after their index
+  EXPECT_EQ(write_json(table, nullptr, true),
+            "{\"0\":1,\"1\":\"a\"}\n"
+            "{\"0\":2,\"1\":\"bc\"}\n"
+            "{\"0\":3,\"1\":\"def\"}\n");
+}
+
+TEST_F(JsonWriterTest, EscapedStrings)
+{
+  str_wrapper col0{"quote\"", "back\\slash", "new\nline", "tab\t", "bell\a", "utf8 \xc3\xa9"};
+  auto const table = cudf::table_view{{col0}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"na\"me"};
+
+  EXPECT_EQ(write_json(table, &metadata, true),
+            R"({"na\"me":"quote\""})"
+            "\n"
+            R"({"na\"me":"back\\slash"})"
+            "\n"
+            R"({"na\"me":"new\nline"})"
+            "\n"
+            R"({"na\"me":"tab\t"})"
+            "\n"
+            R"({"na\"me":"bell\u0007"})"
+            "\n"
+            "{\"na\\\"me\":\"utf8 \xc3\xa9\"}\n");
+}
+
+TEST_F(JsonWriterTest, Nulls)
+{
+  int32_wrapper col0{{1, 2, 3}, {true, false, true}};
+  str_wrapper col1{{"a", "bc", "def"}, {false, true, true}};
+  auto const table = cudf::table_view{{col0, col1}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b"};
+
+  EXPECT_EQ(write_json(table, &metadata, true),
+            "{\"a\":1}\n"
+            "{\"b\":\"bc\"}\n"
+            "{\"a\":3,\"b\":\"def\"}\n");
+  EXPECT_EQ(write_json(table, &metadata, true, true),
+            "{\"a\":1,\"b\":null}\n"
+            "{\"a\":null,\"b\":\"bc\"}\n"
+            "{\"a\":3,\"b\":\"def\"}\n");
+}
+
+TEST_F(JsonWriterTest, NonFiniteFloats)
+{
+  auto constexpr nan = std::numeric_limits<double>::quiet_NaN();
+  auto constexpr inf = std::numeric_limits<double>::infinity();
+  cudf::test::fixed_width_column_wrapper<double> col0{1.5, nan, inf, -inf};
+  auto const table = cudf::table_view{{col0}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"f"};
+
+  // JSON has no NaN or infinity, so they are written as nulls
+  EXPECT_EQ(write_json(table, &metadata, true), "{\"f\":1.5}\n{}\n{}\n{}\n");
+  EXPECT_EQ(write_json(table, &metadata, true, true),
+            "{\"f\":1.5}\n"
+            "{\"f\":null}\n"
+            "{\"f\":null}\n"
+            "{\"f\":null}\n");
+}
+
+TEST_F(JsonWriterTest, Nested)
+{
+  // struct<int, list<int>>
+  int32_wrapper ints{{1, 2, 3}, {true, false, true}};
+  lists_wrapper lists{{1, 2}, {}, {3}};
+  auto structs = cudf::test::structs_column_wrapper{{ints, lists}, {true, true, false}};
+  str_wrapper names{"x", "y", "z"};
+  auto const table = cudf::table_view{{structs, names}};
+
+  cudf_io::table_metadata metadata;
+  metadata.schema_info.emplace_back("s");
+  metadata.schema_info[0].children.emplace_back("i");
+  metadata.schema_info[0].children.emplace_back("l");
+  metadata.schema_info.emplace_back("name");
+
+  EXPECT_EQ(write_json(table, &metadata, true),
+            "{\"s\":{\"i\":1,\"l\":[1,2]},\"name\":\"x\"}\n"
+            "{\"s\":{\"l\":[]},\"name\":\"y\"}\n"
+            "{\"name\":\"z\"}\n");
+}
+
+TEST_F(JsonWriterTest, NullListElements)
+{
+  using cudf::test::iterators::null_at;
+  lists_wrapper lists{lists_wrapper({1, 2}, null_at(1)), {}, lists_wrapper({3, 4}, null_at(0))};
+  auto const table = cudf::table_view{{lists}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"l"};
+
+  // null list elements are always written, to keep the positions of the other elements
+  EXPECT_EQ(write_json(table, &metadata), R"([{"l":[1,null]},{"l":[]},{"l":[null,4]}])");
+}
+
+TEST_F(JsonWriterTest, RowsPerChunk)
+{
+  constexpr cudf::size_type num_rows = 100;
+  auto values  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto offsets = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  int32_wrapper col0(values, values + num_rows);
+  auto col1 = cudf::make_lists_column(num_rows,
+                                      int32_wrapper(offsets, offsets + num_rows + 1).release(),
+                                      int32_wrapper(values, values + 2 * num_rows).release(),
+                                      0,
+                                      {});
+  int32_wrapper child(values, values + num_rows);
+  auto col2 = cudf::test::structs_column_wrapper{{child}};
+  auto const sliced = cudf::slice(cudf::table_view{{col0, *col1, col2}}, {10, 90})[0];
+
+  // the output does not depend on the number of rows written at a time
+  for (bool lines : {false, true}) {
+    auto const expected = write_json(sliced, nullptr, lines);
+    EXPECT_EQ(write_json(sliced, nullptr, lines, false, 7), expected);
+    EXPECT_EQ(write_json(sliced, nullptr, lines, false, 1), expected);
+  }
+  EXPECT_EQ(write_json(cudf::slice(sliced, {0, 1})[0], nullptr, true),
+            "{\"0\":10,\"1\":[20,21],\"2\":{\"0\":10}}\n");
+}
+
+TEST_F(JsonWriterTest, Empty)
+{
+  int32_wrapper col0{};
+  auto const table = cudf::table_view{{col0}};
+
+  EXPECT_EQ(write_json(table), "[]");
+  EXPECT_EQ(write_json(table, nullptr, true), "");
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -23,14 +23,18 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <type_traits>
@@ -532,6 +536,27 @@ TEST_F(OrcWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcWriterTest, CompressionLZ4)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  int32_col col0(sequence, sequence + 10000);
+  std::vector<std::string> strings(10000, "repeated strings compress well");
+  str_col col1(strings.begin(), strings.end());
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+      .compression(cudf_io::compression_type::LZ4);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offsetted views into existing cudf tables
@@ -1533,4 +1558,354 @@ TEST_F(OrcReaderTest, EmptyColumnsParam)
   EXPECT_EQ(result.tbl->num_rows(), 0);
 }
 
+namespace {
+// Reads the ORC data chunk by chunk, and returns the concatenated chunks and the number of chunks
+std::pair<std::unique_ptr<cudf::table>, int> chunked_read(cudf_io::orc_reader_options const& opts,
+                                                          std::size_t chunk_read_limit,
+                                                          std::size_t pass_read_limit = 0)
+{
+  auto reader = cudf_io::chunked_orc_reader(chunk_read_limit, pass_read_limit, opts);
+
+  auto num_chunks = 0;
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  std::vector<cudf::table_view> chunk_views;
+  do {
+    chunks.push_back(reader.read_chunk().tbl);
+    chunk_views.push_back(chunks.back()->view());
+    ++num_chunks;
+  } while (reader.has_next());
+
+  return {cudf::concatenate(chunk_views), num_chunks};
+}
+
+auto write_chunked_read_table(std::string const& name, cudf::size_type num_rows)
+{
+  auto values   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 1000); });
+  int64_col col0(values, values + num_rows, validity);
+  str_col col1(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto const filepath = temp_env->get_temp_filepath(name);
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stripe_size_rows(10000);
+  cudf_io::write_orc(out_opts);
+  return filepath;
+}
+}  // namespace
+
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  auto const filepath = write_chunked_read_table("ChunkedRead.orc", 100000);
+  auto const opts = cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).build();
+  auto const expected = cudf_io::read_orc(opts);
+
+  {
+    auto const [result, num_chunks] = chunked_read(opts, 0);
+    EXPECT_EQ(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+  }
+  {
+    auto const [result, num_chunks] = chunked_read(opts, 300'000);
+    EXPECT_GT(num_chunks, 1);
+    EXPECT_LT(num_chunks, 10);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+  }
+  {
+    // The limit is smaller than a single stripe, so each chunk holds one stripe
+    auto const [result, num_chunks] = chunked_read(opts, 1);
+    EXPECT_EQ(num_chunks, 10);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+  }
+  {
+    auto const [result, num_chunks] = chunked_read(opts, 0, 1);
+    EXPECT_EQ(num_chunks, 10);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+  }
+}
+
+TEST_F(OrcReaderTest, ChunkedReadRowBounds)
+{
+  auto const filepath = write_chunked_read_table("ChunkedReadRowBounds.orc", 100000);
+  auto const opts = cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+                      .skip_rows(15000)
+                      .num_rows(50000)
+                      .build();
+  auto const expected = cudf_io::read_orc(opts);
+
+  auto const [result, num_chunks] = chunked_read(opts, 1);
+  EXPECT_EQ(num_chunks, 6);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+}
+
+TEST_F(OrcReaderTest, ChunkedReadStripes)
+{
+  auto const filepath = write_chunked_read_table("ChunkedReadStripes.orc", 100000);
+  auto const opts = cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+                      .stripes({{1, 4, 5, 9}})
+                      .columns({"_col1"})
+                      .build();
+  auto const expected = cudf_io::read_orc(opts);
+
+  auto const [result, num_chunks] = chunked_read(opts, 1);
+  EXPECT_EQ(num_chunks, 4);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+}
+
+TEST_F(OrcReaderTest, ChunkedReadNested)
+{
+  constexpr auto num_rows = 20000;
+  auto offsets = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 3 * i; });
+  auto values  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto col0    = cudf::make_lists_column(num_rows,
+                                      int32_col(offsets, offsets + num_rows + 1).release(),
+                                      int32_col(values, values + 3 * num_rows).release(),
+                                      0,
+                                      {});
+  auto const expected = table_view{{*col0}};
+
+  auto const filepath = temp_env->get_temp_filepath("ChunkedReadNested.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stripe_size_rows(5000);
+  cudf_io::write_orc(out_opts);
+
+  auto const opts = cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).build();
+  auto const [result, num_chunks] = chunked_read(opts, 1);
+  EXPECT_EQ(num_chunks, 4);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TEST_F(OrcReaderTest, ChunkedReadEmpty)
+{
+  auto const filepath = write_chunked_read_table("ChunkedReadEmpty.orc", 0);
+  auto const opts = cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).build();
+
+  auto reader = cudf_io::chunked_orc_reader(1, opts);
+  EXPECT_TRUE(reader.has_next());
+  auto const result = reader.read_chunk();
+  EXPECT_FALSE(reader.has_next());
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // Reading past the end returns empty tables
+  auto const past_end = reader.read_chunk();
+  EXPECT_EQ(past_end.tbl->num_columns(), 2);
+  EXPECT_EQ(past_end.tbl->num_rows(), 0);
+}
+
+TEST_F(OrcReaderTest, FilterStripeStatistics)
+{
+  constexpr cudf::size_type num_rows = 50000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto doubled  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2. * i; });
+  auto times    = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return cudf::timestamp_ms{cudf::duration_ms{1000L * i + 1}}; });
+  int32_col col0(sequence, sequence + num_rows);
+  float64_col col1(doubled, doubled + num_rows);
+  column_wrapper<cudf::timestamp_ms> col2(times, times + num_rows);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterStripeStatistics.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stripe_size_rows(10000);
+  cudf_io::write_orc(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+        .timestamp_type(cudf::data_type(cudf::type_id::TIMESTAMP_MILLISECONDS))
+        .filter(filter);
+    return cudf_io::read_orc(in_opts);
+  };
+
+  auto const col_ref0 = cudf::ast::column_reference(0);
+  auto const col_ref1 = cudf::ast::column_reference(1);
+  auto const col_ref2 = cudf::ast::column_reference(2);
+  {
+    auto value        = cudf::numeric_scalar<int32_t>(25000);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref0, lit);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {0, 25000})[0], result.tbl->view());
+  }
+  {
+    // literal on the left-hand side of the comparison
+    auto value        = cudf::numeric_scalar<double>(80000.);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, lit, col_ref1);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {40000, num_rows})[0], result.tbl->view());
+  }
+  {
+    // statistics of timestamps only have a millisecond resolution
+    auto value = cudf::timestamp_scalar<cudf::timestamp_ms>(cudf::duration_ms{30000001L}, true);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref2, lit);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {30000, 30001})[0], result.tbl->view());
+  }
+  {
+    // no stripe can match
+    auto value        = cudf::numeric_scalar<int32_t>(num_rows);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref0, lit);
+    auto const result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(OrcReaderTest, FilterRowIndexStatistics)
+{
+  constexpr cudf::size_type num_rows = 80000;
+  // the second row group of each stripe is offset, so that the stripe statistics overlap with the
+  // filter while the row group statistics of only one stripe do
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i) + (i / 10000 % 2) * 100000;
+  });
+  int64_col col0(values, values + num_rows);
+  auto const expected = table_view{{col0}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterRowIndexStatistics.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .enable_statistics(cudf_io::ORC_STATISTICS_ROW_GROUP)
+      .stripe_size_rows(20000)
+      .row_index_stride(10000);
+  cudf_io::write_orc(out_opts);
+
+  using cudf::ast::ast_operator;
+  auto lower_value  = cudf::numeric_scalar<int64_t>(50000);
+  auto upper_value  = cudf::numeric_scalar<int64_t>(100000);
+  auto const lower  = cudf::ast::literal(lower_value);
+  auto const upper  = cudf::ast::literal(upper_value);
+  auto const col    = cudf::ast::column_reference(0);
+  auto const above  = cudf::ast::operation(ast_operator::GREATER_EQUAL, col, lower);
+  auto const below  = cudf::ast::operation(ast_operator::LESS, col, upper);
+  auto const filter = cudf::ast::operation(ast_operator::LOGICAL_AND, above, below);
+
+  // Only the last stripe is read
+  auto const opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter).build();
+  auto const [result, num_chunks] = chunked_read(opts, 1);
+  EXPECT_EQ(num_chunks, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {60000, 70000})[0], result->view());
+}
+
+TEST_F(OrcReaderTest, FilterChunkedRead)
+{
+  auto const filepath = write_chunked_read_table("FilterChunkedRead.orc", 50000);
+
+  using cudf::ast::ast_operator;
+  auto lower_value  = cudf::numeric_scalar<int64_t>(12000);
+  auto upper_value  = cudf::numeric_scalar<int64_t>(31000);
+  auto const lower  = cudf::ast::literal(lower_value);
+  auto const upper  = cudf::ast::literal(upper_value);
+  auto const col    = cudf::ast::column_reference(0);
+  auto const above  = cudf::ast::operation(ast_operator::GREATER_EQUAL, col, lower);
+  auto const below  = cudf::ast::operation(ast_operator::LESS, col, upper);
+  auto const filter = cudf::ast::operation(ast_operator::LOGICAL_AND, above, below);
+
+  auto const opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter).build();
+  auto const expected = cudf_io::read_orc(
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).stripes({{1, 2, 3}}));
+  auto const mask = cudf::compute_column(expected.tbl->view(), filter);
+
+  // Only the three stripes that may contain matching rows are read, one stripe per chunk
+  auto const [result, num_chunks] = chunked_read(opts, 1);
+  EXPECT_EQ(num_chunks, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::apply_boolean_mask(expected.tbl->view(), mask->view()),
+                                result->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf_io::read_orc(opts).tbl->view());
+}
+
+TEST_F(OrcReaderTest, FilterBloomFilter)
+{
+  constexpr cudf::size_type num_rows = 50000;
+  // distinct even values, spread over the whole range in each stripe so that the statistics
+  // cannot exclude any stripe
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i) * 7919 % num_rows * 2;
+  });
+  auto halved = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return static_cast<double>(values[i]) / 2; });
+  int64_col col0(values, values + num_rows);
+  float64_col col1(halved, halved + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_bloom_filter(true);
+
+  auto filepath = temp_env->get_temp_filepath("FilterBloomFilter.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stripe_size_rows(10000);
+  cudf_io::write_orc(out_opts);
+
+  auto const filtered_options = [&](cudf::ast::expression const& filter) {
+    return cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .filter(filter)
+      .build();
+  };
+
+  auto const col_ref0 = cudf::ast::column_reference(0);
+  auto const col_ref1 = cudf::ast::column_reference(1);
+  {
+    // only the stripe that contains the value is read
+    auto value        = cudf::numeric_scalar<int64_t>(values[23456]);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref0, lit);
+    auto const [result, num_chunks] = chunked_read(filtered_options(filter), 1);
+    EXPECT_EQ(num_chunks, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {23456, 23457})[0], result->view());
+  }
+  {
+    using cudf::ast::ast_operator;
+    auto first_value  = cudf::numeric_scalar<double>(halved[2345]);
+    auto second_value = cudf::numeric_scalar<double>(halved[45678]);
+    auto const first  = cudf::ast::literal(first_value);
+    auto const second = cudf::ast::literal(second_value);
+    auto const equal_first  = cudf::ast::operation(ast_operator::EQUAL, col_ref1, first);
+    auto const equal_second = cudf::ast::operation(ast_operator::EQUAL, second, col_ref1);
+    auto const filter = cudf::ast::operation(ast_operator::LOGICAL_OR, equal_first, equal_second);
+    auto const [result, num_chunks] = chunked_read(filtered_options(filter), 1);
+    EXPECT_EQ(num_chunks, 2);
+    auto const matches = cudf::slice(expected, {2345, 2346, 45678, 45679});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(matches), result->view());
+  }
+  {
+    // odd values are within the range of the statistics, but are not in the column
+    auto value        = cudf::numeric_scalar<int64_t>(1001);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref0, lit);
+    auto const result = cudf_io::read_orc(filtered_options(filter));
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(OrcReaderTest, FilterWithRowBounds)
+{
+  auto const filepath = write_chunked_read_table("FilterWithRowBounds.orc", 100);
+
+  auto value        = cudf::numeric_scalar<int64_t>(10);
+  auto const lit    = cudf::ast::literal(value);
+  auto const col    = cudf::ast::column_reference(0);
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col, lit);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(5)
+      .filter(filter);
+  EXPECT_THROW(cudf_io::read_orc(in_opts), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -23,6 +23,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -30,11 +31,16 @@
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <src/io/parquet/bloom_filter.hpp>
 #include <src/io/parquet/compact_protocol_reader.hpp>
 #include <src/io/parquet/parquet.hpp>
 
@@ -42,6 +48,9 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <type_traits>
 
@@ -322,6 +331,10 @@ struct ParquetWriterTest : public cudf::test::BaseFixture {
 struct ParquetReaderTest : public cudf::test::BaseFixture {
 };
 
+// Base test fixture for chunked reader tests
+struct ParquetChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
 // Base test fixture for "stress" tests
 struct ParquetWriterStressTest : public cudf::test::BaseFixture {
 };
@@ -711,6 +724,29 @@ TEST_F(ParquetWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, CompressionCodecs)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int> col0(sequence, sequence + 10000);
+  std::vector<std::string> strings(10000, "repeated strings compress well");
+  column_wrapper<cudf::string_view> col1(strings.begin(), strings.end());
+  auto expected = table_view{{col0, col1}};
+
+  for (auto codec : {cudf_io::compression_type::LZ4, cudf_io::compression_type::GZIP}) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .compression(codec);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, StringsAsBinary)
 {
   std::vector<const char*> unicode_strings{
@@ -4357,6 +4393,335 @@ TEST_F(ParquetWriterTest, BinaryColumnIndexTruncation)
   }
 }
 
+// checks that every column chunk of the file lists `encodings[c]` among its encodings
+void expect_chunk_encodings(std::string const& filepath,
+                            std::vector<cudf::io::parquet::Encoding> const& encodings)
+{
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  for (auto const& rg : fmd.row_groups) {
+    ASSERT_EQ(rg.columns.size(), encodings.size());
+    for (size_t c = 0; c < rg.columns.size(); c++) {
+      auto const& chunk_encodings = rg.columns[c].meta_data.encodings;
+      EXPECT_NE(std::find(chunk_encodings.begin(), chunk_encodings.end(), encodings[c]),
+                chunk_encodings.end());
+    }
+  }
+}
+
+TEST_F(ParquetWriterTest, DeltaBinaryPacked)
+{
+  constexpr auto num_rows = 50000;
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  // monotonic ids and timestamps, random values and values whose deltas overflow
+  auto ids        = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto timestamps = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return cudf::timestamp_us{cudf::duration_us{1'600'000'000'000'000L + i}}; });
+  auto extremes = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return (i % 2) ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+  });
+  auto col3_data = random_values<int8_t>(num_rows);
+  auto col4_data = random_values<uint32_t>(num_rows);
+
+  column_wrapper<int32_t> col0(ids, ids + num_rows);
+  column_wrapper<int32_t> col1(ids, ids + num_rows, validity);
+  column_wrapper<cudf::timestamp_us> col2(timestamps, timestamps + num_rows);
+  column_wrapper<int8_t> col3(col3_data.begin(), col3_data.end(), validity);
+  column_wrapper<uint32_t> col4(col4_data.begin(), col4_data.end());
+  column_wrapper<int64_t> col5(extremes, extremes + num_rows, validity);
+
+  auto const expected = table_view{{col0, col1, col2, col3, col4, col5}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  for (auto& col_meta : expected_metadata.column_metadata) {
+    col_meta.set_encoding(cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  }
+
+  auto const filepath = temp_env->get_temp_filepath("DeltaBinaryPacked.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .max_page_size_rows(20000);
+  cudf_io::write_parquet(out_opts);
+
+  expect_chunk_encodings(
+    filepath,
+    std::vector<cudf::io::parquet::Encoding>(expected.num_columns(),
+                                             cudf::io::parquet::Encoding::DELTA_BINARY_PACKED));
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, DeltaBinaryPackedSize)
+{
+  // increasing ids with no repeats are a poor fit for dictionary encoding
+  constexpr auto num_rows = 100000;
+  auto ids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 1000L * i; });
+  column_wrapper<int64_t> col(ids, ids + num_rows);
+  auto const expected = table_view{{col}};
+
+  auto write = [&](cudf_io::column_encoding encoding) {
+    cudf_io::table_input_metadata metadata(expected);
+    metadata.column_metadata[0].set_encoding(encoding);
+
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .metadata(&metadata)
+        .compression(cudf_io::compression_type::NONE);
+    cudf_io::write_parquet(out_opts);
+    return out_buffer;
+  };
+  auto const plain = write(cudf_io::column_encoding::USE_DEFAULT);
+  auto const delta = write(cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  EXPECT_LT(delta.size() * 4, plain.size());
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{delta.data(), delta.size()});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, DeltaByteArray)
+{
+  constexpr auto num_rows = 30000;
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  // sorted strings sharing long prefixes, with some empty strings
+  auto sorted_elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    char buf[48];
+    sprintf(buf, "s3://bucket/year=2022/part-%08d.parquet", i / 3);
+    return (i % 11 == 0) ? std::string{} : std::string(buf);
+  });
+  auto mixed_elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return std::string(i % 37, static_cast<char>('a' + i % 26));
+  });
+
+  cudf::test::strings_column_wrapper col0(sorted_elements, sorted_elements + num_rows);
+  cudf::test::strings_column_wrapper col1(sorted_elements, sorted_elements + num_rows, validity);
+  cudf::test::strings_column_wrapper col2(mixed_elements, mixed_elements + num_rows);
+  cudf::test::strings_column_wrapper col3(mixed_elements, mixed_elements + num_rows, validity);
+
+  auto const expected = table_view{{col0, col1, col2, col3}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_encoding(cudf_io::column_encoding::DELTA_BYTE_ARRAY);
+  expected_metadata.column_metadata[1].set_encoding(cudf_io::column_encoding::DELTA_BYTE_ARRAY);
+  expected_metadata.column_metadata[2].set_encoding(
+    cudf_io::column_encoding::DELTA_LENGTH_BYTE_ARRAY);
+  expected_metadata.column_metadata[3].set_encoding(
+    cudf_io::column_encoding::DELTA_LENGTH_BYTE_ARRAY);
+
+  auto const filepath = temp_env->get_temp_filepath("DeltaByteArray.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .max_page_size_rows(8000);
+  cudf_io::write_parquet(out_opts);
+
+  expect_chunk_encodings(filepath,
+                         {cudf::io::parquet::Encoding::DELTA_BYTE_ARRAY,
+                          cudf::io::parquet::Encoding::DELTA_BYTE_ARRAY,
+                          cudf::io::parquet::Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                          cudf::io::parquet::Encoding::DELTA_LENGTH_BYTE_ARRAY});
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ByteStreamSplit)
+{
+  constexpr auto num_rows = 20000;
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+
+  auto col0_data = random_values<float>(num_rows);
+  auto col1_data = random_values<double>(num_rows);
+
+  column_wrapper<float> col0(col0_data.begin(), col0_data.end());
+  column_wrapper<float> col1(col0_data.begin(), col0_data.end(), validity);
+  column_wrapper<double> col2(col1_data.begin(), col1_data.end());
+  column_wrapper<double> col3(col1_data.begin(), col1_data.end(), validity);
+
+  auto const expected = table_view{{col0, col1, col2, col3}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  for (auto& col_meta : expected_metadata.column_metadata) {
+    col_meta.set_encoding(cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+  }
+
+  auto const filepath = temp_env->get_temp_filepath("ByteStreamSplit.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .max_page_size_rows(7000);
+  cudf_io::write_parquet(out_opts);
+
+  expect_chunk_encodings(filepath,
+                         std::vector<cudf::io::parquet::Encoding>(
+                           expected.num_columns(), cudf::io::parquet::Encoding::BYTE_STREAM_SPLIT));
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, InvalidColumnEncoding)
+{
+  column_wrapper<float> float_col{1.f, 2.f, 3.f};
+  column_wrapper<int32_t> int_col{1, 2, 3};
+  column_wrapper<bool> bool_col{true, false, true};
+  cudf::test::strings_column_wrapper string_col{"a", "b", "c"};
+
+  auto expect_throw = [](table_view const& table, cudf_io::column_encoding encoding) {
+    cudf_io::table_input_metadata metadata(table);
+    metadata.column_metadata[0].set_encoding(encoding);
+
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, table)
+        .metadata(&metadata);
+    EXPECT_THROW(cudf_io::write_parquet(out_opts), cudf::logic_error);
+  };
+
+  expect_throw(table_view{{float_col}}, cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  expect_throw(table_view{{int_col}}, cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+  expect_throw(table_view{{int_col}}, cudf_io::column_encoding::DELTA_BYTE_ARRAY);
+  expect_throw(table_view{{string_col}}, cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  expect_throw(table_view{{bool_col}}, cudf_io::column_encoding::DICTIONARY);
+}
+
+TEST_F(ParquetReaderTest, ReadMetadata)
+{
+  constexpr auto num_rows = 10000;
+  auto values   = thrust::make_counting_iterator(0);
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string" + std::to_string(i); });
+  column_wrapper<int32_t> col0(values, values + num_rows, validity);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings");
+
+  auto const filepath = temp_env->get_temp_filepath("ReadMetadata.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .key_value_metadata({{{"key", "value"}}})
+      .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(num_rows / 2);
+  cudf_io::write_parquet(out_opts);
+
+  auto const metadata = cudf_io::read_parquet_metadata(cudf_io::source_info{filepath});
+
+  EXPECT_EQ(metadata.num_rows, num_rows);
+  EXPECT_EQ(metadata.key_value_metadata.at("key"), "value");
+  ASSERT_EQ(metadata.schema.children.size(), 2);
+  EXPECT_EQ(metadata.schema.children[0].name, "ints");
+  EXPECT_EQ(metadata.schema.children[0].type, cudf_io::parquet_physical_type::INT32);
+  EXPECT_EQ(metadata.schema.children[1].name, "strings");
+  EXPECT_EQ(metadata.schema.children[1].type, cudf_io::parquet_physical_type::BYTE_ARRAY);
+
+  auto const source = cudf_io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  ASSERT_EQ(metadata.row_groups.size(), 2);
+  for (size_t r = 0; r < metadata.row_groups.size(); ++r) {
+    auto const& rg = metadata.row_groups[r];
+    EXPECT_EQ(rg.num_rows, num_rows / 2);
+    EXPECT_EQ(rg.total_byte_size, fmd.row_groups[r].total_byte_size);
+    ASSERT_EQ(rg.columns.size(), 2);
+    for (size_t c = 0; c < rg.columns.size(); ++c) {
+      auto const& chunk = rg.columns[c];
+      EXPECT_EQ(chunk.path_in_schema, fmd.row_groups[r].columns[c].meta_data.path_in_schema);
+      EXPECT_EQ(chunk.data_page_offset, fmd.row_groups[r].columns[c].meta_data.data_page_offset);
+      EXPECT_EQ(chunk.total_compressed_size,
+                fmd.row_groups[r].columns[c].meta_data.total_compressed_size);
+      EXPECT_GT(chunk.column_index_offset, 0);
+      EXPECT_GT(chunk.offset_index_offset, 0);
+    }
+
+    // every fifth value is null, and the first value of each row group is null
+    auto const& ints = rg.columns[0];
+    EXPECT_EQ(ints.null_count.value(), num_rows / 2 / 5);
+    ASSERT_TRUE(ints.min_value.has_value() && ints.max_value.has_value());
+    int32_t min_value, max_value;
+    ASSERT_EQ(ints.min_value->size(), sizeof(min_value));
+    ASSERT_EQ(ints.max_value->size(), sizeof(max_value));
+    std::memcpy(&min_value, ints.min_value->data(), sizeof(min_value));
+    std::memcpy(&max_value, ints.max_value->data(), sizeof(max_value));
+    EXPECT_EQ(min_value, static_cast<int32_t>(r * num_rows / 2 + 1));
+    EXPECT_EQ(max_value, static_cast<int32_t>((r + 1) * num_rows / 2 - 1));
+    EXPECT_EQ(rg.columns[1].null_count.value(), 0);
+  }
+}
+
+TEST_F(ParquetReaderTest, FooterCache)
+{
+  auto values = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> col(values, values + 100);
+  auto const expected = table_view{{col}};
+
+  auto const filepath = temp_env->get_temp_filepath("FooterCache.parquet");
+  auto write_version  = [&](std::string const& version) {
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+        .key_value_metadata({{{"version", version}}});
+    cudf_io::write_parquet(out_opts);
+  };
+  auto read_version = [&]() {
+    return cudf_io::read_parquet_metadata(cudf_io::source_info{filepath})
+      .key_value_metadata.at("version");
+  };
+
+  auto const old_capacity = cudf_io::get_parquet_footer_cache_capacity();
+  cudf_io::set_parquet_footer_cache_capacity(4);
+  EXPECT_EQ(cudf_io::get_parquet_footer_cache_capacity(), 4);
+
+  write_version("v1");
+  EXPECT_EQ(read_version(), "v1");
+  auto const v1_write_time = std::filesystem::last_write_time(filepath);
+
+  // A file with the same path, size and modification time is served from the cache
+  write_version("v2");
+  std::filesystem::last_write_time(filepath, v1_write_time);
+  EXPECT_EQ(read_version(), "v1");
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  EXPECT_EQ(result.metadata.per_file_user_data[0].at("version"), "v1");
+
+  // A modified file is parsed again
+  std::filesystem::last_write_time(filepath, v1_write_time + std::chrono::seconds(1));
+  EXPECT_EQ(read_version(), "v2");
+
+  // Disabling the cache drops the cached footers
+  cudf_io::set_parquet_footer_cache_capacity(0);
+  std::filesystem::last_write_time(filepath, v1_write_time);
+  write_version("v3");
+  std::filesystem::last_write_time(filepath, v1_write_time);
+  EXPECT_EQ(read_version(), "v3");
+
+  cudf_io::set_parquet_footer_cache_capacity(old_capacity);
+}
+
 TEST_F(ParquetReaderTest, EmptyColumnsParam)
 {
   srand(31337);
@@ -4652,4 +5017,379 @@ TEST_P(ParquetSizedTest, DictionaryTest)
   EXPECT_EQ(nbits, rle_bits);
 }
 
+TEST_F(ParquetReaderTest, FilterRowGroupStatistics)
+{
+  constexpr cudf::size_type num_rows = 60000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto doubled  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2. * i; });
+  auto const col0 = column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto const col1 = column_wrapper<double>(doubled, doubled + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroupStatistics.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(20000)
+      .max_page_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(in_opts);
+  };
+
+  auto const col_ref0 = cudf::ast::column_reference(0);
+  auto const col_ref1 = cudf::ast::column_reference(1);
+  {
+    auto value        = cudf::numeric_scalar<int32_t>(25000);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref0, lit);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {0, 25000})[0], result.tbl->view());
+  }
+  {
+    // literal on the left-hand side of the comparison
+    auto value        = cudf::numeric_scalar<double>(100000.);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, lit, col_ref1);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {50000, num_rows})[0], result.tbl->view());
+  }
+  {
+    using cudf::ast::ast_operator;
+    auto lower_value   = cudf::numeric_scalar<int32_t>(10000);
+    auto upper_value   = cudf::numeric_scalar<int32_t>(12000);
+    auto single_value  = cudf::numeric_scalar<int32_t>(45000);
+    auto const lower   = cudf::ast::literal(lower_value);
+    auto const upper   = cudf::ast::literal(upper_value);
+    auto const single  = cudf::ast::literal(single_value);
+    auto const above   = cudf::ast::operation(ast_operator::GREATER_EQUAL, col_ref0, lower);
+    auto const below   = cudf::ast::operation(ast_operator::LESS, col_ref0, upper);
+    auto const range   = cudf::ast::operation(ast_operator::LOGICAL_AND, above, below);
+    auto const equal   = cudf::ast::operation(ast_operator::EQUAL, col_ref0, single);
+    auto const filter  = cudf::ast::operation(ast_operator::LOGICAL_OR, range, equal);
+    auto const result  = read_filtered(filter);
+    auto const matches = cudf::slice(expected, {10000, 12000, 45000, 45001});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(matches), result.tbl->view());
+  }
+  {
+    // no row group can match
+    auto value        = cudf::numeric_scalar<int32_t>(num_rows);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref0, lit);
+    auto const result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+  }
+}
+
+TEST_F(ParquetReaderTest, FilterPageIndex)
+{
+  constexpr cudf::size_type num_rows = 40000;
+  // values are sorted within each row group, but the row group statistics overlap
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i % 20000);
+  });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const col      = column_wrapper<int64_t>(values, values + num_rows, valids);
+  auto const expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterPageIndex.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(20000)
+      .max_page_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto value         = cudf::numeric_scalar<int64_t>(19000);
+  auto const lit     = cudf::ast::literal(value);
+  auto const filter  = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, lit);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  // rows with a null value do not satisfy the filter
+  auto const mask            = cudf::compute_column(expected, filter);
+  auto const expected_result = cudf::apply_boolean_mask(expected, *mask);
+  EXPECT_EQ(expected_result->num_rows(), 1332);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected_result, result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, FilterPageIndexRanges)
+{
+  constexpr cudf::size_type num_rows = 60000;
+  // sorted values within each row group, with a dictionary encoded string column whose pages
+  // are split at different rows than the integer column
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i % 30000);
+  });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value" + std::to_string(i % 7); });
+  auto const col0     = column_wrapper<int64_t>(values, values + num_rows);
+  auto const col1     = column_wrapper<cudf::string_view>(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterPageIndexRanges.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(30000)
+      .max_page_size_rows(4000);
+  cudf_io::write_parquet(out_opts);
+
+  // only the first and the last pages of each row group can match
+  using cudf::ast::ast_operator;
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto lower_value   = cudf::numeric_scalar<int64_t>(1000);
+  auto upper_value   = cudf::numeric_scalar<int64_t>(29000);
+  auto const lower   = cudf::ast::literal(lower_value);
+  auto const upper   = cudf::ast::literal(upper_value);
+  auto const below   = cudf::ast::operation(ast_operator::LESS, col_ref, lower);
+  auto const above   = cudf::ast::operation(ast_operator::GREATER_EQUAL, col_ref, upper);
+  auto const filter  = cudf::ast::operation(ast_operator::LOGICAL_OR, below, above);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  auto const mask            = cudf::compute_column(expected, filter);
+  auto const expected_result = cudf::apply_boolean_mask(expected, *mask);
+  EXPECT_EQ(expected_result->num_rows(), 4000);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected_result, result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, FilterBloomFilter)
+{
+  constexpr cudf::size_type num_rows       = 40000;
+  constexpr cudf::size_type row_group_size = 20000;
+  // distinct even values, spread over the whole range in each row group so that the statistics
+  // cannot exclude any row group
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int64_t>(i) * 7919 % num_rows * 2;
+  });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return "key" + std::to_string(values[i]); });
+  auto const col0     = column_wrapper<int64_t>(values, values + num_rows);
+  auto const col1     = column_wrapper<cudf::string_view>(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_bloom_filter(true);
+
+  auto filepath = temp_env->get_temp_filepath("FilterBloomFilter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_group_size_rows(row_group_size);
+  cudf_io::write_parquet(out_opts);
+
+  // every value of a row group is in the bloom filter of its column chunk
+  auto const source = cudf_io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), num_rows / row_group_size);
+  for (size_t r = 0; r < fmd.row_groups.size(); ++r) {
+    for (size_t c = 0; c < fmd.row_groups[r].columns.size(); ++c) {
+      auto const& chunk = fmd.row_groups[r].columns[c].meta_data;
+      ASSERT_GT(chunk.bloom_filter_offset, 0);
+      auto const buffer = source->host_read(chunk.bloom_filter_offset, chunk.bloom_filter_length);
+      cudf::io::parquet::CompactProtocolReader cp(buffer->data(), buffer->size());
+      cudf::io::parquet::BloomFilterHeader header;
+      ASSERT_TRUE(cp.read(&header));
+      auto const bitset     = buffer->data() + cp.bytecount();
+      auto const num_blocks = header.num_bytes / cudf::io::parquet::bloom_filter_block_bytes;
+      ASSERT_EQ(bitset + header.num_bytes, buffer->data() + buffer->size());
+
+      auto const hash = [&](auto i) {
+        if (c == 0) { return cudf::io::parquet::xxhash64(values[i]); }
+        auto const str = strings[i];
+        return cudf::io::parquet::xxhash64(reinterpret_cast<uint8_t const*>(str.data()),
+                                           str.size());
+      };
+      for (cudf::size_type i = r * row_group_size; i < (r + 1) * row_group_size; ++i) {
+        EXPECT_TRUE(cudf::io::parquet::bloom_filter_may_contain(bitset, num_blocks, hash(i)));
+      }
+    }
+  }
+
+  auto const read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(in_opts);
+  };
+
+  auto const col_ref = cudf::ast::column_reference(0);
+  {
+    auto value        = cudf::numeric_scalar<int64_t>(values[12345]);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    auto const result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12345, 12346})[0], result.tbl->view());
+  }
+  {
+    // odd values are within the range of the statistics, but are not in the column
+    auto value        = cudf::numeric_scalar<int64_t>(1001);
+    auto const lit    = cudf::ast::literal(value);
+    auto const filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    auto const result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+  }
+}
+
+TEST_F(ParquetReaderTest, FilterWithRowBounds)
+{
+  auto const col      = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterWithRowBounds.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_opts);
+
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto value         = cudf::numeric_scalar<int32_t>(2);
+  auto const lit     = cudf::ast::literal(value);
+  auto const filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .filter(filter)
+      .skip_rows(1);
+  EXPECT_THROW(cudf_io::read_parquet(in_opts), cudf::logic_error);
+}
+
+namespace {
+// Reads the file chunk by chunk and returns the concatenated result and the number of chunks
+auto chunked_read(std::string const& filepath,
+                  std::size_t byte_limit,
+                  cudf::size_type skip_rows = 0,
+                  cudf::size_type num_rows  = -1)
+{
+  auto read_opts = cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).build();
+  if (skip_rows != 0) { read_opts.set_skip_rows(skip_rows); }
+  if (num_rows >= 0) { read_opts.set_num_rows(num_rows); }
+  auto reader = cudf_io::chunked_parquet_reader(byte_limit, read_opts);
+
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  std::vector<cudf::table_view> chunk_views;
+  do {
+    auto chunk = reader.read_chunk();
+    chunk_views.push_back(chunk.tbl->view());
+    chunks.push_back(std::move(chunk.tbl));
+  } while (reader.has_next());
+
+  return std::pair{cudf::concatenate(chunk_views), chunks.size()};
+}
+}  // namespace
+
+TEST_F(ParquetChunkedReaderTest, NoLimit)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 10000, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderNoLimit.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected);
+  cudf_io::write_parquet(args);
+
+  auto const [result, num_chunks] = chunked_read(filepath, 0);
+  EXPECT_EQ(num_chunks, 1UL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+}
+
+TEST_F(ParquetChunkedReaderTest, FixedWidthWithNulls)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 60000, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderFixedWidth.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected)
+      .max_page_size_rows(5000)
+      .row_group_size_rows(20000);
+  cudf_io::write_parquet(args);
+
+  // each chunk can only hold a couple of pages per column
+  auto const [result, num_chunks] = chunked_read(filepath, 200 * 1024);
+  EXPECT_GT(num_chunks, 1UL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+
+  // a limit smaller than a single page still makes progress
+  auto const [result_tiny, num_chunks_tiny] = chunked_read(filepath, 1);
+  EXPECT_GE(num_chunks_tiny, 12UL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result_tiny);
+}
+
+TEST_F(ParquetChunkedReaderTest, StringsAndRowBounds)
+{
+  constexpr cudf::size_type num_rows = 40000;
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 1000); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::strings_column_wrapper col0(strings, strings + num_rows, valids);
+  auto const values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col1(values, values + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderStrings.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .max_page_size_rows(2000)
+      .row_group_size_rows(10000);
+  cudf_io::write_parquet(args);
+
+  {
+    auto const [result, num_chunks] = chunked_read(filepath, 100 * 1024);
+    EXPECT_GT(num_chunks, 1UL);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *result);
+  }
+  {
+    auto const [result, num_chunks] = chunked_read(filepath, 100 * 1024, 1234, 23456);
+    EXPECT_GT(num_chunks, 1UL);
+    auto const expected_slice = cudf::slice(expected, {1234, 1234 + 23456})[0];
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected_slice, *result);
+  }
+}
+
+TEST_F(ParquetChunkedReaderTest, ListColumn)
+{
+  constexpr int num_rows = 50000;
+  auto colp              = make_parquet_list_col<int>(0, num_rows, 5, 8, true);
+  cudf::table_view expected({*colp});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderList.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .max_page_size_rows(5000)
+      .row_group_size_rows(20000);
+  cudf_io::write_parquet(args);
+
+  auto const [result, num_chunks] = chunked_read(filepath, 1024 * 1024);
+  EXPECT_GT(num_chunks, 1UL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *result);
+}
+
+TEST_F(ParquetChunkedReaderTest, EmptyTable)
+{
+  auto const col = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  auto const expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReaderEmpty.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(args);
+
+  auto const [result, num_chunks] = chunked_read(filepath, 1);
+  EXPECT_EQ(num_chunks, 1UL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *result);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -38,6 +38,70 @@ std::string chunk_to_host(const cudf::io::text::device_data_chunk& chunk)
   return result;
 }
 
+uint32_t crc32(std::string const& data)
+{
+  uint32_t crc = 0xffff'ffff;
+  for (unsigned char c : data) {
+    crc ^= c;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xedb8'8320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+void append_le(std::string& out, uint64_t value, int num_bytes)
+{
+  for (int i = 0; i < num_bytes; ++i) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+/**
+ * @brief Writes the content as GZIP members of `member_size` bytes, with stored DEFLATE blocks and
+ * BGZF headers.
+ */
+std::string to_bgzf(std::string const& content, std::size_t member_size)
+{
+  std::string out;
+  for (std::size_t pos = 0; pos < content.size(); pos += member_size) {
+    auto const data = content.substr(pos, member_size);
+    // header with the BC extra field, stored block, trailer
+    auto const block_size = 18 + 5 + data.size() + 8;
+    out += std::string{"\x1f\x8b\x08\x04\0\0\0\0\0\xff", 10};
+    append_le(out, 6, 2);
+    out += "BC";
+    append_le(out, 2, 2);
+    append_le(out, block_size - 1, 2);
+    out.push_back(1);
+    append_le(out, data.size(), 2);
+    append_le(out, ~data.size(), 2);
+    out += data;
+    append_le(out, crc32(data), 4);
+    append_le(out, data.size(), 4);
+  }
+  return out;
+}
+
+/**
+ * @brief Writes the content as ZSTD frames of `frame_size` bytes, with raw blocks.
+ */
+std::string to_zstd(std::string const& content, std::size_t frame_size)
+{
+  std::string out;
+  for (std::size_t pos = 0; pos < content.size(); pos += frame_size) {
+    auto const data = content.substr(pos, frame_size);
+    append_le(out, 0xfd2f'b528, 4);
+    // single segment, 4-byte content size
+    out.push_back(static_cast<char>(0xa0));
+    append_le(out, data.size(), 4);
+    // last raw block
+    append_le(out, (data.size() << 3) | 1, 3);
+    out += data;
+  }
+  return out;
+}
+
 void test_source(const std::string& content, const cudf::io::text::data_chunk_source& source)
 {
   {
@@ -106,6 +170,87 @@ TEST_F(DataChunkSourceTest, File)
   test_source(content, *source);
 }
 
+TEST_F(DataChunkSourceTest, FileReadModes)
+{
+  std::string content = "file source read with each of the file read modes";
+  auto filename       = temp_env->get_temp_filepath("file_source_modes");
+  {
+    std::ofstream file{filename};
+    file << content;
+  }
+  for (auto mode : {cudf::io::text::file_read_mode::STREAM,
+                    cudf::io::text::file_read_mode::MMAP,
+                    cudf::io::text::file_read_mode::PREAD,
+                    cudf::io::text::file_read_mode::DEVICE}) {
+    cudf::io::text::file_source_options options;
+    options.mode = mode;
+    // Several reads per chunk, and more reads than the read-ahead depth
+    options.read_size  = 5;
+    options.read_ahead = 3;
+    auto source        = cudf::io::text::make_source_from_file(filename, options);
+
+    test_source(content, *source);
+  }
+}
+
+TEST_F(DataChunkSourceTest, CompressedFile)
+{
+  std::string content = "compressed file source, split into several blocks";
+  for (auto compression : {cudf::io::compression_type::GZIP, cudf::io::compression_type::ZSTD}) {
+    auto filename = temp_env->get_temp_filepath("compressed_file_source");
+    {
+      std::ofstream file{filename, std::ofstream::binary};
+      file << (compression == cudf::io::compression_type::GZIP ? to_bgzf(content, 8)
+                                                               : to_zstd(content, 8));
+    }
+    for (auto option : {compression, cudf::io::compression_type::AUTO}) {
+      cudf::io::text::file_source_options options;
+      options.compression = option;
+      auto source         = cudf::io::text::make_source_from_file(filename, options);
+
+      test_source(content, *source);
+
+      // skipping whole blocks
+      auto reader = source->create_reader();
+      reader->skip_bytes(21);
+      auto chunk = reader->get_next_chunk(10, rmm::cuda_stream_default);
+      ASSERT_EQ(chunk_to_host(*chunk), content.substr(21, 10));
+    }
+  }
+
+  // Two BZIP2 streams, the first of two blocks: 99981 and 131 bytes, then 96 bytes
+  std::string bzip2_content;
+  for (int i = 0; i < 6263; ++i) {
+    bzip2_content += "0123456789abcdef";
+  }
+  std::string const bzip2_file{
+    "\x42\x5a\x68\x31\x31\x41\x59\x26\x53\x59\xd7\xca\x07\x99\x00\x0c\x34\x09\x00\x7f\xe0\x3f\x00"
+    "\x30\x00\xb8\x0a\x60\x00\x9a\x14\xc0\x01\x34\x0a\x55\x00\x00\x7c\x25\x05\xe6\x31\x28\x2c\xa2"
+    "\x50\x59\xc4\xa0\xb4\x89\x41\x6b\x12\x82\xda\x25\x05\xbc\x4a\x0b\x88\x94\x17\x31\x28\x2e\xa2"
+    "\x50\x5d\xc4\xa0\xbc\x89\x41\x76\x25\x05\xe8\x94\x17\xc2\x50\x5f\x98\xa0\xac\x93\x29\xac\xda"
+    "\xc3\xfe\x7c\x00\x00\x1a\x04\x80\x3f\xf0\x1f\x80\x10\x00\x28\x53\x00\x04\xd0\x2a\x91\x34\xc9"
+    "\x93\x07\x04\x84\xc7\x82\x83\xd1\x51\x61\xf0\xb8\xc0\xfc\x64\x67\x43\x70\x72\x0e\x8b\xb9\x22"
+    "\x9c\x28\x48\x0d\x09\xf9\xe5\x80\x42\x5a\x68\x31\x31\x41\x59\x26\x53\x59\x9b\x72\x0b\xf2\x00"
+    "\x00\x02\x89\x00\x7f\xe0\x3f\x00\x20\x00\x31\x4c\x00\x13\x41\x15\x00\x00\x78\x60\x31\x19\x0c"
+    "\xc6\x83\x51\xb0\xdc\x70\x39\x1d\x0e\xc7\x83\xd1\xf0\xfc\x5d\xc9\x14\xe1\x42\x42\x6d\xc8\x2f"
+    "\xc8",
+    208};
+  auto filename = temp_env->get_temp_filepath("bzip2_file_source");
+  {
+    std::ofstream file{filename, std::ofstream::binary};
+    file << bzip2_file;
+  }
+  // Output buffers which fit no block, and the first block but not the second one
+  for (std::size_t buffer_size : {64, 100'000}) {
+    cudf::io::text::file_source_options options;
+    options.compression = cudf::io::compression_type::BZIP2;
+    options.read_size   = buffer_size;
+    auto source         = cudf::io::text::make_source_from_file(filename, options);
+
+    test_source(bzip2_content, *source);
+  }
+}
+
 TEST_F(DataChunkSourceTest, Host)
 {
   std::string content = "host buffer source";
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <jit/file_cache.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct JitCacheTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Points the kernel cache to a new root, returning the cache directory of the device
+   */
+  std::filesystem::path use_cache_root(std::string const& name)
+  {
+    auto const root = temp_env->get_temp_filepath(name);
+    setenv("LIBCUDF_KERNEL_CACHE_PATH", root.c_str(), 1);
+    return cudf::jit::get_cache_dir();
+  }
+
+  ~JitCacheTest() override { unsetenv("LIBCUDF_KERNEL_CACHE_PATH"); }
+};
+
+void write_file(std::filesystem::path const& path, std::string const& contents)
+{
+  std::ofstream file(path, std::ios::binary);
+  file << contents;
+}
+
+std::string read_file(std::filesystem::path const& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+TEST_F(JitCacheTest, ImportSharedCache)
+{
+  auto const shared_root = temp_env->get_temp_filepath("shared_cache");
+  auto const shared_dir  = use_cache_root("shared_cache");
+  ASSERT_FALSE(shared_dir.empty());
+  write_file(shared_dir / "kernel_a", "first kernel");
+  write_file(shared_dir / "kernel_b", std::string("second\0kernel", 13));
+  // an unfinished write of another process
+  write_file(shared_dir / "kernel_c.tmp.1.2", "partial");
+
+  auto const archive = temp_env->get_temp_filepath("kernels.cache");
+  EXPECT_EQ(cudf::jit::write_cache_archive(archive), 2u);
+
+  for (auto const& shared : {shared_root, archive}) {
+    auto const cache_dir = use_cache_root("cache_from_" + shared.substr(shared.rfind('/') + 1));
+    write_file(cache_dir / "kernel_a", "already cached");
+
+    EXPECT_EQ(cudf::jit::import_shared_cache(shared, cache_dir), 1u);
+    EXPECT_EQ(read_file(cache_dir / "kernel_a"), "already cached");
+    EXPECT_EQ(read_file(cache_dir / "kernel_b"), std::string("second\0kernel", 13));
+    EXPECT_FALSE(std::filesystem::exists(cache_dir / "kernel_c.tmp.1.2"));
+    // no temporary file is left behind
+    auto const files = std::filesystem::directory_iterator(cache_dir);
+    EXPECT_EQ(std::distance(std::filesystem::begin(files), std::filesystem::end(files)), 2);
+
+    EXPECT_EQ(cudf::jit::import_shared_cache(shared, cache_dir), 0u);
+  }
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <limits>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+using gather_map     = rmm::device_uvector<cudf::size_type>;
+
+constexpr cudf::size_type NoneValue = std::numeric_limits<cudf::size_type>::min();
+
+struct AsofJoinTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+cudf::column_view as_column(gather_map const& map)
+{
+  return cudf::column_view{cudf::device_span<cudf::size_type const>{map}};
+}
+}  // namespace
+
+TEST_F(AsofJoinTest, Directions)
+{
+  column_wrapper<int32_t> left_symbols{0, 0, 1, 1};
+  column_wrapper<int32_t> left_times{1, 5, 2, 9};
+  column_wrapper<int32_t> right_symbols{1, 0, 0};
+  column_wrapper<int32_t> right_times{3, 0, 4};
+
+  auto const left_keys  = cudf::table_view{{left_symbols}};
+  auto const right_keys = cudf::table_view{{right_symbols}};
+
+  {
+    auto const result = cudf::asof_join(left_keys, right_keys, left_times, right_times);
+    column_wrapper<cudf::size_type> expected{1, 2, NoneValue, 0};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  {
+    auto const result = cudf::asof_join(
+      left_keys, right_keys, left_times, right_times, cudf::asof_direction::FORWARD);
+    column_wrapper<cudf::size_type> expected{2, NoneValue, 0, NoneValue};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  {
+    auto const result = cudf::asof_join(
+      left_keys, right_keys, left_times, right_times, cudf::asof_direction::NEAREST);
+    column_wrapper<cudf::size_type> expected{1, 2, 0, 0};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+}
+
+TEST_F(AsofJoinTest, ExactMatchesAndTies)
+{
+  column_wrapper<int64_t> left_times{2, 4, 6};
+  column_wrapper<int64_t> right_times{8, 2, 4, 2, 0};
+
+  auto const no_keys = cudf::table_view{};
+
+  // Backward matches the last of the equal right rows, forward the first one
+  {
+    auto const result = cudf::asof_join(no_keys, no_keys, left_times, right_times);
+    column_wrapper<cudf::size_type> expected{3, 2, 2};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  {
+    auto const result = cudf::asof_join(
+      no_keys, no_keys, left_times, right_times, cudf::asof_direction::FORWARD);
+    column_wrapper<cudf::size_type> expected{1, 2, 0};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  // Exact matches are the first of the equal rows as when looking forward, and 6 is as close to
+  // 4 as to 8, where the preceding row wins
+  {
+    auto const result = cudf::asof_join(
+      no_keys, no_keys, left_times, right_times, cudf::asof_direction::NEAREST);
+    column_wrapper<cudf::size_type> expected{1, 2, 2};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+}
+
+TEST_F(AsofJoinTest, TimestampTolerance)
+{
+  using timestamp = cudf::timestamp_s;
+  using duration  = cudf::duration_s;
+
+  strcol_wrapper left_symbols({"AAPL", "MSFT", "AAPL", "MSFT"});
+  column_wrapper<timestamp, timestamp::rep> left_times{10, 10, 25, 31};
+  strcol_wrapper right_symbols({"MSFT", "AAPL", "AAPL", "MSFT"});
+  column_wrapper<timestamp, timestamp::rep> right_times{8, 9, 20, 30};
+
+  auto const left_keys  = cudf::table_view{{left_symbols}};
+  auto const right_keys = cudf::table_view{{right_symbols}};
+
+  auto const tolerance = cudf::duration_scalar<duration>(duration{2}, true);
+  auto const result    = cudf::asof_join(left_keys,
+                                      right_keys,
+                                      left_times,
+                                      right_times,
+                                      cudf::asof_direction::BACKWARD,
+                                      tolerance);
+  column_wrapper<cudf::size_type> expected{1, 0, NoneValue, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+}
+
+TEST_F(AsofJoinTest, DistantValues)
+{
+  auto constexpr min = std::numeric_limits<int32_t>::min();
+  auto constexpr max = std::numeric_limits<int32_t>::max();
+  column_wrapper<int32_t> left_values{max, min, 0};
+  column_wrapper<int32_t> right_values{min, max};
+
+  auto const no_keys = cudf::table_view{};
+
+  {
+    auto const result = cudf::asof_join(
+      no_keys, no_keys, left_values, right_values, cudf::asof_direction::NEAREST);
+    column_wrapper<cudf::size_type> expected{1, 0, 1};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  // Distances beyond the range of the type do not wrap around to within the tolerance
+  {
+    auto const tolerance = cudf::numeric_scalar<int32_t>(10);
+    auto const result    = cudf::asof_join(no_keys,
+                                        no_keys,
+                                        left_values,
+                                        right_values,
+                                        cudf::asof_direction::NEAREST,
+                                        tolerance);
+    column_wrapper<cudf::size_type> expected{1, 0, NoneValue};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+}
+
+TEST_F(AsofJoinTest, Nulls)
+{
+  column_wrapper<int32_t> left_symbols{{0, 0, 1, 1}, {1, 1, 0, 1}};
+  column_wrapper<int32_t> left_times{{5, 5, 5, 5}, {1, 0, 1, 1}};
+  column_wrapper<int32_t> right_symbols{{0, 1, 1, 0}, {1, 0, 1, 1}};
+  column_wrapper<int32_t> right_times{{1, 2, 3, 4}, {1, 1, 1, 0}};
+
+  auto const left_keys  = cudf::table_view{{left_symbols}};
+  auto const right_keys = cudf::table_view{{right_symbols}};
+
+  // A null on value never matches, a null key matches a null key unless nulls are unequal
+  {
+    auto const result = cudf::asof_join(left_keys, right_keys, left_times, right_times);
+    column_wrapper<cudf::size_type> expected{0, NoneValue, 1, 2};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+  {
+    auto const result = cudf::asof_join(left_keys,
+                                        right_keys,
+                                        left_times,
+                                        right_times,
+                                        cudf::asof_direction::NEAREST,
+                                        std::nullopt,
+                                        cudf::null_equality::UNEQUAL);
+    column_wrapper<cudf::size_type> expected{0, NoneValue, NoneValue, 2};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+  }
+}
+
+TEST_F(AsofJoinTest, EmptyRight)
+{
+  column_wrapper<float> left_values{1.5f, 2.5f};
+  column_wrapper<float> right_values{};
+
+  auto const no_keys = cudf::table_view{};
+  auto const result  = cudf::asof_join(
+    no_keys, no_keys, left_values, right_values, cudf::asof_direction::NEAREST);
+  column_wrapper<cudf::size_type> expected{NoneValue, NoneValue};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, as_column(*result));
+}
+
+TEST_F(AsofJoinTest, InvalidInputs)
+{
+  column_wrapper<int32_t> keys{0, 1, 2};
+  column_wrapper<int32_t> int_times{1, 2, 3};
+  column_wrapper<int64_t> long_times{1, 2, 3};
+  column_wrapper<int32_t> short_times{1, 2};
+  strcol_wrapper string_times({"a", "b", "c"});
+
+  auto const key_table = cudf::table_view{{keys}};
+  auto const no_keys   = cudf::table_view{};
+
+  EXPECT_THROW(cudf::asof_join(key_table, no_keys, int_times, int_times), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(key_table, key_table, short_times, int_times), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(no_keys, no_keys, int_times, long_times), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(no_keys, no_keys, string_times, string_times), cudf::logic_error);
+
+  auto const tolerance = cudf::numeric_scalar<int64_t>(1);
+  EXPECT_THROW(cudf::asof_join(
+                 no_keys, no_keys, int_times, int_times, cudf::asof_direction::FORWARD, tolerance),
+               cudf::logic_error);
+  auto const negative_tolerance = cudf::numeric_scalar<int32_t>(-1);
+  EXPECT_THROW(
+    cudf::asof_join(
+      no_keys, no_keys, int_times, int_times, cudf::asof_direction::FORWARD, negative_tolerance),
+    cudf::logic_error);
+}
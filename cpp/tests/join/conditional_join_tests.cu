@@ -494,6 +494,65 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestRangeComparison)
+{
+  auto col_ref_1   = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower_bound = cudf::ast::operation(
+    cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left_0, col_ref_right_0);
+  auto upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_left_0, col_ref_1);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+
+  this->test(
+    {{5, 0, 3, 2, 4, 1}}, {{1, 3}, {2, 5}}, expression, {{5, 0}, {3, 0}, {2, 1}, {4, 1}, {0, 1}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestExclusiveRangeComparison)
+{
+  auto col_ref_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_right_0, col_ref_left_0);
+  auto upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_1, col_ref_left_0);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+
+  this->test({{5, 0, 3, 2, 4, 1}}, {{1, 3}, {2, 5}}, expression, {{4, 1}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestRangeComparisonResidualCondition)
+{
+  // The equality is not a range predicate and is evaluated on the rows within the range
+  auto col_ref_left_1  = cudf::ast::column_reference(1, cudf::ast::table_reference::LEFT);
+  auto col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto col_ref_right_2 = cudf::ast::column_reference(2, cudf::ast::table_reference::RIGHT);
+  auto lower_bound     = cudf::ast::operation(
+    cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left_0, col_ref_right_0);
+  auto upper_bound =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_left_0, col_ref_right_1);
+  auto range = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower_bound, upper_bound);
+  auto equal =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_left_1, col_ref_right_2);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, range, equal);
+
+  this->test({{0, 1, 2, 3, 4, 5}, {0, 1, 0, 1, 0, 1}},
+             {{1, 3}, {2, 5}, {1, 0}},
+             expression,
+             {{1, 0}, {4, 1}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestRangeComparisonNulls)
+{
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_0);
+
+  this->test_nulls({{{0, 5, 10, 7}, {1, 1, 1, 0}}},
+                   {{{4, 0, 6, 1, 8}, {1, 0, 1, 1, 1}}},
+                   expression,
+                   {{0, 0}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 4}});
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -572,6 +631,23 @@ TYPED_TEST(ConditionalLeftJoinTest, TestOneColumnLeftEmpty)
   this->test({{}}, {{3, 4, 5}}, left_zero_eq_right_zero, {});
 };
 
+TYPED_TEST(ConditionalLeftJoinTest, TestRangeComparisonNulls)
+{
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  this->test_nulls({{{0, 5, 10, 7}, {1, 1, 1, 0}}},
+                   {{{4, 0, 6, 1}, {1, 0, 1, 1}}},
+                   expression,
+                   {{0, JoinNoneValue},
+                    {1, 0},
+                    {1, 3},
+                    {2, 0},
+                    {2, 2},
+                    {2, 3},
+                    {3, JoinNoneValue}});
+};
+
 TYPED_TEST(ConditionalLeftJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -846,6 +922,14 @@ TYPED_TEST(ConditionalLeftAntiJoinTest, TestTwoColumnThreeRowSomeEqual)
   this->test({{0, 1, 2}, {10, 20, 30}}, {{0, 1, 3}, {30, 40, 50}}, left_zero_eq_right_zero, {2});
 };
 
+TYPED_TEST(ConditionalLeftAntiJoinTest, TestRangeComparison)
+{
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_0);
+
+  this->test({{0, 5, 10}}, {{4, 6}}, expression, {2});
+};
+
 TYPED_TEST(ConditionalLeftAntiJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+using int_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+using join_kind   = cudf::grace_hash_join::join_kind;
+
+struct GraceHashJoinTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Makes a table of a key column with `num_keys` distinct, nullable keys and a payload
+   * column; `skew` of every 4 rows have key 0.
+   */
+  std::unique_ptr<cudf::table> make_table(int num_rows, int num_keys, int skew, int payload_base)
+  {
+    std::vector<int32_t> keys(num_rows);
+    std::vector<bool> valids(num_rows);
+    std::vector<int32_t> payloads(num_rows);
+    for (int i = 0; i < num_rows; ++i) {
+      keys[i]     = (i % 4 < skew) ? 0 : (i * 7) % num_keys;
+      valids[i]   = i % 13 != 5;
+      payloads[i] = payload_base + i;
+    }
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    columns.push_back(int_wrapper(keys.begin(), keys.end(), valids.begin()).release());
+    columns.push_back(int_wrapper(payloads.begin(), payloads.end()).release());
+    return std::make_unique<cudf::table>(std::move(columns));
+  }
+
+  /**
+   * @brief Runs the grace hash join over `num_chunks` chunks of each table and compares its
+   * sorted result with the one of the in-memory join.
+   */
+  void run(cudf::table_view const& left,
+           cudf::table_view const& right,
+           join_kind kind,
+           int num_chunks,
+           cudf::grace_hash_join_options const& options)
+  {
+    cudf::grace_hash_join join({0}, {0}, kind, options);
+    for (auto const& chunk : split(left, num_chunks)) {
+      join.append_left(chunk);
+    }
+    for (auto const& chunk : split(right, num_chunks)) {
+      join.append_right(chunk);
+    }
+
+    std::vector<std::unique_ptr<cudf::table>> results;
+    while (auto result = join.next()) {
+      results.push_back(std::move(result));
+    }
+    std::vector<cudf::table_view> result_views;
+    std::transform(results.begin(),
+                   results.end(),
+                   std::back_inserter(result_views),
+                   [](auto const& result) { return result->view(); });
+    ASSERT_FALSE(result_views.empty());
+    auto const result = cudf::concatenate(result_views);
+
+    auto const expected = expected_join(left, right, kind, options.compare_nulls);
+
+    auto const sorted_result   = cudf::sort(result->view());
+    auto const sorted_expected = cudf::sort(expected->view());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_expected, *sorted_result);
+  }
+
+ private:
+  std::vector<cudf::table_view> split(cudf::table_view const& input, int num_chunks)
+  {
+    std::vector<cudf::size_type> splits;
+    for (int i = 1; i < num_chunks; ++i) {
+      splits.push_back(input.num_rows() * i / num_chunks);
+    }
+    return cudf::split(input, splits);
+  }
+
+  std::unique_ptr<cudf::table> expected_join(cudf::table_view const& left,
+                                             cudf::table_view const& right,
+                                             join_kind kind,
+                                             cudf::null_equality compare_nulls)
+  {
+    auto const left_keys  = left.select({0});
+    auto const right_keys = right.select({0});
+
+    auto const [left_map, right_map] = [&] {
+      switch (kind) {
+        case join_kind::INNER: return cudf::inner_join(left_keys, right_keys, compare_nulls);
+        case join_kind::LEFT: return cudf::left_join(left_keys, right_keys, compare_nulls);
+        default: return cudf::full_join(left_keys, right_keys, compare_nulls);
+      }
+    }();
+
+    auto const bounds_policy = kind == join_kind::INNER ? cudf::out_of_bounds_policy::DONT_CHECK
+                                                        : cudf::out_of_bounds_policy::NULLIFY;
+    auto const left_indices  = cudf::device_span<cudf::size_type const>{*left_map};
+    auto const right_indices = cudf::device_span<cudf::size_type const>{*right_map};
+    auto columns = cudf::gather(left, cudf::column_view{left_indices}, bounds_policy)->release();
+    auto right_columns =
+      cudf::gather(right, cudf::column_view{right_indices}, bounds_policy)->release();
+    columns.insert(columns.end(),
+                   std::make_move_iterator(right_columns.begin()),
+                   std::make_move_iterator(right_columns.end()));
+    return std::make_unique<cudf::table>(std::move(columns));
+  }
+};
+
+TEST_F(GraceHashJoinTest, InnerJoin)
+{
+  auto const left  = make_table(1000, 300, 0, 0);
+  auto const right = make_table(700, 300, 0, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions = 4;
+  run(*left, *right, join_kind::INNER, 3, options);
+}
+
+TEST_F(GraceHashJoinTest, LeftJoin)
+{
+  auto const left  = make_table(1000, 500, 0, 0);
+  auto const right = make_table(700, 300, 0, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions = 5;
+  run(*left, *right, join_kind::LEFT, 4, options);
+}
+
+TEST_F(GraceHashJoinTest, FullJoinUnequalNulls)
+{
+  auto const left  = make_table(1000, 500, 0, 0);
+  auto const right = make_table(700, 300, 0, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions = 3;
+  options.compare_nulls  = cudf::null_equality::UNEQUAL;
+  run(*left, *right, join_kind::FULL, 2, options);
+}
+
+TEST_F(GraceHashJoinTest, Repartition)
+{
+  auto const left  = make_table(2000, 400, 0, 0);
+  auto const right = make_table(2000, 400, 0, 10000);
+
+  // Every partition of the first level exceeds the limit and is partitioned again
+  cudf::grace_hash_join_options options;
+  options.num_partitions      = 2;
+  options.max_partition_bytes = 1024;
+  options.max_depth           = 2;
+  run(*left, *right, join_kind::FULL, 3, options);
+}
+
+TEST_F(GraceHashJoinTest, SkewedKey)
+{
+  // Half of the rows have key 0, whose partition cannot be split by partitioning again
+  auto const left  = make_table(2000, 400, 2, 0);
+  auto const right = make_table(400, 400, 2, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions      = 4;
+  options.max_partition_bytes = 2048;
+  run(*left, *right, join_kind::LEFT, 3, options);
+}
+
+TEST_F(GraceHashJoinTest, SpillToFile)
+{
+  auto const left  = make_table(1000, 300, 1, 0);
+  auto const right = make_table(700, 300, 1, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions      = 4;
+  options.max_partition_bytes = 2048;
+  options.spill_directory     = temp_env->get_temp_dir();
+  run(*left, *right, join_kind::FULL, 3, options);
+}
+
+TEST_F(GraceHashJoinTest, EmptyRight)
+{
+  auto const left  = make_table(100, 30, 0, 0);
+  auto const right = make_table(0, 30, 0, 10000);
+
+  cudf::grace_hash_join_options options;
+  options.num_partitions = 4;
+  run(*left, *right, join_kind::LEFT, 2, options);
+}
+
+TEST_F(GraceHashJoinTest, InvalidUse)
+{
+  auto const left  = make_table(100, 30, 0, 0);
+  auto const right = make_table(100, 30, 0, 10000);
+
+  EXPECT_THROW(cudf::grace_hash_join({0, 1}, {0}, join_kind::INNER), cudf::logic_error);
+
+  cudf::grace_hash_join join({0}, {0}, join_kind::INNER);
+  join.append_left(*left);
+  EXPECT_THROW(join.next(), cudf::logic_error);
+  EXPECT_THROW(join.append_left(left->view().select({0})), cudf::logic_error);
+
+  join.append_right(*right);
+  EXPECT_NE(join.next(), nullptr);
+  EXPECT_THROW(join.append_left(*left), cudf::logic_error);
+}
@@ -20,6 +20,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -1435,6 +1436,74 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinCursor)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3, 2, 2, 5}}.release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2, 6, 2}}.release());
+  Table t0(std::move(cols0));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+
+  // Checks that the pages of a cursor hold at most `max_pairs` pairs and add up to `expected`
+  auto const expect_equivalent_pages =
+    [&](cudf::join_cursor& cursor, std::size_t max_pairs, auto const& expected) {
+      std::vector<cudf::size_type> left_map;
+      std::vector<cudf::size_type> right_map;
+      while (not cursor.done()) {
+        auto const [left_page, right_page] = cursor.next(max_pairs);
+        EXPECT_LE(left_page->size(), max_pairs);
+        EXPECT_EQ(left_page->size(), right_page->size());
+        auto const left  = cudf::detail::make_std_vector_sync(
+          cudf::device_span<cudf::size_type const>(*left_page), cudf::default_stream_value);
+        auto const right = cudf::detail::make_std_vector_sync(
+          cudf::device_span<cudf::size_type const>(*right_page), cudf::default_stream_value);
+        left_map.insert(left_map.end(), left.begin(), left.end());
+        right_map.insert(right_map.end(), right.begin(), right.end());
+      }
+      column_wrapper<int32_t> col_left(left_map.begin(), left_map.end());
+      column_wrapper<int32_t> col_right(right_map.begin(), right_map.end());
+      auto const [sorted_gold, sorted_result] =
+        gather_maps_as_tables(col_left, col_right, expected);
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+    };
+
+  // Pages smaller than, equal to and larger than the 4 pairs of a probe row
+  for (std::size_t const max_pairs : {1, 3, 4, 5, 100}) {
+    expect_equivalent_pages(*hash_join.inner_join_cursor(t0), max_pairs, hash_join.inner_join(t0));
+    expect_equivalent_pages(*hash_join.left_join_cursor(t0), max_pairs, hash_join.left_join(t0));
+    expect_equivalent_pages(*hash_join.full_join_cursor(t0), max_pairs, hash_join.full_join(t0));
+  }
+
+  EXPECT_THROW(hash_join.inner_join_cursor(t0)->next(0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinCursorEmptyBuild)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{}.release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2}}.release());
+  Table t0(std::move(cols0));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+
+  auto inner_cursor = hash_join.inner_join_cursor(t0);
+  EXPECT_TRUE(inner_cursor->done());
+
+  auto left_cursor = hash_join.left_join_cursor(t0);
+  auto result      = left_cursor->next(2);
+  EXPECT_EQ(result.first->size(), 2u);
+  result = left_cursor->next(2);
+  EXPECT_EQ(result.first->size(), 1u);
+  EXPECT_TRUE(left_cursor->done());
+}
+
 TEST_F(JoinTest, HashJoinWithStructsAndNulls)
 {
   auto col0_names_col = strcol_wrapper{
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <limits>
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+using gather_map     = rmm::device_uvector<cudf::size_type>;
+
+constexpr cudf::size_type NoneValue = std::numeric_limits<cudf::size_type>::min();
+
+struct SortedJoinTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+cudf::column_view as_column(gather_map const& map)
+{
+  return cudf::column_view{cudf::device_span<cudf::size_type const>{map}};
+}
+}  // namespace
+
+TEST_F(SortedJoinTest, InnerJoin)
+{
+  column_wrapper<int32_t> left_col0{0, 1, 1, 2, 2, 4};
+  strcol_wrapper left_col1({"a", "b", "c", "a", "a", "z"});
+  column_wrapper<int32_t> right_col0{1, 1, 2, 2, 3, 4};
+  strcol_wrapper right_col1({"b", "b", "a", "a", "c", "y"});
+
+  auto const left  = cudf::table_view{{left_col0, left_col1}};
+  auto const right = cudf::table_view{{right_col0, right_col1}};
+
+  auto const [left_map, right_map] = cudf::sorted_inner_join(left, right);
+
+  column_wrapper<cudf::size_type> expected_left{1, 1, 3, 3, 4, 4};
+  column_wrapper<cudf::size_type> expected_right{0, 1, 2, 3, 2, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_left, as_column(*left_map));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_right, as_column(*right_map));
+}
+
+TEST_F(SortedJoinTest, LeftJoinDescendingNulls)
+{
+  column_wrapper<int32_t> left_col0{{0, 5, 3, 3, 1, 0}, {0, 1, 1, 1, 1, 1}};
+  column_wrapper<int32_t> right_col0{{0, 0, 3, 2, 1}, {0, 0, 1, 1, 1}};
+
+  auto const left  = cudf::table_view{{left_col0}};
+  auto const right = cudf::table_view{{right_col0}};
+
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER};
+
+  {
+    auto const [left_map, right_map] =
+      cudf::sorted_left_join(left, right, column_order, null_precedence);
+
+    column_wrapper<cudf::size_type> expected_left{0, 0, 1, 2, 3, 4, 5};
+    column_wrapper<cudf::size_type> expected_right{0, 1, NoneValue, 2, 2, 4, NoneValue};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_left, as_column(*left_map));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_right, as_column(*right_map));
+  }
+  {
+    auto const [left_map, right_map] = cudf::sorted_left_join(
+      left, right, column_order, null_precedence, cudf::null_equality::UNEQUAL);
+
+    column_wrapper<cudf::size_type> expected_left{0, 1, 2, 3, 4, 5};
+    column_wrapper<cudf::size_type> expected_right{NoneValue, NoneValue, 2, 2, 4, NoneValue};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_left, as_column(*left_map));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_right, as_column(*right_map));
+  }
+}
+
+TEST_F(SortedJoinTest, LeftSemiAntiJoin)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 1, 2, 3, 5}, {0, 1, 1, 1, 1, 1}};
+  column_wrapper<int32_t> right_col0{{0, 1, 3, 4}, {0, 1, 1, 1}};
+
+  auto const left  = cudf::table_view{{left_col0}};
+  auto const right = cudf::table_view{{right_col0}};
+
+  auto const semi = cudf::sorted_left_semi_join(left, right);
+  column_wrapper<cudf::size_type> expected_semi{0, 1, 2, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_semi, as_column(*semi));
+
+  auto const anti = cudf::sorted_left_anti_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+  column_wrapper<cudf::size_type> expected_anti{0, 3, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_anti, as_column(*anti));
+}
+
+TEST_F(SortedJoinTest, EmptyInputs)
+{
+  column_wrapper<int32_t> keys{1, 2, 3};
+  column_wrapper<int32_t> empty{};
+
+  auto const keys_table  = cudf::table_view{{keys}};
+  auto const empty_table = cudf::table_view{{empty}};
+
+  auto const [left_map, right_map] = cudf::sorted_left_join(keys_table, empty_table);
+  column_wrapper<cudf::size_type> expected_left{0, 1, 2};
+  column_wrapper<cudf::size_type> expected_right{NoneValue, NoneValue, NoneValue};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_left, as_column(*left_map));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_right, as_column(*right_map));
+
+  auto const inner = cudf::sorted_inner_join(empty_table, keys_table);
+  EXPECT_EQ(inner.first->size(), 0);
+  EXPECT_EQ(inner.second->size(), 0);
+
+  auto const anti = cudf::sorted_left_anti_join(keys_table, empty_table);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_left, as_column(*anti));
+}
+
+TEST_F(SortedJoinTest, MatchesHashJoin)
+{
+  std::vector<int32_t> left_keys(1000);
+  std::vector<int32_t> right_keys(700);
+  for (std::size_t i = 0; i < left_keys.size(); ++i) {
+    left_keys[i] = static_cast<int32_t>(i / 3);
+  }
+  for (std::size_t i = 0; i < right_keys.size(); ++i) {
+    right_keys[i] = static_cast<int32_t>(i * 3 / 5);
+  }
+  column_wrapper<int32_t> left_col0(left_keys.begin(), left_keys.end());
+  column_wrapper<int32_t> right_col0(right_keys.begin(), right_keys.end());
+
+  auto const left  = cudf::table_view{{left_col0}};
+  auto const right = cudf::table_view{{right_col0}};
+
+  auto const [left_map, right_map]   = cudf::sorted_inner_join(left, right);
+  auto const [hash_left, hash_right] = cudf::inner_join(left, right);
+
+  // The pairs of the sorted join are ordered by left row, then by right row
+  auto const result = cudf::table_view{{as_column(*left_map), as_column(*right_map)}};
+  auto const expected =
+    cudf::sort(cudf::table_view{{as_column(*hash_left), as_column(*hash_right)}});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, result);
+}
+
+TEST_F(SortedJoinTest, InvalidKeys)
+{
+  column_wrapper<int32_t> col0{1, 2, 3};
+  column_wrapper<int32_t> col1{1, 2, 3};
+
+  auto const one_column  = cudf::table_view{{col0}};
+  auto const two_columns = cudf::table_view{{col0, col1}};
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING, cudf::order::ASCENDING};
+
+  EXPECT_THROW(cudf::sorted_inner_join(two_columns, one_column), cudf::logic_error);
+  EXPECT_THROW(cudf::sorted_left_semi_join(one_column, one_column, column_order),
+               cudf::logic_error);
+}